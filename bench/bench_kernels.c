@@ -0,0 +1,980 @@
+/*!
+ *  \file bench_kernels.c
+ *  \brief      Microbenchmarks the kernels of the library one at a time.
+ *  \details    Times every kernel of avx2_intrinsics.h, avx512_intrinsics.h,
+ nom_intrinsics.h and mmx_intrinsics.h over a sweep of block sizes, in the
+ spirit of Google Benchmark:
+ 1. Each kernel runs on synthetic data that stays in cache, repeated until the
+ measurement lasts at least the minimum time.
+ 2. Samples/s, cycles/sample (TSC reference cycles) and GB/s of data touched by
+ the kernel are reported on the console.
+ 3. All measurements are also written to a JSON file so that results from
+ different hosts can be compared and used to pick the kernel variants.
+ Kernels of an instruction set or extension not supported by the CPU are
+ skipped. The binary is built without any -m flags, the SIMD headers are
+ compiled with the per-function target options of dispatch_intrinsics.h.
+ *  \author    Damian Miralles
+ *  \author    Jake Johnson
+ *  \date      Jan 23, 2018
+ *  \code{.sh}
+# Sample compilation script
+$ gcc -I ../src/ ../bench/bench_kernels.c -g -pthread -lm -o bench_kernels -O3
+
+# Run every kernel whose name contains "fused", 0.2 s per measurement
+$ ./bench_kernels -f fused -t 0.2 -o bench_kernels.json
+ *  \endcode
+ */
+
+// mmintrin.h has to be seen first under the MMX target, otherwise GCC cannot
+// inline the MMX intrinsics in a build without -m flags
+#pragma GCC push_options
+#pragma GCC target("mmx,sse2")
+#include "mmx_intrinsics.h"
+#pragma GCC pop_options
+
+#include "carrier_lut.h"
+#include "dispatch_intrinsics.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_MAX_BLK 65536 //!< Largest block size of the sweep
+#define BENCH_CODE_LEN 8192 //!< Chips in the synthetic ranging code
+#define BENCH_NUM_TAPS 5    //!< Taps of the N-tap correlator benchmarks
+#define BENCH_LUT_BITS 5    //!< Index bits of the register resident LUT
+#define BENCH_SPACING 8     //!< Half a chip in samples, for code_window
+
+//! Block sizes of the sweep, 16368 is one code period of the test data
+static const int32_t bench_blk_sizes[] = {1024, 4096, 16368, BENCH_MAX_BLK};
+
+//! Tracking parameters used to drive the NCOs and code generators
+static const double bench_samp_freq = 16367600.0;
+static const double bench_carr_freq = 4130400.0;
+static const double bench_code_freq = 1023002.79220779;
+static const double bench_carr_rate = 500.0;
+
+/*!
+ *  \brief Input and output buffers shared by every benchmark
+ */
+typedef struct {
+  int8_t *si8;                       /*!< Real or interleaved I/Q samples */
+  uint8_t *packed;                   /*!< Packed 2-bit/4-bit samples */
+  int16_t *si16[3];                  /*!< si16 vectors */
+  int8_t *si8_out[3];                /*!< si8 replica vectors */
+  int16_t *iq16;                     /*!< Interleaved I/Q si16 samples */
+  uint64_t *bits[2];                 /*!< Packed sign vectors */
+  int32_t *si32[5];                  /*!< si32 vectors */
+  float *fl32[5];                    /*!< fl32 vectors */
+  const int32_t *sin_lut;            /*!< si32 sine lookup table */
+  const int32_t *cos_lut;            /*!< si32 cosine lookup table */
+  const float *sin_lut_fl32;         /*!< fl32 sine lookup table */
+  const float *cos_lut_fl32;         /*!< fl32 cosine lookup table */
+  const int32_t *sincos_lut;         /*!< Packed si32 sine/cosine table */
+  const float *sincos_lut_fl32;      /*!< Interleaved fl32 sine/cosine table */
+  int32_t sin_lut_small[32];         /*!< si32 sine table held in registers */
+  float sin_lut_small_fl32[32];      /*!< fl32 sine table held in registers */
+  int32_t *cacode;                   /*!< Padded si32 ranging code */
+  float *cacode_fl32;                /*!< Padded fl32 ranging code */
+  float tap_offsets[BENCH_NUM_TAPS]; /*!< Chip offsets of the N-tap taps */
+  double out[2 * BENCH_NUM_TAPS];    /*!< Correlator outputs */
+} bench_data_t;
+
+/*!
+ *  \brief A kernel under test
+ */
+typedef struct {
+  const char *name;        /*!< Kernel name without the isa prefix */
+  const char *type;        /*!< Data type the kernel works on */
+  int isa;                 /*!< gnss_isa_t required, -1 for every table */
+  double bytes_per_sample; /*!< Bytes read and written per sample */
+  void (*run)(const gnss_kernels_t *k, bench_data_t *d, const int32_t blk);
+  uint32_t ext; /*!< gnss_ext_t required on top of isa, 0 for none */
+} bench_kernel_t;
+
+/*!
+ *  \brief Result of a single measurement
+ */
+typedef struct {
+  char name[96];             /*!< Name such as nom_nco_si32/1024 */
+  const char *isa;           /*!< Instruction set of the kernel */
+  const char *type;          /*!< Data type the kernel works on */
+  int32_t blk_size;          /*!< Samples per call */
+  long iterations;           /*!< Number of timed calls */
+  double real_time_ns;       /*!< Wall clock time per call */
+  double samples_per_second; /*!< Throughput in samples */
+  double cycles_per_sample;  /*!< TSC reference cycles per sample */
+  double bytes_per_second;   /*!< Throughput in bytes touched */
+} bench_result_t;
+
+//! Keeps the compiler from dropping the results of the reduction kernels
+static volatile double bench_sink;
+
+// Kernels bound through the dispatch tables
+
+static void bench_nco_si32(const gnss_kernels_t *k, bench_data_t *d,
+                           const int32_t blk) {
+  k->nco_si32(d->si32[0], d->sin_lut, blk, 0.3, bench_carr_freq,
+              bench_samp_freq);
+}
+
+static void bench_nco_fl32(const gnss_kernels_t *k, bench_data_t *d,
+                           const int32_t blk) {
+  k->nco_fl32(d->fl32[0], d->sin_lut_fl32, blk, 0.3, bench_carr_freq,
+              bench_samp_freq);
+}
+
+static void bench_nco_rot_fl32(const gnss_kernels_t *k, bench_data_t *d,
+                               const int32_t blk) {
+  k->nco_rot_fl32(d->fl32[0], d->sin_lut_fl32, blk, 0.3, bench_carr_freq,
+                  bench_samp_freq);
+}
+
+static void bench_nco_state_si32(const gnss_kernels_t *k, bench_data_t *d,
+                                 const int32_t blk) {
+  gnss_nco_t nco;
+
+  gnss_nco_init(&nco, 0.3, bench_carr_freq, bench_samp_freq);
+  k->nco_state_si32(d->si32[0], d->sin_lut, blk, &nco);
+}
+
+static void bench_nco_state_fl32(const gnss_kernels_t *k, bench_data_t *d,
+                                 const int32_t blk) {
+  gnss_nco_t nco;
+
+  gnss_nco_init(&nco, 0.3, bench_carr_freq, bench_samp_freq);
+  k->nco_state_fl32(d->fl32[0], d->sin_lut_fl32, blk, &nco);
+}
+
+static void bench_nco_iq_si32(const gnss_kernels_t *k, bench_data_t *d,
+                              const int32_t blk) {
+  gnss_nco_t nco;
+
+  gnss_nco_init(&nco, 0.3, bench_carr_freq, bench_samp_freq);
+  k->nco_iq_si32(d->si32[0], d->si32[1], d->sincos_lut, blk, &nco);
+}
+
+static void bench_nco_iq_fl32(const gnss_kernels_t *k, bench_data_t *d,
+                              const int32_t blk) {
+  gnss_nco_t nco;
+
+  gnss_nco_init(&nco, 0.3, bench_carr_freq, bench_samp_freq);
+  k->nco_iq_fl32(d->fl32[0], d->fl32[1], d->sincos_lut_fl32, blk, &nco);
+}
+
+static void bench_nco_perm_si32(const gnss_kernels_t *k, bench_data_t *d,
+                                const int32_t blk) {
+  gnss_nco_t nco;
+
+  gnss_nco_init(&nco, 0.3, bench_carr_freq, bench_samp_freq);
+  k->nco_perm_si32(d->si32[0], d->sin_lut_small, BENCH_LUT_BITS, blk, &nco);
+}
+
+static void bench_nco_perm_fl32(const gnss_kernels_t *k, bench_data_t *d,
+                                const int32_t blk) {
+  gnss_nco_t nco;
+
+  gnss_nco_init(&nco, 0.3, bench_carr_freq, bench_samp_freq);
+  k->nco_perm_fl32(d->fl32[0], d->sin_lut_small_fl32, BENCH_LUT_BITS, blk,
+                   &nco);
+}
+
+static void bench_nco_poly_fl32(const gnss_kernels_t *k, bench_data_t *d,
+                                const int32_t blk) {
+  gnss_nco_t nco;
+
+  gnss_nco_init(&nco, 0.3, bench_carr_freq, bench_samp_freq);
+  k->nco_poly_fl32(d->fl32[0], d->fl32[1], GNSS_NCO_LUT_AMPLITUDE, blk, &nco);
+}
+
+static void bench_code_si32(const gnss_kernels_t *k, bench_data_t *d,
+                            const int32_t blk) {
+  k->code_si32(d->si32[0], d->si32[1], d->si32[2], d->cacode, blk, 0.25,
+               bench_code_freq, bench_samp_freq);
+}
+
+static void bench_nco_si16(const gnss_kernels_t *k, bench_data_t *d,
+                           const int32_t blk) {
+  k->nco_si16(d->si16[0], d->sin_lut, blk, 0.3, bench_carr_freq,
+              bench_samp_freq);
+}
+
+static void bench_nco_si8(const gnss_kernels_t *k, bench_data_t *d,
+                          const int32_t blk) {
+  k->nco_si8(d->si8_out[0], d->sin_lut, blk, 0.3, bench_carr_freq,
+             bench_samp_freq);
+}
+
+static void bench_code_fl32(const gnss_kernels_t *k, bench_data_t *d,
+                            const int32_t blk) {
+  k->code_fl32(d->fl32[0], d->fl32[1], d->fl32[2], d->cacode_fl32, blk, 0.25,
+               bench_code_freq, bench_samp_freq);
+}
+
+static void bench_code_si16(const gnss_kernels_t *k, bench_data_t *d,
+                            const int32_t blk) {
+  k->code_si16(d->si16[0], d->si16[1], d->si16[2], d->cacode, blk, 0.25,
+               bench_code_freq, bench_samp_freq);
+}
+
+static void bench_code_si8(const gnss_kernels_t *k, bench_data_t *d,
+                           const int32_t blk) {
+  k->code_si8(d->si8_out[0], d->si8_out[1], d->si8_out[2], d->cacode, blk,
+              0.25, bench_code_freq, bench_samp_freq);
+}
+
+static void bench_code_state_si32(const gnss_kernels_t *k, bench_data_t *d,
+                                  const int32_t blk) {
+  gnss_code_nco_t nco;
+
+  gnss_code_nco_init(&nco, 0.25, bench_code_freq, bench_samp_freq);
+  k->code_state_si32(d->si32[0], d->si32[1], d->si32[2], d->cacode, blk, &nco);
+}
+
+static void bench_code_state_fl32(const gnss_kernels_t *k, bench_data_t *d,
+                                  const int32_t blk) {
+  gnss_code_nco_t nco;
+
+  gnss_code_nco_init(&nco, 0.25, bench_code_freq, bench_samp_freq);
+  k->code_state_fl32(d->fl32[0], d->fl32[1], d->fl32[2], d->cacode_fl32, blk,
+                     &nco);
+}
+
+static void bench_nco_rate_si32(const gnss_kernels_t *k, bench_data_t *d,
+                                const int32_t blk) {
+  gnss_nco_rate_t nco;
+
+  gnss_nco_rate_init(&nco, 0.3, bench_carr_freq, bench_carr_rate,
+                     bench_samp_freq);
+  k->nco_rate_si32(d->si32[0], d->sin_lut, blk, &nco);
+}
+
+static void bench_code_rate_si32(const gnss_kernels_t *k, bench_data_t *d,
+                                 const int32_t blk) {
+  gnss_code_nco_t nco;
+
+  gnss_code_nco_init(&nco, 0.25, bench_code_freq, bench_samp_freq);
+  k->code_rate_si32(d->si32[0], d->si32[1], d->si32[2], d->cacode, blk, &nco,
+                    gnss_code_nco_rate(bench_carr_rate / 1540.0,
+                                       bench_samp_freq));
+}
+
+// The window spans blk samples, E/P/L included
+static void bench_code_window_si32(const gnss_kernels_t *k, bench_data_t *d,
+                                   const int32_t blk) {
+  gnss_code_nco_t nco;
+
+  gnss_code_nco_init(&nco, 0.25, bench_code_freq, bench_samp_freq);
+  k->code_window_si32(d->si32[0], d->cacode, blk - 2 * BENCH_SPACING,
+                      BENCH_SPACING, &nco);
+}
+
+static void bench_code_window_fl32(const gnss_kernels_t *k, bench_data_t *d,
+                                   const int32_t blk) {
+  gnss_code_nco_t nco;
+
+  gnss_code_nco_init(&nco, 0.25, bench_code_freq, bench_samp_freq);
+  k->code_window_fl32(d->fl32[0], d->cacode_fl32, blk - 2 * BENCH_SPACING,
+                      BENCH_SPACING, &nco);
+}
+
+static void bench_mul_and_acc_si32(const gnss_kernels_t *k, bench_data_t *d,
+                                   const int32_t blk) {
+  bench_sink = k->mul_and_acc_si32(d->si32[0], d->si32[1], blk);
+}
+
+static void bench_mul_and_acc_fl32(const gnss_kernels_t *k, bench_data_t *d,
+                                   const int32_t blk) {
+  bench_sink = k->mul_and_acc_fl32(d->fl32[0], d->fl32[1], blk);
+}
+
+static void bench_mul_and_acc_si16(const gnss_kernels_t *k, bench_data_t *d,
+                                   const int32_t blk) {
+  bench_sink = k->mul_and_acc_si16(d->si16[1], d->si16[2], blk);
+}
+
+static void bench_mul_and_acc_si8(const gnss_kernels_t *k, bench_data_t *d,
+                                  const int32_t blk) {
+  bench_sink = k->mul_and_acc_si8(d->si8, d->si8 + BENCH_MAX_BLK, blk);
+}
+
+static void bench_correlate_epl_si32(const gnss_kernels_t *k, bench_data_t *d,
+                                     const int32_t blk) {
+  double *o = d->out;
+  k->correlate_epl_si32(&o[0], &o[1], &o[2], &o[3], &o[4], &o[5], d->si32[0],
+                        d->si32[1], d->si32[2], d->si32[3], d->si32[4], blk);
+}
+
+static void bench_correlate_epl_fl32(const gnss_kernels_t *k, bench_data_t *d,
+                                     const int32_t blk) {
+  double *o = d->out;
+  k->correlate_epl_fl32(&o[0], &o[1], &o[2], &o[3], &o[4], &o[5], d->fl32[0],
+                        d->fl32[1], d->fl32[2], d->fl32[3], d->fl32[4], blk);
+}
+
+static void bench_correlate_ntap_si32(const gnss_kernels_t *k,
+                                      bench_data_t *d, const int32_t blk) {
+  k->correlate_ntap_si32(d->out, d->out + BENCH_NUM_TAPS, d->si32[0],
+                         d->si32[1], d->cacode, d->tap_offsets, BENCH_NUM_TAPS,
+                         blk, 0.25, bench_code_freq, bench_samp_freq);
+}
+
+static void bench_correlate_ntap_fl32(const gnss_kernels_t *k,
+                                      bench_data_t *d, const int32_t blk) {
+  k->correlate_ntap_fl32(d->out, d->out + BENCH_NUM_TAPS, d->fl32[0],
+                         d->fl32[1], d->cacode_fl32, d->tap_offsets,
+                         BENCH_NUM_TAPS, blk, 0.25, bench_code_freq,
+                         bench_samp_freq);
+}
+
+static void bench_fused_epl_si32(const gnss_kernels_t *k, bench_data_t *d,
+                                 const int32_t blk) {
+  double *o = d->out;
+  k->fused_epl_si32(&o[0], &o[1], &o[2], &o[3], &o[4], &o[5], d->si8,
+                    d->sin_lut, d->cos_lut, d->cacode, blk, 0.3,
+                    bench_carr_freq, 0.25, bench_code_freq, bench_samp_freq);
+}
+
+static void bench_fused_epl_fl32(const gnss_kernels_t *k, bench_data_t *d,
+                                 const int32_t blk) {
+  double *o = d->out;
+  k->fused_epl_fl32(&o[0], &o[1], &o[2], &o[3], &o[4], &o[5], d->si8,
+                    d->sin_lut_fl32, d->cos_lut_fl32, d->cacode_fl32, blk, 0.3,
+                    bench_carr_freq, 0.25, bench_code_freq, bench_samp_freq);
+}
+
+static void bench_mix_iq8_si32(const gnss_kernels_t *k, bench_data_t *d,
+                               const int32_t blk) {
+  k->mix_iq8_si32(d->si32[0], d->si32[1], d->si8, d->si32[2], d->si32[3], blk);
+}
+
+static void bench_mix_iq16_si32(const gnss_kernels_t *k, bench_data_t *d,
+                                const int32_t blk) {
+  k->mix_iq16_si32(d->si32[0], d->si32[1], d->iq16, d->si32[2], d->si32[3],
+                   blk);
+}
+
+static void bench_fused_epl_iq8_si32(const gnss_kernels_t *k, bench_data_t *d,
+                                     const int32_t blk) {
+  double *o = d->out;
+  k->fused_epl_iq8_si32(&o[0], &o[1], &o[2], &o[3], &o[4], &o[5], d->si8,
+                        d->sin_lut, d->cos_lut, d->cacode, blk, 0.3,
+                        bench_carr_freq, 0.25, bench_code_freq,
+                        bench_samp_freq);
+}
+
+static void bench_unpack_2bit_si8(const gnss_kernels_t *k, bench_data_t *d,
+                                  const int32_t blk) {
+  k->unpack_2bit_si8(d->si8, d->packed, blk / 4);
+}
+
+static void bench_unpack_4bit_si8(const gnss_kernels_t *k, bench_data_t *d,
+                                  const int32_t blk) {
+  k->unpack_4bit_si8(d->si8, d->packed, blk / 2);
+}
+
+static void bench_pack_sign_si8(const gnss_kernels_t *k, bench_data_t *d,
+                                const int32_t blk) {
+  k->pack_sign_si8(d->bits[0], d->si8, blk);
+}
+
+static void bench_pack_sign_si32(const gnss_kernels_t *k, bench_data_t *d,
+                                 const int32_t blk) {
+  k->pack_sign_si32(d->bits[0], d->si32[0], blk);
+}
+
+static void bench_xor_and_acc_b1(const gnss_kernels_t *k, bench_data_t *d,
+                                 const int32_t blk) {
+  bench_sink = k->xor_and_acc_b1(d->bits[0], d->bits[1], blk);
+}
+
+// Kernels only available for a given instruction set
+
+static void bench_avx2_nom_nco_si32(const gnss_kernels_t *k, bench_data_t *d,
+                                    const int32_t blk) {
+  avx2_nom_nco_si32(d->si32[0], d->sin_lut, blk, 0.3, bench_carr_freq,
+                    bench_samp_freq);
+}
+
+static void bench_avx2_nom_code_si32(const gnss_kernels_t *k, bench_data_t *d,
+                                     const int32_t blk) {
+  avx2_nom_code_si32(d->si32[0], d->si32[1], d->si32[2], d->cacode, blk, 0.25,
+                     bench_code_freq, bench_samp_freq);
+}
+
+static void bench_avx2_nom_nco_fl32(const gnss_kernels_t *k, bench_data_t *d,
+                                    const int32_t blk) {
+  avx2_nom_nco_fl32(d->fl32[0], d->sin_lut_fl32, blk, 0.3, bench_carr_freq,
+                    bench_samp_freq);
+}
+
+static void bench_avx2_nom_code_fl32(const gnss_kernels_t *k, bench_data_t *d,
+                                     const int32_t blk) {
+  avx2_nom_code_fl32(d->fl32[0], d->fl32[1], d->fl32[2], d->cacode_fl32, blk,
+                     0.25, bench_code_freq, bench_samp_freq);
+}
+
+static void bench_avx2_si32_x2_mul_si32(const gnss_kernels_t *k,
+                                        bench_data_t *d, const int32_t blk) {
+  avx2_si32_x2_mul_si32(d->si32[0], d->si32[1], d->si32[2], blk);
+}
+
+static void bench_avx2_fl32_x2_mul_fl32(const gnss_kernels_t *k,
+                                        bench_data_t *d, const int32_t blk) {
+  avx2_fl32_x2_mul_fl32(d->fl32[0], d->fl32[1], d->fl32[2], blk);
+}
+
+static void bench_avx2_mul_short(const gnss_kernels_t *k, bench_data_t *d,
+                                 const int32_t blk) {
+  avx2_mul_short(d->si16[0], d->si16[1], d->si16[2], blk);
+}
+
+static void bench_avx2_mul_short_store_int(const gnss_kernels_t *k,
+                                           bench_data_t *d,
+                                           const int32_t blk) {
+  avx2_mul_short_store_int(d->si16[0], d->si16[1], d->si16[2], blk);
+}
+
+static void bench_avx2_mul_and_acc_short(const gnss_kernels_t *k,
+                                         bench_data_t *d, const int32_t blk) {
+  bench_sink = avx2_mul_and_acc_short(d->si16[1], d->si16[2], blk);
+}
+
+static void bench_avx2_mul_and_acc_si16(const gnss_kernels_t *k,
+                                        bench_data_t *d, const int32_t blk) {
+  bench_sink = avx2_mul_and_acc_si16(d->si16[1], d->si16[2], blk);
+}
+
+static void bench_avx2_mul_and_acc_si8(const gnss_kernels_t *k,
+                                       bench_data_t *d, const int32_t blk) {
+  bench_sink = avx2_mul_and_acc_si8(d->si8, d->si8 + BENCH_MAX_BLK, blk);
+}
+
+static void bench_avx2_mul_and_acc_si16_vnni(const gnss_kernels_t *k,
+                                             bench_data_t *d,
+                                             const int32_t blk) {
+  bench_sink = avx2_mul_and_acc_si16_vnni(d->si16[1], d->si16[2], blk);
+}
+
+static void bench_avx2_mul_and_acc_si8_vnni(const gnss_kernels_t *k,
+                                            bench_data_t *d,
+                                            const int32_t blk) {
+  bench_sink = avx2_mul_and_acc_si8_vnni(d->si8, d->si8 + BENCH_MAX_BLK, blk);
+}
+
+static void bench_avx_accumulate_short(const gnss_kernels_t *k,
+                                       bench_data_t *d, const int32_t blk) {
+  bench_sink = avx_accumulate_short(d->si16[1], blk);
+}
+
+static void bench_avx_accumulate_short_unsat(const gnss_kernels_t *k,
+                                             bench_data_t *d,
+                                             const int32_t blk) {
+  bench_sink = avx_accumulate_short_unsat(d->si16[1], blk);
+}
+
+static void bench_avx_accumulate_int(const gnss_kernels_t *k, bench_data_t *d,
+                                     const int32_t blk) {
+  bench_sink = avx_accumulate_int(d->si32[1], blk);
+}
+
+static void bench_avx512_mul_and_acc_si16(const gnss_kernels_t *k,
+                                          bench_data_t *d, const int32_t blk) {
+  bench_sink = avx512_mul_and_acc_si16(d->si16[1], d->si16[2], blk);
+}
+
+static void bench_avx512_mul_and_acc_si8(const gnss_kernels_t *k,
+                                         bench_data_t *d, const int32_t blk) {
+  bench_sink = avx512_mul_and_acc_si8(d->si8, d->si8 + BENCH_MAX_BLK, blk);
+}
+
+static void bench_avx512_mul_and_acc_si16_vnni(const gnss_kernels_t *k,
+                                               bench_data_t *d,
+                                               const int32_t blk) {
+  bench_sink = avx512_mul_and_acc_si16_vnni(d->si16[1], d->si16[2], blk);
+}
+
+static void bench_avx512_mul_and_acc_si8_vnni(const gnss_kernels_t *k,
+                                              bench_data_t *d,
+                                              const int32_t blk) {
+  bench_sink =
+      avx512_mul_and_acc_si8_vnni(d->si8, d->si8 + BENCH_MAX_BLK, blk);
+}
+
+static void bench_avx512_xor_and_acc_b1_vpopcnt(const gnss_kernels_t *k,
+                                                bench_data_t *d,
+                                                const int32_t blk) {
+  bench_sink = avx512_xor_and_acc_b1_vpopcnt(d->bits[0], d->bits[1], blk);
+}
+
+static void bench_avx512_nom_nco_si32(const gnss_kernels_t *k,
+                                      bench_data_t *d, const int32_t blk) {
+  avx512_nom_nco_si32(d->si32[0], d->sin_lut, blk, 0.3, bench_carr_freq,
+                      bench_samp_freq);
+}
+
+static void bench_avx512_nom_code_si32(const gnss_kernels_t *k,
+                                       bench_data_t *d, const int32_t blk) {
+  avx512_nom_code_si32(d->si32[0], d->si32[1], d->si32[2], d->cacode, blk,
+                       0.25, bench_code_freq, bench_samp_freq);
+}
+
+static void bench_avx512_nom_nco_fl32(const gnss_kernels_t *k,
+                                      bench_data_t *d, const int32_t blk) {
+  avx512_nom_nco_fl32(d->fl32[0], d->sin_lut_fl32, blk, 0.3, bench_carr_freq,
+                      bench_samp_freq);
+}
+
+static void bench_avx512_nom_code_fl32(const gnss_kernels_t *k,
+                                       bench_data_t *d, const int32_t blk) {
+  avx512_nom_code_fl32(d->fl32[0], d->fl32[1], d->fl32[2], d->cacode_fl32,
+                       blk, 0.25, bench_code_freq, bench_samp_freq);
+}
+
+static void bench_avx512_fl32_x2_mul_si32(const gnss_kernels_t *k,
+                                          bench_data_t *d, const int32_t blk) {
+  avx512_fl32_x2_mul_si32(d->si32[0], d->si32[1], d->si32[2], blk);
+}
+
+static void bench_avx512_fl32_x2_mul_fl32(const gnss_kernels_t *k,
+                                          bench_data_t *d, const int32_t blk) {
+  avx512_fl32_x2_mul_fl32(d->fl32[0], d->fl32[1], d->fl32[2], blk);
+}
+
+static void bench_avx512_mul_and_acc_16i(const gnss_kernels_t *k,
+                                         bench_data_t *d, const int32_t blk) {
+  bench_sink = avx512_mul_and_acc_16i(d->si16[1], d->si16[2], blk);
+}
+
+static void bench_mmx_mul_and_acc_short(const gnss_kernels_t *k,
+                                        bench_data_t *d, const int32_t blk) {
+  bench_sink = mmx_mul_and_acc_short(d->si16[1], d->si16[2], blk);
+}
+
+//! Every kernel under test with the bytes it moves per sample
+static const bench_kernel_t bench_kernels[] = {
+    {"nco_si32", "si32", -1, 4, bench_nco_si32},
+    {"nco_fl32", "fl32", -1, 4, bench_nco_fl32},
+    {"nco_rot_fl32", "fl32", -1, 4, bench_nco_rot_fl32},
+    {"nco_state_si32", "si32", -1, 4, bench_nco_state_si32},
+    {"nco_state_fl32", "fl32", -1, 4, bench_nco_state_fl32},
+    {"nco_iq_si32", "si32", -1, 8, bench_nco_iq_si32},
+    {"nco_iq_fl32", "fl32", -1, 8, bench_nco_iq_fl32},
+    {"nco_perm_si32", "si32", -1, 4, bench_nco_perm_si32},
+    {"nco_perm_fl32", "fl32", -1, 4, bench_nco_perm_fl32},
+    {"nco_poly_fl32", "fl32", -1, 8, bench_nco_poly_fl32},
+    {"code_si32", "si32", -1, 12, bench_code_si32},
+    {"code_fl32", "fl32", -1, 12, bench_code_fl32},
+    {"nco_si16", "si16", -1, 2, bench_nco_si16},
+    {"nco_si8", "si8", -1, 1, bench_nco_si8},
+    {"code_si16", "si16", -1, 6, bench_code_si16},
+    {"code_si8", "si8", -1, 3, bench_code_si8},
+    {"code_state_si32", "si32", -1, 12, bench_code_state_si32},
+    {"code_state_fl32", "fl32", -1, 12, bench_code_state_fl32},
+    {"nco_rate_si32", "si32", -1, 4, bench_nco_rate_si32},
+    {"code_rate_si32", "si32", -1, 12, bench_code_rate_si32},
+    {"code_window_si32", "si32", -1, 4, bench_code_window_si32},
+    {"code_window_fl32", "fl32", -1, 4, bench_code_window_fl32},
+    {"mul_and_acc_si32", "si32", -1, 8, bench_mul_and_acc_si32},
+    {"mul_and_acc_fl32", "fl32", -1, 8, bench_mul_and_acc_fl32},
+    {"mul_and_acc_si16", "si16", -1, 4, bench_mul_and_acc_si16},
+    {"mul_and_acc_si8", "si8", -1, 2, bench_mul_and_acc_si8},
+    {"correlate_epl_si32", "si32", -1, 20, bench_correlate_epl_si32},
+    {"correlate_epl_fl32", "fl32", -1, 20, bench_correlate_epl_fl32},
+    {"correlate_ntap_si32", "si32", -1, 8, bench_correlate_ntap_si32},
+    {"correlate_ntap_fl32", "fl32", -1, 8, bench_correlate_ntap_fl32},
+    {"fused_epl_si32", "si8", -1, 1, bench_fused_epl_si32},
+    {"fused_epl_fl32", "si8", -1, 1, bench_fused_epl_fl32},
+    {"mix_iq8_si32", "iq8", -1, 18, bench_mix_iq8_si32},
+    {"mix_iq16_si32", "iq16", -1, 20, bench_mix_iq16_si32},
+    {"fused_epl_iq8_si32", "iq8", -1, 2, bench_fused_epl_iq8_si32},
+    {"unpack_2bit_si8", "si2", -1, 1.25, bench_unpack_2bit_si8},
+    {"unpack_4bit_si8", "si4", -1, 1.5, bench_unpack_4bit_si8},
+    {"pack_sign_si8", "si8", -1, 1.125, bench_pack_sign_si8},
+    {"pack_sign_si32", "si32", -1, 4.125, bench_pack_sign_si32},
+    {"xor_and_acc_b1", "b1", -1, 0.25, bench_xor_and_acc_b1},
+    {"avx2_nom_nco_si32", "si32", GNSS_ISA_AVX2, 4, bench_avx2_nom_nco_si32},
+    {"avx2_nom_code_si32", "si32", GNSS_ISA_AVX2, 12,
+     bench_avx2_nom_code_si32},
+    {"avx2_nom_nco_fl32", "fl32", GNSS_ISA_AVX2, 4, bench_avx2_nom_nco_fl32},
+    {"avx2_nom_code_fl32", "fl32", GNSS_ISA_AVX2, 12,
+     bench_avx2_nom_code_fl32},
+    {"avx2_si32_x2_mul_si32", "si32", GNSS_ISA_AVX2, 12,
+     bench_avx2_si32_x2_mul_si32},
+    {"avx2_fl32_x2_mul_fl32", "fl32", GNSS_ISA_AVX2, 12,
+     bench_avx2_fl32_x2_mul_fl32},
+    {"avx2_mul_short", "si16", GNSS_ISA_AVX2, 6, bench_avx2_mul_short},
+    {"avx2_mul_short_store_int", "si16", GNSS_ISA_AVX2, 6,
+     bench_avx2_mul_short_store_int},
+    {"avx2_mul_and_acc_short", "si16", GNSS_ISA_AVX2, 4,
+     bench_avx2_mul_and_acc_short},
+    {"avx2_mul_and_acc_si16", "si16", GNSS_ISA_AVX2, 4,
+     bench_avx2_mul_and_acc_si16},
+    {"avx2_mul_and_acc_si8", "si8", GNSS_ISA_AVX2, 2,
+     bench_avx2_mul_and_acc_si8},
+    {"avx2_mul_and_acc_si16_vnni", "si16", GNSS_ISA_AVX2, 4,
+     bench_avx2_mul_and_acc_si16_vnni, GNSS_EXT_AVXVNNI},
+    {"avx2_mul_and_acc_si8_vnni", "si8", GNSS_ISA_AVX2, 2,
+     bench_avx2_mul_and_acc_si8_vnni, GNSS_EXT_AVXVNNI},
+    {"avx_accumulate_short", "si16", GNSS_ISA_AVX2, 2,
+     bench_avx_accumulate_short},
+    {"avx_accumulate_short_unsat", "si16", GNSS_ISA_AVX2, 2,
+     bench_avx_accumulate_short_unsat},
+    {"avx_accumulate_int", "si32", GNSS_ISA_AVX2, 4, bench_avx_accumulate_int},
+    {"avx512_xor_and_acc_b1_vpopcnt", "b1", GNSS_ISA_AVX512, 0.25,
+     bench_avx512_xor_and_acc_b1_vpopcnt, GNSS_EXT_VPOPCNTDQ},
+    {"avx512_mul_and_acc_si16", "si16", GNSS_ISA_AVX512, 4,
+     bench_avx512_mul_and_acc_si16},
+    {"avx512_mul_and_acc_si8", "si8", GNSS_ISA_AVX512, 2,
+     bench_avx512_mul_and_acc_si8},
+    {"avx512_mul_and_acc_si16_vnni", "si16", GNSS_ISA_AVX512, 4,
+     bench_avx512_mul_and_acc_si16_vnni, GNSS_EXT_AVX512VNNI},
+    {"avx512_mul_and_acc_si8_vnni", "si8", GNSS_ISA_AVX512, 2,
+     bench_avx512_mul_and_acc_si8_vnni, GNSS_EXT_AVX512VNNI},
+    {"avx512_nom_nco_si32", "si32", GNSS_ISA_AVX512, 4,
+     bench_avx512_nom_nco_si32},
+    {"avx512_nom_code_si32", "si32", GNSS_ISA_AVX512, 12,
+     bench_avx512_nom_code_si32},
+    {"avx512_nom_nco_fl32", "fl32", GNSS_ISA_AVX512, 4,
+     bench_avx512_nom_nco_fl32},
+    {"avx512_nom_code_fl32", "fl32", GNSS_ISA_AVX512, 12,
+     bench_avx512_nom_code_fl32},
+    {"avx512_fl32_x2_mul_si32", "si32", GNSS_ISA_AVX512, 12,
+     bench_avx512_fl32_x2_mul_si32},
+    {"avx512_fl32_x2_mul_fl32", "fl32", GNSS_ISA_AVX512, 12,
+     bench_avx512_fl32_x2_mul_fl32},
+    {"avx512_mul_and_acc_16i", "si16", GNSS_ISA_AVX512, 4,
+     bench_avx512_mul_and_acc_16i},
+    {"mmx_mul_and_acc_short", "si16", GNSS_ISA_NOM, 4,
+     bench_mmx_mul_and_acc_short},
+};
+
+/*!
+ *  \brief Fills the shared buffers with random samples in the range of the
+ * recorded data
+ *  \param[out] d Benchmark data
+ *  \return EXIT_SUCCESS, or EXIT_FAILURE if the buffers cannot be allocated
+ */
+static int bench_data_init(bench_data_t *d) {
+
+  int32_t *cacode;
+  float *cacode_fl32;
+
+  *d = (bench_data_t){0};
+  d->si8 = aligned_alloc(64, 2 * BENCH_MAX_BLK);
+  d->packed = aligned_alloc(64, BENCH_MAX_BLK);
+  d->iq16 = aligned_alloc(64, 2 * BENCH_MAX_BLK * sizeof(int16_t));
+  d->bits[0] = aligned_alloc(64, BENCH_MAX_BLK / 8);
+  d->bits[1] = aligned_alloc(64, BENCH_MAX_BLK / 8);
+  cacode = aligned_alloc(64, (BENCH_CODE_LEN + 2) * sizeof(int32_t));
+  cacode_fl32 = aligned_alloc(64, (BENCH_CODE_LEN + 2) * sizeof(float));
+  if (!d->si8 || !d->packed || !d->iq16 || !d->bits[0] || !d->bits[1] ||
+      !cacode || !cacode_fl32) {
+    return EXIT_FAILURE;
+  }
+  for (int v = 0; v < 3; v++) {
+    d->si16[v] = aligned_alloc(64, BENCH_MAX_BLK * sizeof(int16_t));
+    d->si8_out[v] = aligned_alloc(64, BENCH_MAX_BLK);
+    if (!d->si16[v] || !d->si8_out[v]) {
+      return EXIT_FAILURE;
+    }
+  }
+  for (int v = 0; v < 5; v++) {
+    d->si32[v] = aligned_alloc(64, BENCH_MAX_BLK * sizeof(int32_t));
+    d->fl32[v] = aligned_alloc(64, BENCH_MAX_BLK * sizeof(float));
+    if (!d->si32[v] || !d->fl32[v]) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  srand(1);
+  for (int i = 0; i < 2 * BENCH_MAX_BLK; i++) {
+    d->si8[i] = rand() % 7 - 3;
+    d->iq16[i] = rand() % 7 - 3;
+  }
+  for (int i = 0; i < BENCH_MAX_BLK; i++) {
+    d->packed[i] = rand();
+    for (int v = 0; v < 3; v++) {
+      d->si16[v][i] = rand() % 21 - 10;
+    }
+    for (int v = 0; v < 5; v++) {
+      d->si32[v][i] = rand() % 21 - 10;
+      d->fl32[v][i] = d->si32[v][i];
+    }
+  }
+  nom_pack_sign_si8(d->bits[0], d->si8, BENCH_MAX_BLK);
+  nom_pack_sign_si8(d->bits[1], d->si8 + BENCH_MAX_BLK, BENCH_MAX_BLK);
+  d->sin_lut = gnss_sin_lut_si32;
+  d->cos_lut = gnss_cos_lut_si32;
+  d->sin_lut_fl32 = gnss_sin_lut_fl32;
+  d->cos_lut_fl32 = gnss_cos_lut_fl32;
+  d->sincos_lut = gnss_sincos_lut_si32;
+  d->sincos_lut_fl32 = gnss_sincos_lut_fl32;
+  for (int i = 0; i < (1 << BENCH_LUT_BITS); i++) {
+    d->sin_lut_small[i] =
+        d->sin_lut[(i * GNSS_NCO_LUT_SIZE) >> BENCH_LUT_BITS];
+    d->sin_lut_small_fl32[i] = d->sin_lut_small[i];
+  }
+
+  // Code long enough for the largest block, padded by a chip on each side
+  for (int i = 0; i < BENCH_CODE_LEN + 2; i++) {
+    cacode[i] = (rand() & 1) ? 1 : -1;
+    cacode_fl32[i] = cacode[i];
+  }
+  d->cacode = cacode + 1;
+  d->cacode_fl32 = cacode_fl32 + 1;
+  for (int t = 0; t < BENCH_NUM_TAPS; t++) {
+    d->tap_offsets[t] = -0.5f + 0.25f * t;
+  }
+  return EXIT_SUCCESS;
+}
+
+/*!
+ *  \brief Releases the shared buffers
+ *  \param[in,out] d Benchmark data
+ */
+static void bench_data_free(bench_data_t *d) {
+
+  free(d->si8);
+  free(d->packed);
+  free(d->iq16);
+  free(d->bits[0]);
+  free(d->bits[1]);
+  free(d->cacode - 1);
+  free(d->cacode_fl32 - 1);
+  for (int v = 0; v < 3; v++) {
+    free(d->si16[v]);
+    free(d->si8_out[v]);
+  }
+  for (int v = 0; v < 5; v++) {
+    free(d->si32[v]);
+    free(d->fl32[v]);
+  }
+}
+
+/*!
+ *  \brief Monotonic wall clock time
+ *  \return Time in seconds
+ */
+static inline double bench_now(void) {
+
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/*!
+ *  \brief Reads the time stamp counter
+ *  \return TSC reference cycles
+ */
+static inline uint64_t bench_rdtsc(void) {
+
+  uint32_t lo, hi;
+  __asm__ volatile("rdtsc" : "=a"(lo), "=d"(hi));
+  return ((uint64_t)hi << 32) | lo;
+}
+
+/*!
+ *  \brief Names a measurement after the kernel and the block size
+ *  \param[out] name Buffer of 96 characters
+ *  \param[in] bk Kernel under test
+ *  \param[in] k Kernel table the kernel is bound from
+ *  \param[in] blk Samples per call
+ */
+static void bench_name(char *name, const bench_kernel_t *bk,
+                       const gnss_kernels_t *k, const int32_t blk) {
+
+  if (bk->isa < 0) {
+    snprintf(name, 96, "%s_%s/%d", k->name, bk->name, blk);
+  } else {
+    snprintf(name, 96, "%s/%d", bk->name, blk);
+  }
+}
+
+/*!
+ *  \brief Times a kernel for a block size
+ *  \details The number of iterations is doubled until a run lasts at least
+ * min_time, like Google Benchmark does, after a warm-up call that brings the
+ * buffers into cache.
+ *  \param[in] bk Kernel under test
+ *  \param[in] k Kernel table the kernel is bound from
+ *  \param[in] d Benchmark data
+ *  \param[in] blk Samples per call
+ *  \param[in] min_time Minimum duration of the timed run in seconds
+ *  \param[in,out] r Measurement, already named by bench_name()
+ */
+static void bench_run(const bench_kernel_t *bk, const gnss_kernels_t *k,
+                      bench_data_t *d, const int32_t blk,
+                      const double min_time, bench_result_t *r) {
+
+  long iters = 1;
+  double t0, elapsed;
+  uint64_t c0, cycles;
+
+  bk->run(k, d, blk);
+  for (;;) {
+    t0 = bench_now();
+    c0 = bench_rdtsc();
+    for (long i = 0; i < iters; i++) {
+      bk->run(k, d, blk);
+    }
+    cycles = bench_rdtsc() - c0;
+    elapsed = bench_now() - t0;
+    if (elapsed >= min_time || iters >= (1L << 40)) {
+      break;
+    }
+    iters *= 2;
+  }
+
+  r->isa = k->name;
+  r->type = bk->type;
+  r->blk_size = blk;
+  r->iterations = iters;
+  r->real_time_ns = 1e9 * elapsed / iters;
+  r->samples_per_second = (double)blk * iters / elapsed;
+  r->cycles_per_sample = (double)cycles / ((double)blk * iters);
+  r->bytes_per_second = bk->bytes_per_sample * r->samples_per_second;
+}
+
+/*!
+ *  \brief Writes the measurements as JSON, laid out like Google Benchmark
+ *  \param[in] file_name Path of the JSON file
+ *  \param[in] results Measurements
+ *  \param[in] num_results Number of measurements
+ *  \param[in] min_time Minimum duration of each timed run in seconds
+ *  \return EXIT_SUCCESS, or EXIT_FAILURE if the file cannot be written
+ */
+static int bench_write_json(const char *file_name,
+                            const bench_result_t *results,
+                            const int num_results, const double min_time) {
+
+  char host[256] = "unknown";
+  char date[64];
+  time_t now = time(NULL);
+  FILE *fp = fopen(file_name, "w");
+
+  if (fp == NULL) {
+    perror("Error opening JSON output");
+    return EXIT_FAILURE;
+  }
+  gethostname(host, sizeof(host) - 1);
+  strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+  fprintf(fp, "{\n  \"context\": {\n");
+  fprintf(fp, "    \"date\": \"%s\",\n", date);
+  fprintf(fp, "    \"host_name\": \"%s\",\n", host);
+  fprintf(fp, "    \"cpu_isa\": \"%s\",\n", gnss_dispatch_init()->name);
+  fprintf(fp, "    \"min_time\": %g\n  },\n", min_time);
+  fprintf(fp, "  \"benchmarks\": [\n");
+  for (int i = 0; i < num_results; i++) {
+    const bench_result_t *r = &results[i];
+    fprintf(fp, "    {\n");
+    fprintf(fp, "      \"name\": \"%s\",\n", r->name);
+    fprintf(fp, "      \"isa\": \"%s\",\n", r->isa);
+    fprintf(fp, "      \"type\": \"%s\",\n", r->type);
+    fprintf(fp, "      \"blk_size\": %d,\n", r->blk_size);
+    fprintf(fp, "      \"iterations\": %ld,\n", r->iterations);
+    fprintf(fp, "      \"real_time\": %.3f,\n", r->real_time_ns);
+    fprintf(fp, "      \"time_unit\": \"ns\",\n");
+    fprintf(fp, "      \"samples_per_second\": %.6e,\n", r->samples_per_second);
+    fprintf(fp, "      \"cycles_per_sample\": %.4f,\n", r->cycles_per_sample);
+    fprintf(fp, "      \"bytes_per_second\": %.6e\n", r->bytes_per_second);
+    fprintf(fp, "    }%s\n", (i + 1 < num_results) ? "," : "");
+  }
+  fprintf(fp, "  ]\n}\n");
+  fclose(fp);
+  return EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[]) {
+
+  const char *json_file = "bench_kernels.json";
+  const char *filter = NULL;
+  double min_time = 0.05;
+  bench_result_t *results;
+  int num_results = 0, max_results, dropped = 0;
+  const gnss_kernels_t *tables[3] = {&gnss_kernels_nom, &gnss_kernels_avx2,
+                                     &gnss_kernels_avx512};
+  const gnss_isa_t cpu_isa = gnss_cpu_isa();
+  const uint32_t cpu_ext = gnss_cpu_ext();
+  const int num_kernels = sizeof(bench_kernels) / sizeof(bench_kernels[0]);
+  const int num_blk = sizeof(bench_blk_sizes) / sizeof(bench_blk_sizes[0]);
+  bench_data_t data;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "o:f:t:h")) != -1) {
+    switch (opt) {
+    case 'o':
+      json_file = optarg;
+      break;
+    case 'f':
+      filter = optarg;
+      break;
+    case 't':
+      min_time = atof(optarg);
+      break;
+    default:
+      printf("Usage: %s [-o file.json] [-f name_filter] [-t min_time_s]\n",
+             argv[0]);
+      return (opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  }
+
+  // Every kernel may run once per instruction set and block size
+  max_results = num_kernels * 3 * num_blk;
+  results = calloc(max_results, sizeof(bench_result_t));
+  if (results == NULL || bench_data_init(&data) != EXIT_SUCCESS) {
+    perror("Error allocating benchmark data");
+    return EXIT_FAILURE;
+  }
+
+  printf("\n*** Running: bench_kernels (CPU supports %s) ***\n",
+         tables[cpu_isa]->name);
+  printf("%-40s %8s %12s %12s %10s %9s\n", "Benchmark", "Type", "Time (ns)",
+         "Samples/s", "Cyc/sample", "GB/s");
+
+  for (int b = 0; b < num_kernels; b++) {
+    const bench_kernel_t *bk = &bench_kernels[b];
+    for (int isa = GNSS_ISA_NOM; isa <= GNSS_ISA_AVX512; isa++) {
+      if ((bk->isa >= 0 && bk->isa != isa) || isa > cpu_isa) {
+        continue;
+      }
+      if ((bk->ext & cpu_ext) != bk->ext) {
+        continue;
+      }
+      for (int s = 0; s < num_blk; s++) {
+        if (num_results == max_results) {
+          dropped++;
+          continue;
+        }
+        bench_result_t *r = &results[num_results];
+        bench_name(r->name, bk, tables[isa], bench_blk_sizes[s]);
+        if (filter != NULL && strstr(r->name, filter) == NULL) {
+          continue;
+        }
+        bench_run(bk, tables[isa], &data, bench_blk_sizes[s], min_time, r);
+        printf("%-40s %8s %12.1f %12.4e %10.3f %9.3f\n", r->name, r->type,
+               r->real_time_ns, r->samples_per_second, r->cycles_per_sample,
+               1e-9 * r->bytes_per_second);
+        num_results++;
+      }
+    }
+  }
+
+  bench_data_free(&data);
+  if (dropped > 0) {
+    printf("Warning: %d measurements dropped, only %d are kept\n", dropped,
+           max_results);
+  }
+  if (bench_write_json(json_file, results, num_results, min_time) !=
+      EXIT_SUCCESS) {
+    free(results);
+    return EXIT_FAILURE;
+  }
+  free(results);
+  printf("  [Results written to '%s']\n", json_file);
+  return EXIT_SUCCESS;
+}
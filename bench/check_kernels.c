@@ -0,0 +1,248 @@
+/*!
+ *  \file check_kernels.c
+ *  \brief      Checks the SIMD kernel tables against the portable one.
+ *  \details    gnss_dispatch_init() binds whichever table the CPU supports,
+ so the AVX2 and AVX512 kernels have to give the same samples as the
+ nom_intrinsics.h ones. The NCOs and code generators are run with random
+ phases and frequencies over every block size up to a few SIMD widths and a
+ few odd sizes around a code period, where the vector loops hand over to their
+ scalar tails, and the first differing sample is reported. Tables the CPU does
+ not support are skipped.
+ *  \author    Damian Miralles
+ *  \author    Jake Johnson
+ *  \date      Jan 23, 2018
+ *  \code{.sh}
+# Sample compilation script
+$ gcc -I ../src/ ../bench/check_kernels.c -g -pthread -lm -o check_kernels -O3
+
+# Exits with EXIT_FAILURE on the first mismatching kernel
+$ ./check_kernels
+ *  \endcode
+ */
+
+#include "carrier_lut.h"
+#include "dispatch_intrinsics.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CHECK_MAX_SMALL 40     //!< Every block size up to this one is checked
+#define CHECK_MAX_BLK 16371    //!< Largest block size checked
+#define CHECK_CODE_LEN 1100    //!< Chips in the synthetic ranging code
+#define CHECK_TRIALS 4         //!< Random phases and frequencies per size
+#define CHECK_SAMP_FREQ 16367600.0 //!< Sampling frequency of the test data
+
+//! Odd block sizes around a code period of the test data
+static const int32_t check_blk_sizes[] = {1023, 16367, 16369, CHECK_MAX_BLK};
+
+/*!
+ *  \brief Output buffers of the reference and of the checked table
+ */
+typedef struct {
+  int32_t *si32[3]; /*!< si32 replicas */
+  float *fl32[3];   /*!< fl32 replicas */
+  int16_t *si16[3]; /*!< si16 replicas */
+  int8_t *si8[3];   /*!< si8 replicas */
+} check_out_t;
+
+/*!
+ *  \brief Allocates the output buffers
+ *  \param[out] o Output buffers
+ *  \return EXIT_SUCCESS, or EXIT_FAILURE if out of memory
+ */
+static int check_out_init(check_out_t *o) {
+
+  for (int v = 0; v < 3; v++) {
+    o->si32[v] = malloc(CHECK_MAX_BLK * sizeof(int32_t));
+    o->fl32[v] = malloc(CHECK_MAX_BLK * sizeof(float));
+    o->si16[v] = malloc(CHECK_MAX_BLK * sizeof(int16_t));
+    o->si8[v] = malloc(CHECK_MAX_BLK * sizeof(int8_t));
+    if (!o->si32[v] || !o->fl32[v] || !o->si16[v] || !o->si8[v]) {
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
+
+/*!
+ *  \brief Releases the output buffers
+ *  \param[in,out] o Output buffers
+ */
+static void check_out_free(check_out_t *o) {
+
+  for (int v = 0; v < 3; v++) {
+    free(o->si32[v]);
+    free(o->fl32[v]);
+    free(o->si16[v]);
+    free(o->si8[v]);
+  }
+}
+
+/*!
+ *  \brief Finds the first sample that differs between two replicas
+ *  \param[in] a Reference samples
+ *  \param[in] b Checked samples
+ *  \param[in] size Bytes per sample
+ *  \param[in] blk Samples per replica
+ *  \return Index of the first differing sample, -1 if they all match
+ */
+static int32_t check_first_diff(const void *a, const void *b, size_t size,
+                                const int32_t blk) {
+
+  for (int32_t i = 0; i < blk; i++) {
+    if (memcmp((const char *)a + i * size, (const char *)b + i * size, size)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/*!
+ *  \brief Compares the Early, Prompt and Late replicas of a kernel
+ *  \param[in] name Kernel name
+ *  \param[in] k Checked kernel table
+ *  \param[in] ref Reference replicas
+ *  \param[in] out Checked replicas
+ *  \param[in] num_vec Number of replicas produced by the kernel
+ *  \param[in] size Bytes per sample
+ *  \param[in] blk Samples per replica
+ *  \return Number of mismatching replicas
+ */
+static int check_compare(const char *name, const gnss_kernels_t *k,
+                         void *const *ref, void *const *out, const int num_vec,
+                         size_t size, const int32_t blk) {
+
+  int failed = 0;
+  int32_t i;
+
+  for (int v = 0; v < num_vec; v++) {
+    if ((i = check_first_diff(ref[v], out[v], size, blk)) >= 0) {
+      printf("%s_%s[%d] differs from nom at sample %d of %d\n", k->name, name,
+             v, i, blk);
+      failed++;
+    }
+  }
+  return failed;
+}
+
+/*!
+ *  \brief Checks the NCOs and code generators of a table for a block size
+ *  \param[in] k Checked kernel table
+ *  \param[in] cacode si32 ranging code
+ *  \param[in] cacode_fl32 fl32 ranging code
+ *  \param[in,out] ref Reference output buffers
+ *  \param[in,out] out Checked output buffers
+ *  \param[in] blk Samples per call
+ *  \return Number of mismatching replicas
+ */
+static int check_blk(const gnss_kernels_t *k, const int32_t *cacode,
+                     const float *cacode_fl32, check_out_t *ref,
+                     check_out_t *out, const int32_t blk) {
+
+  const gnss_kernels_t *n = &gnss_kernels_nom;
+  const double fs = CHECK_SAMP_FREQ;
+  int failed = 0;
+
+  for (int t = 0; t < CHECK_TRIALS; t++) {
+    double rem_carr = 2.0 * M_PI * rand() / RAND_MAX;
+    double carr_freq = 4130400.0 + 10000.0 * (rand() / (double)RAND_MAX - 0.5);
+    float rem_code = (float)rand() / RAND_MAX;
+    float code_freq = 1023000.0f + 100.0f * ((float)rand() / RAND_MAX - 0.5f);
+
+    n->nco_si32(ref->si32[0], gnss_sin_lut_si32, blk, rem_carr, carr_freq, fs);
+    k->nco_si32(out->si32[0], gnss_sin_lut_si32, blk, rem_carr, carr_freq, fs);
+    failed += check_compare("nco_si32", k, (void *const *)ref->si32,
+                            (void *const *)out->si32, 1, 4, blk);
+
+    n->nco_fl32(ref->fl32[0], gnss_sin_lut_fl32, blk, rem_carr, carr_freq, fs);
+    k->nco_fl32(out->fl32[0], gnss_sin_lut_fl32, blk, rem_carr, carr_freq, fs);
+    failed += check_compare("nco_fl32", k, (void *const *)ref->fl32,
+                            (void *const *)out->fl32, 1, 4, blk);
+
+    n->nco_si16(ref->si16[0], gnss_sin_lut_si32, blk, rem_carr, carr_freq, fs);
+    k->nco_si16(out->si16[0], gnss_sin_lut_si32, blk, rem_carr, carr_freq, fs);
+    failed += check_compare("nco_si16", k, (void *const *)ref->si16,
+                            (void *const *)out->si16, 1, 2, blk);
+
+    n->nco_si8(ref->si8[0], gnss_sin_lut_si32, blk, rem_carr, carr_freq, fs);
+    k->nco_si8(out->si8[0], gnss_sin_lut_si32, blk, rem_carr, carr_freq, fs);
+    failed += check_compare("nco_si8", k, (void *const *)ref->si8,
+                            (void *const *)out->si8, 1, 1, blk);
+
+    n->code_si32(ref->si32[0], ref->si32[1], ref->si32[2], cacode, blk,
+                 rem_code, code_freq, fs);
+    k->code_si32(out->si32[0], out->si32[1], out->si32[2], cacode, blk,
+                 rem_code, code_freq, fs);
+    failed += check_compare("code_si32", k, (void *const *)ref->si32,
+                            (void *const *)out->si32, 3, 4, blk);
+
+    n->code_fl32(ref->fl32[0], ref->fl32[1], ref->fl32[2], cacode_fl32, blk,
+                 rem_code, code_freq, fs);
+    k->code_fl32(out->fl32[0], out->fl32[1], out->fl32[2], cacode_fl32, blk,
+                 rem_code, code_freq, fs);
+    failed += check_compare("code_fl32", k, (void *const *)ref->fl32,
+                            (void *const *)out->fl32, 3, 4, blk);
+
+    n->code_si16(ref->si16[0], ref->si16[1], ref->si16[2], cacode, blk,
+                 rem_code, code_freq, fs);
+    k->code_si16(out->si16[0], out->si16[1], out->si16[2], cacode, blk,
+                 rem_code, code_freq, fs);
+    failed += check_compare("code_si16", k, (void *const *)ref->si16,
+                            (void *const *)out->si16, 3, 2, blk);
+
+    n->code_si8(ref->si8[0], ref->si8[1], ref->si8[2], cacode, blk, rem_code,
+                code_freq, fs);
+    k->code_si8(out->si8[0], out->si8[1], out->si8[2], cacode, blk, rem_code,
+                code_freq, fs);
+    failed += check_compare("code_si8", k, (void *const *)ref->si8,
+                            (void *const *)out->si8, 3, 1, blk);
+  }
+  return failed;
+}
+
+int main(void) {
+
+  const gnss_kernels_t *tables[3] = {&gnss_kernels_nom, &gnss_kernels_avx2,
+                                     &gnss_kernels_avx512};
+  const gnss_isa_t cpu_isa = gnss_cpu_isa();
+  const int num_blk = sizeof(check_blk_sizes) / sizeof(check_blk_sizes[0]);
+  static int32_t cacode[CHECK_CODE_LEN];
+  static float cacode_fl32[CHECK_CODE_LEN];
+  check_out_t ref, out;
+  int failed = 0;
+
+  if (check_out_init(&ref) != EXIT_SUCCESS ||
+      check_out_init(&out) != EXIT_SUCCESS) {
+    perror("Error allocating check buffers");
+    return EXIT_FAILURE;
+  }
+
+  srand(1);
+  for (int i = 0; i < CHECK_CODE_LEN; i++) {
+    cacode[i] = (rand() & 1) ? 1 : -1;
+    cacode_fl32[i] = cacode[i];
+  }
+
+  printf("\n*** Running: check_kernels (CPU supports %s) ***\n",
+         tables[cpu_isa]->name);
+  for (int isa = GNSS_ISA_AVX2; isa <= cpu_isa; isa++) {
+    int table_failed = 0;
+    for (int32_t blk = 1; blk <= CHECK_MAX_SMALL; blk++) {
+      table_failed +=
+          check_blk(tables[isa], cacode, cacode_fl32, &ref, &out, blk);
+    }
+    for (int s = 0; s < num_blk; s++) {
+      table_failed += check_blk(tables[isa], cacode, cacode_fl32, &ref, &out,
+                                check_blk_sizes[s]);
+    }
+    printf("  [%s: %s]\n", tables[isa]->name,
+           table_failed ? "FAILED" : "matches nom");
+    failed += table_failed;
+  }
+
+  check_out_free(&ref);
+  check_out_free(&out);
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -6,10 +6,9 @@
  1. Carrier wave generation by means of DLUT method.
  2. Pseudorandom code generation by means of DLUT method.
  3. Down-conversion of the received signal by nominal multiplication.
- 4. Multiplication of baseband signal with a local replica of ranging code using
- AVX2 SIMD intrinsics with si32 types
- 5. Accumulation to generate the correlation value with saturation of AVX2 SIMD
- si32 types.
+ 4. Single pass multiplication and accumulation of the baseband signal with the
+ Early, Prompt and Late replicas of the ranging code using AVX2 SIMD
+ intrinsics with si32 types
  *  \author    Damian Miralles
  *  \author    Jake Johnson
  *  \date      Jan 23, 2018
@@ -120,9 +119,9 @@ int main() {
   double *VSMIndex = calloc(codePeriods / vsmInterval, sizeof(double));
   double *VSMValue = calloc(codePeriods / vsmInterval, sizeof(double));
 
-  const int lutSize = 256;       // [N=number of bits]
-  int32_t sin_LUT_si32[lutSize]; // our sine wave LUT
-  int32_t cos_LUT_si32[lutSize]; // our sine wave LUT
+  const int lutSize = GNSS_NCO_LUT_SIZE; // [N=number of bits]
+  int32_t sin_LUT_si32[lutSize];         // our sine wave LUT
+  int32_t cos_LUT_si32[lutSize];         // our sine wave LUT
 
   // Allocate memory for the signal
   rawSignal = calloc(dataAdaptCoeff * blksize, sizeof(char));
@@ -194,23 +193,10 @@ int main() {
       mixedcarrCos_vec[i] = cos_nco_si32[i] * rawSignal[i];
     }
 
-    // I_E
-    double I_E = avx2_mul_and_acc_si32(eCode_vec, mixedcarrSin_vec, blksize);
-
-    // I_L
-    double I_L = avx2_mul_and_acc_si32(lCode_vec, mixedcarrSin_vec, blksize);
-
-    // I_P
-    double I_P = avx2_mul_and_acc_si32(pCode_vec, mixedcarrSin_vec, blksize);
-
-    // Q_E
-    double Q_E = avx2_mul_and_acc_si32(eCode_vec, mixedcarrCos_vec, blksize);
-
-    // Q_L
-    double Q_L = avx2_mul_and_acc_si32(lCode_vec, mixedcarrCos_vec, blksize);
-
-    // Q_P
-    double Q_P = avx2_mul_and_acc_si32(pCode_vec, mixedcarrCos_vec, blksize);
+    // I_E, I_P, I_L, Q_E, Q_P and Q_L in a single pass
+    avx2_correlate_epl_si32(&I_E, &I_P, &I_L, &Q_E, &Q_P, &Q_L,
+                            eCode_vec, pCode_vec, lCode_vec,
+                            mixedcarrSin_vec, mixedcarrCos_vec, blksize);
 
     // Compute the VSM C/No
     pwr = I_P * I_P + Q_P * Q_P;
@@ -126,9 +126,9 @@ int main() {
   double *VSMIndex = calloc(codePeriods / vsmInterval, sizeof(double));
   double *VSMValue = calloc(codePeriods / vsmInterval, sizeof(double));
 
-  const int lutSize = 256;       // [N=number of bits]
-  int32_t sin_LUT_si32[lutSize]; // our sine wave LUT
-  int32_t cos_LUT_si32[lutSize]; // our sine wave LUT
+  const int lutSize = GNSS_NCO_LUT_SIZE; // [N=number of bits]
+  int32_t sin_LUT_si32[lutSize];         // our sine wave LUT
+  int32_t cos_LUT_si32[lutSize];         // our sine wave LUT
   const float delta_phi =
       (float)carrFreqBasis / samplingFreq * blksize; // phase increment
 
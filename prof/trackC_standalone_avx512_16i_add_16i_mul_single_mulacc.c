@@ -3,11 +3,12 @@
  *  \brief      Simulates the tracking stage of a receiver using AVX512
  intrinsics.
  *  \details    Profiles code when using:
- 1. Carrier wave generation by means of DLUT method.
- 2. Pseudorandom code generation by means of DLUT method.
+ 1. Carrier wave generation by means of LUT method with si16 outputs.
+ 2. Pseudorandom code generation by means of LUT method with si16 outputs.
  3. Down-conversion of the received signal by nominal multiplication.
  4. Multiplication and accumulation of baseband signal with a local replica of
-ranging code using AVX512 SIMD intrinsics with si16 types and saturation math.
+ranging code using AVX512 SIMD intrinsics, si16 products widened into si32
+sums.
  *  \author    Damian Miralles
  *  \author    Jake Johnson
  *  \date      Jan 23, 2018
@@ -21,6 +22,7 @@ $ gcc -I ../src/ trackC_standalone_avx512_16i_add_16i_mul_single_mulacc.c -g
  */
 
 #include "avx512_intrinsics.h"
+#include "carrier_lut.h"
 #include "read_bin.h"
 #include "write_bin.h"
 #include <math.h>
@@ -39,13 +41,11 @@ int main() {
 
   // Declarations
 
-  int i, loopcount, angle, blksize, pCode, eCode, lCode, channelNr,
-      totalChannels;
+  int i, loopcount, angle, blksize, channelNr, totalChannels;
   int vsmCount, vsmInterval, PRN, dataAdaptCoeff;
   double remCodePhase, remCarrPhase, codePhaseStep;
-  double earlyLateSpc, seekvalue, samplingFreq, trigarg, carrCos, carrSin,
-      carrFreq;
-  double I_E, Q_E, I_P, Q_P, I_L, Q_L, mixedcarrSin, mixedcarrCos, baseCode;
+  double seekvalue, samplingFreq, trigarg, carrCos, carrSin, carrFreq;
+  double I_E, Q_E, I_P, Q_P, I_L, Q_L, mixedcarrSin, mixedcarrCos;
   double carrNco, oldCarrNco, tau1carr, tau2carr, carrError, oldCarrError;
   double PDIcarr, codeNco, oldCodeNco, tau1code, tau2code, codeError,
       oldCodeError, PDIcode;
@@ -76,12 +76,11 @@ int main() {
   pwrSqrSum = 0;
 
   // Get all the vectors/integers/strings from .bin files
-  double caCode[1025];
-  getcaCodeFromFile("data/caCode.bin", caCode);
+  int caCode[1025];
+  getcaCodeFromFileAsInt("data/caCode.bin", caCode);
   blksize = getIntFromFile("data/blksize.bin");
   codePhaseStep = getDoubleFromFile("data/codePhaseStep.bin");
   remCodePhase = getDoubleFromFile("data/remCodePhase.bin");
-  earlyLateSpc = getDoubleFromFile("data/earlyLateSpc.bin");
   samplingFreq = getDoubleFromFile("data/samplingFreq.bin");
   remCarrPhase = getDoubleFromFile("data/remCarrPhase.bin");
   carrFreq = getDoubleFromFile("data/carrFreq.bin");
@@ -161,11 +160,8 @@ int main() {
     // can be read
 
     // instantiate vectors
-    double trigarg_vec[blksize];
-    double angle_vec[blksize];
-
-    double carrCos_vec[blksize];
-    double carrSin_vec[blksize];
+    int16_t carrCos_vec[blksize];
+    int16_t carrSin_vec[blksize];
 
     short mixedcarrSin_vec[blksize];
     short mixedcarrCos_vec[blksize];
@@ -174,56 +170,40 @@ int main() {
     short lCode_vec[blksize];
     short pCode_vec[blksize];
 
-    // This loop is for parts of code I haven't brought out of loop or haven't
-    // figured out how to
-    for (i = 0; i < blksize; i++) {
-      // Generate the carrier frequency to mix the signal to baseband
-      trigarg_vec[i] =
-          (2.0 * pi * carrFreq * (i / samplingFreq)) + remCarrPhase;
-      angle_vec[i] = (int)(trigarg_vec[i] * 10000) % 62832;
-      carrCos_vec[i] = (short)(round(8 * (gps_cos(angle_vec[i]))));
-      carrSin_vec[i] = (short)(round(8 * (gps_sin(angle_vec[i]))));
+    // Carrier and code replicas generated directly as si16
+    avx512_nco_si16(carrSin_vec, gnss_sin_lut_si32, blksize, remCarrPhase,
+                    carrFreq, samplingFreq);
+    avx512_nco_si16(carrCos_vec, gnss_cos_lut_si32, blksize, remCarrPhase,
+                    carrFreq, samplingFreq);
+    avx512_code_si16(eCode_vec, pCode_vec, lCode_vec, caCode, blksize,
+                     (float)remCodePhase, (float)codeFreq, (float)samplingFreq);
 
+    for (i = 0; i < blksize; i++) {
       // Assuming real data (dataAdaptCoeff=1):
       // Mix to baseband
       mixedcarrSin_vec[i] = carrSin_vec[i] * rawSignal[i];
       mixedcarrCos_vec[i] = carrCos_vec[i] * rawSignal[i];
-
-      // Find PRN Values:
-      baseCode = (i * codePhaseStep + remCodePhase);
-
-      pCode = (short)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
-      eCode = (short)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
-                  ? (baseCode - earlyLateSpc + 1)
-                  : (baseCode - earlyLateSpc);
-      lCode = (short)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
-                  ? (baseCode + earlyLateSpc + 1)
-                  : (baseCode + earlyLateSpc);
-
-      pCode_vec[i] = *(caCode + pCode);
-      eCode_vec[i] = *(caCode + eCode);
-      lCode_vec[i] = *(caCode + lCode);
     }
 
     // Now get early, late, and prompt values for each:-------------------------
 
     // I_E
-    double I_E = avx512_mul_and_acc_16i(eCode_vec, mixedcarrSin_vec, blksize);
+    double I_E = avx512_mul_and_acc_si16(eCode_vec, mixedcarrSin_vec, blksize);
 
     // I_L
-    double I_L = avx512_mul_and_acc_16i(lCode_vec, mixedcarrSin_vec, blksize);
+    double I_L = avx512_mul_and_acc_si16(lCode_vec, mixedcarrSin_vec, blksize);
 
     // I_P
-    double I_P = avx512_mul_and_acc_16i(pCode_vec, mixedcarrSin_vec, blksize);
+    double I_P = avx512_mul_and_acc_si16(pCode_vec, mixedcarrSin_vec, blksize);
 
     // Q_E
-    double Q_E = avx512_mul_and_acc_16i(eCode_vec, mixedcarrCos_vec, blksize);
+    double Q_E = avx512_mul_and_acc_si16(eCode_vec, mixedcarrCos_vec, blksize);
 
     // Q_L
-    double Q_L = avx512_mul_and_acc_16i(lCode_vec, mixedcarrCos_vec, blksize);
+    double Q_L = avx512_mul_and_acc_si16(lCode_vec, mixedcarrCos_vec, blksize);
 
     // Q_P
-    double Q_P = avx512_mul_and_acc_16i(pCode_vec, mixedcarrCos_vec, blksize);
+    double Q_P = avx512_mul_and_acc_si16(pCode_vec, mixedcarrCos_vec, blksize);
 
     // Compute the VSM C/No
     pwr = I_P * I_P + Q_P * Q_P;
@@ -0,0 +1,369 @@
+/*!
+ *  \file trackC_standalone_dispatch_32i.c
+ *  \brief      Simulates the tracking stage of a receiver using the kernels
+ selected at runtime for the CPU.
+ *  \details    Profiles code when using:
+ 1. Sine and cosine carrier generation from a single phase ramp by means of
+ a packed sine/cosine DLUT, built at compile time.
+ 2. Pseudorandom code generation by means of DLUT method, indexed by a 32.32
+ fixed point code NCO that keeps its phase from one block to the next.
+ 3. Down-conversion of the received signal by nominal multiplication.
+ 4. Single pass multiplication and accumulation of the baseband signal with the
+ Early, Prompt and Late replicas of the ranging code with si32 types
+ The NCO, code generation and correlation kernels are bound by
+ gnss_dispatch_init() to the AVX512, AVX2 or portable C implementation, so the
+ same binary runs on every x86-64 machine. When built with -DUSE_REPLICA_CACHE
+ the Early, Prompt and Late replicas come from a cache of pre-resampled code
+ periods of at most REPLICA_CACHE_BYTES, see replica_cache.h. When built with
+ -DUSE_CODE_WINDOW a single Prompt replica is generated per period and the
+ Early and Late replicas are offsets into it, earlyLateSpc rounded to samples.
+ *  \author    Damian Miralles
+ *  \author    Jake Johnson
+ *  \date      Jan 23, 2018
+ *  \pre       Make sure you have .bin files containing data and lookup tables.
+ *  \code{.sh}
+# Sample compilation script
+$ gcc -I ../src/ trackC_standalone_dispatch_32i.c -g
+ -pthread -lm -o dispatch_si32 -O3 [-DUSE_REPLICA_CACHE | -DUSE_CODE_WINDOW]
+ *  \endcode
+ */
+
+#include "carrier_lut.h"
+#include "dispatch_intrinsics.h"
+#include "read_bin.h"
+#include "replica_cache.h"
+#include "write_bin.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef REPLICA_CACHE_BYTES
+#define REPLICA_CACHE_BYTES (1 << 22) //!< Memory budget of the replica cache
+#endif
+
+// Sin and Cos Function approximations
+#define gps_sin(x) (((x > 31416) || (x < 0 && x > -31416)) ? -1 : +1)
+#define gps_cos(x)                                                             \
+  (((x > 15708 && x < 47124) || (x < -15708 && x > -47124)) ? -1 : 1)
+
+int main() {
+
+  // Declarations
+
+  int i, loopcount, blksize;
+  int vsmCount, vsmInterval, dataAdaptCoeff;
+  double remCodePhase, remCarrPhase;
+  double seekvalue, samplingFreq, trigarg, carrFreq;
+#ifdef USE_CODE_WINDOW
+  double earlyLateSpc;
+#endif
+  double I_E, Q_E, I_P, Q_P, I_L, Q_L;
+  double carrNco, oldCarrNco, tau1carr, tau2carr, carrError, oldCarrError;
+  double PDIcarr, codeNco, oldCodeNco, tau1code, tau2code, codeError,
+      oldCodeError, PDIcode;
+  double codeFreq, codeFreqBasis, carrFreqBasis, absoluteSample, codeLength;
+  double pwr, pwrSum, pwrSqrSum, pwrMean, pwrVar, pwrAvgSqr, pwrAvg, noiseVar,
+      CNo, accInt;
+  char *rawSignal;
+  long int codePeriods;
+  const double pi = 3.1415926535;
+
+  FILE *fpdata;
+
+  // Initialization
+  remCodePhase = 0;
+  remCarrPhase = 0;
+  oldCarrNco = 0;
+  oldCarrError = 0;
+  carrError = 0;
+  oldCarrError = 0;
+  oldCodeNco = 0;
+  oldCodeError = 0;
+  absoluteSample = 0;
+  vsmCount = 0;
+  pwr = 0;
+  CNo = 0;
+  pwrSum = 0;
+  pwrSqrSum = 0;
+
+  // Get all the vectors/integers/strings from .bin files
+  int caCode[1025];
+  getcaCodeFromFileAsInt("../data/caCode.bin", caCode);
+  blksize = getIntFromFile("../data/blksize.bin");
+  remCodePhase = getDoubleFromFile("../data/remCodePhase.bin");
+#ifdef USE_CODE_WINDOW
+  earlyLateSpc = getDoubleFromFile("../data/earlyLateSpc.bin");
+#endif
+  samplingFreq = getDoubleFromFile("../data/samplingFreq.bin");
+  remCarrPhase = getDoubleFromFile("../data/remCarrPhase.bin");
+  carrFreq = getDoubleFromFile("../data/carrFreq.bin");
+  char fileid[] = "../data/GPS_and_GIOVE_A-NN-fs16_3676-if4_1304.bin";
+  seekvalue = getDoubleFromFile("../data/skipvalue.bin");
+  tau1carr = getDoubleFromFile("../data/tau1carr.bin");
+  tau2carr = getDoubleFromFile("../data/tau2carr.bin");
+  PDIcarr = getDoubleFromFile("../data/PDIcarr.bin");
+  carrFreqBasis = getDoubleFromFile("../data/carrFreqBasis.bin");
+  tau1code = getDoubleFromFile("../data/tau1code.bin");
+  tau2code = getDoubleFromFile("../data/tau2code.bin");
+  PDIcode = getDoubleFromFile("../data/PDIcode.bin");
+  codeFreq =
+      1023002.79220779; // getDoubleFromFile("text_data_files/codeFreq.bin");
+  codeFreqBasis =
+      1023002.79220779; // getDoubleFromFile("text_data_files/codeFreqBasis.bin");
+  codeLength = getDoubleFromFile("../data/codeLength.bin");
+  codePeriods = (long int)getIntFromFile("../data/codePeriods.bin");
+  dataAdaptCoeff = getIntFromFile("../data/dataAdaptCoeff.bin");
+  vsmInterval = getIntFromFile("../data/VSMinterval.bin");
+  accInt = getDoubleFromFile("../data/accTime.bin");
+
+  // Declare outputs
+  double *carrFreq_output = calloc(codePeriods, sizeof(double));
+  double *codeFreq_output = calloc(codePeriods, sizeof(double));
+  double *absoluteSample_output = calloc(codePeriods, sizeof(double));
+  double *codeError_output = calloc(codePeriods, sizeof(double));
+  double *codeNco_output = calloc(codePeriods, sizeof(double));
+  double *carrError_output = calloc(codePeriods, sizeof(double));
+  double *carrNco_output = calloc(codePeriods, sizeof(double));
+  double *I_E_output = calloc(codePeriods, sizeof(double));
+  double *I_P_output = calloc(codePeriods, sizeof(double));
+  double *I_L_output = calloc(codePeriods, sizeof(double));
+  double *Q_E_output = calloc(codePeriods, sizeof(double));
+  double *Q_P_output = calloc(codePeriods, sizeof(double));
+  double *Q_L_output = calloc(codePeriods, sizeof(double));
+  double *VSMIndex = calloc(codePeriods / vsmInterval, sizeof(double));
+  double *VSMValue = calloc(codePeriods / vsmInterval, sizeof(double));
+
+  gnss_nco_t carrNcoState;
+  gnss_code_nco_t codeNcoState;
+
+  // Allocate memory for the signal
+  rawSignal = calloc(dataAdaptCoeff * blksize, sizeof(char));
+
+  // Open the file for reading the data and fseek if required
+  fpdata = fopen(fileid, "rb");
+  fseek(fpdata, dataAdaptCoeff * seekvalue, SEEK_SET);
+
+  // The code NCO carries the code phase across blocks from here on
+  gnss_code_nco_init(&codeNcoState, remCodePhase, codeFreq, samplingFreq);
+
+  // Bind the kernels to the best implementation for this CPU
+  const gnss_kernels_t *kernels = gnss_dispatch_init();
+
+  int sec_count = 0;
+  printf("\n*** Running: trackC_standalone_dispatch_32i ***\n");
+  printf("  [Using %s kernels]\n", kernels->name);
+
+#ifdef USE_REPLICA_CACHE
+  // Blocks only ever differ from the nominal one by a sample or two
+  gnss_replica_cache_t replicaCache;
+  if (gnss_replica_cache_alloc(&replicaCache, kernels, blksize + 64,
+                               REPLICA_CACHE_BYTES) != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+#endif
+  for (loopcount = 0; loopcount < codePeriods; loopcount++) {
+
+    if (loopcount == 1000 * sec_count) {
+      printf("  [Completed: %d seconds]\r", sec_count);
+      fflush(stdout);
+      sec_count += 1;
+    }
+
+    I_E = 0;
+    Q_E = 0;
+    I_P = 0;
+    Q_P = 0;
+    I_L = 0;
+    Q_L = 0;
+    i = 0;
+
+    gnss_code_nco_set_freq(&codeNcoState, codeFreq, samplingFreq);
+    blksize = gnss_code_nco_samples(&codeNcoState, (int32_t)codeLength);
+
+    i = fread(rawSignal, sizeof(char), dataAdaptCoeff * blksize, fpdata);
+
+    // An error check should be added here to see if the required amount of data
+    // can be read
+
+    // instantiate vectors
+    int32_t mixedcarrSin_vec[blksize];
+    int32_t mixedcarrCos_vec[blksize];
+    int32_t sin_nco_si32[blksize];
+    int32_t cos_nco_si32[blksize];
+
+    // Sine and cosine NCOs from a single phase ramp
+    gnss_nco_init(&carrNcoState, remCarrPhase, carrFreq, samplingFreq);
+    kernels->nco_iq_si32(sin_nco_si32, cos_nco_si32, gnss_sincos_lut_si32,
+                         blksize, &carrNcoState);
+
+#ifdef USE_REPLICA_CACHE
+    const int32_t *eCode_vec, *pCode_vec, *lCode_vec;
+    int32_t eCode_buf[blksize], pCode_buf[blksize], lCode_buf[blksize];
+    if (gnss_replica_cache_code(&replicaCache, &eCode_vec, &pCode_vec,
+                                &lCode_vec, caCode, blksize,
+                                &codeNcoState) != EXIT_SUCCESS) {
+      // Block too long for the cache entries, generate it in place
+      kernels->code_state_si32(eCode_buf, pCode_buf, lCode_buf, caCode,
+                               blksize, &codeNcoState);
+      eCode_vec = eCode_buf;
+      pCode_vec = pCode_buf;
+      lCode_vec = lCode_buf;
+    }
+#elif defined(USE_CODE_WINDOW)
+    const int32_t spacing = gnss_code_nco_spacing(&codeNcoState, earlyLateSpc);
+    int32_t codeWindow[blksize + 2 * spacing];
+    kernels->code_window_si32(codeWindow, caCode, blksize, spacing,
+                              &codeNcoState);
+    const int32_t *eCode_vec = codeWindow;
+    const int32_t *pCode_vec = codeWindow + spacing;
+    const int32_t *lCode_vec = codeWindow + 2 * spacing;
+#else
+    int32_t eCode_vec[blksize];
+    int32_t lCode_vec[blksize];
+    int32_t pCode_vec[blksize];
+    kernels->code_state_si32(eCode_vec, pCode_vec, lCode_vec, caCode, blksize,
+                             &codeNcoState);
+#endif
+    // This loop is for parts of code I haven't brought out of loop or haven't
+    // figured out how to
+    for (i = 0; i < blksize; i++) {
+      mixedcarrSin_vec[i] = sin_nco_si32[i] * rawSignal[i];
+      mixedcarrCos_vec[i] = cos_nco_si32[i] * rawSignal[i];
+    }
+
+    // I_E, I_P, I_L, Q_E, Q_P and Q_L in a single pass
+    kernels->correlate_epl_si32(&I_E, &I_P, &I_L, &Q_E, &Q_P, &Q_L,
+                                eCode_vec, pCode_vec, lCode_vec,
+                                mixedcarrSin_vec, mixedcarrCos_vec, blksize);
+
+    // Compute the VSM C/No
+    pwr = I_P * I_P + Q_P * Q_P;
+    pwrSum += pwr;
+    pwrSqrSum += pwr * pwr;
+    vsmCount++;
+
+    if (vsmCount == vsmInterval) {
+      pwrMean = pwrSum / vsmInterval;
+      pwrVar = pwrSqrSum / vsmInterval - pwrMean * pwrMean;
+      pwrAvgSqr = pwrMean * pwrMean - pwrVar;
+      pwrAvgSqr = (pwrAvgSqr > 0) ? pwrAvgSqr : -pwrAvgSqr;
+      pwrAvg = sqrt(pwrAvgSqr);
+      noiseVar = 0.5 * (pwrMean - pwrAvg);
+      CNo = (pwrAvg / accInt) / (2 * noiseVar);
+      CNo = (CNo > 0) ? CNo : -CNo;
+      CNo = 10 * log10(CNo);
+
+      *(VSMIndex + loopcount / vsmInterval) = loopcount + 1;
+      *(VSMValue + loopcount / vsmInterval) = CNo;
+
+      vsmCount = 0;
+      pwrSum = 0;
+      pwrSqrSum = 0;
+    }
+
+    gnss_code_nco_wrap(&codeNcoState, (int32_t)codeLength);
+    remCodePhase = gnss_code_nco_phase(&codeNcoState);
+    trigarg = (2.0 * pi * carrFreq * (blksize / samplingFreq)) + remCarrPhase;
+    remCarrPhase = trigarg - (2 * pi) * ((int)(trigarg / (2 * pi)));
+
+    // Implement carrier loop discriminator (phase detector)
+    /* COMMENTING OUT BECAUSE I_P == 0 at loopcount== */
+    carrError = atan(Q_P / I_P) / (2.0 * pi);
+
+    // Implement carrier loop filter and generate NCO command
+    carrNco = oldCarrNco + (tau2carr / tau1carr) * (carrError - oldCarrError) +
+              carrError * (PDIcarr / tau1carr);
+    oldCarrNco = carrNco;
+    oldCarrError = carrError;
+
+    // Modify carrier freq based on NCO command
+    carrFreq = carrFreqBasis + carrNco;
+
+    // Find DLL error and update code NCO -------------------------------------
+    codeError = (sqrt(I_E * I_E + Q_E * Q_E) - sqrt(I_L * I_L + Q_L * Q_L)) /
+                (sqrt(I_E * I_E + Q_E * Q_E) + sqrt(I_L * I_L + Q_L * Q_L));
+
+    // Implement code loop filter and generate NCO command
+    codeNco = oldCodeNco + (tau2code / tau1code) * (codeError - oldCodeError) +
+              codeError * (PDIcode / tau1code);
+    oldCodeNco = codeNco;
+    oldCodeError = codeError;
+
+    // Modify code freq based on NCO command
+    codeFreq = codeFreqBasis - codeNco;
+    absoluteSample = ftell(fpdata) / dataAdaptCoeff - remCodePhase;
+
+    // Store values in output arrays         vvv Corresponding variable in
+    // Matlab (trackResults)
+    carrFreq_output[loopcount] = carrFreq; // codeFreq
+    codeFreq_output[loopcount] = codeFreq;
+    absoluteSample_output[loopcount] = absoluteSample; // absoluteSample
+    codeError_output[loopcount] = codeError;           // dllDiscr
+    codeNco_output[loopcount] = codeNco;               // dllDiscrFilt
+    carrError_output[loopcount] = carrError;           // pllDiscr
+    carrNco_output[loopcount] = carrNco;               // pllDiscrFilt
+    I_E_output[loopcount] = I_E;                       // I_E
+    I_P_output[loopcount] = I_P;                       // I_P
+    I_L_output[loopcount] = I_L;                       // I_L
+    Q_E_output[loopcount] = Q_E;                       // Q_E
+    Q_P_output[loopcount] = Q_P;                       // Q_P
+    Q_L_output[loopcount] = Q_L;                       // Q_L
+
+  } // end for
+
+  // Log tracking results to file
+  printf("  [Logging data into the 'plot/data_dispatch_32i' directory]\n");
+  write_file_fl64("../plot/data_dispatch_32i/codeNco_output.bin",
+                  codeNco_output);
+  write_file_fl64("../plot/data_dispatch_32i/codeError_output.bin",
+                  codeError_output);
+  write_file_fl64("../plot/data_dispatch_32i/carrNco_output.bin",
+                  carrNco_output);
+  write_file_fl64("../plot/data_dispatch_32i/carrError_output.bin",
+                  carrError_output);
+  write_file_fl64("../plot/data_dispatch_32i/absoluteSample_output.bin",
+                  absoluteSample_output);
+  write_file_fl64("../plot/data_dispatch_32i/carrFreq_output.bin",
+                  carrFreq_output);
+  write_file_fl64("../plot/data_dispatch_32i/codeFreq_output.bin",
+                  codeFreq_output);
+  write_file_fl64("../plot/data_dispatch_32i/I_E_output.bin", I_E_output);
+  write_file_fl64("../plot/data_dispatch_32i/I_P_output.bin", I_P_output);
+  write_file_fl64("../plot/data_dispatch_32i/I_L_output.bin", I_L_output);
+  write_file_fl64("../plot/data_dispatch_32i/Q_E_output.bin", Q_E_output);
+  write_file_fl64("../plot/data_dispatch_32i/Q_P_output.bin", Q_P_output);
+  write_file_fl64("../plot/data_dispatch_32i/Q_L_output.bin", Q_L_output);
+
+  // Clearing up memory
+  printf("  [Cleaning up used memory]\n");
+#ifdef USE_REPLICA_CACHE
+  printf("  [Replica cache: %lu hits, %lu misses, %lu rejected, %d entries]\n",
+         (unsigned long)replicaCache.hits, (unsigned long)replicaCache.misses,
+         (unsigned long)replicaCache.rejected, replicaCache.num_entries);
+  gnss_replica_cache_free(&replicaCache);
+#endif
+  fclose(fpdata);
+  free(rawSignal);
+  free(carrFreq_output);
+  free(codeFreq_output);
+  free(absoluteSample_output);
+  free(codeError_output);
+  free(codeNco_output);
+  free(carrError_output);
+  free(carrNco_output);
+  free(I_E_output);
+  free(I_P_output);
+  free(I_L_output);
+  free(Q_E_output);
+  free(Q_P_output);
+  free(Q_L_output);
+  free(VSMIndex);
+  free(VSMValue);
+
+  // Exit the program
+  printf("*** Job Completed Succesfully! ***\n\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,298 @@
+/*!
+ *  \file trackC_standalone_multichannel.c
+ *  \brief      Simulates the tracking stage of a multi-channel receiver using
+ the kernels selected at runtime for the CPU.
+ *  \details    Profiles code when tracking several channels over the same
+ sample stream:
+ 1. Samples are read once into a sliding window shared by all the channels.
+ A reader thread fills a ring of PREFETCH_BUFFERS windows ahead of the
+ correlators. Building with -DSAMPLE_BITS=2 or 4 reads recordings packed as
+ 2-bit or 4-bit sign/magnitude samples, unpacked by the reader thread with the
+ kernels bound by gnss_dispatch_init(). When built with -DUSE_MMAP the window
+ points straight into a memory mapping of the 8-bit recording instead, with no
+ read syscalls or copies.
+ 2. A pool of worker threads tracks the channels over the window, each
+ channel running the fused carrier wipeoff, code generation and E/P/L
+ correlation kernel bound by gnss_dispatch_init(). Recordings of interleaved
+ I/Q samples (dataAdaptCoeff = 2) use the complex wipeoff variant.
+ 3. The window slides to the oldest sample still needed by any channel.
+ All channels are initialized from the same .bin files and track PRN TRACK_PRN,
+ whose ranging code comes from the built-in code table rather than from disk.
+ The results of channel 0 are logged so they can be compared against the single
+ channel drivers.
+ *  \author    Damian Miralles
+ *  \author    Jake Johnson
+ *  \date      Jan 23, 2018
+ *  \pre       Make sure you have .bin files containing data and lookup tables.
+ *  \code{.sh}
+# Sample compilation script
+$ gcc -I ../src/ trackC_standalone_multichannel.c -g
+ -pthread -lm -o multi_si32 -O3 -DNUM_CHANNELS=12 -DNUM_THREADS=4
+ [-DUSE_MMAP | -DSAMPLE_BITS=4 -DSAMPLE_FILE='"../data/file.sm4"']
+ *  \endcode
+ */
+
+#include "carrier_lut.h"
+#include "code_table.h"
+#include "read_bin.h"
+#include "sample_prefetch.h"
+#include "sample_source.h"
+#include "track_engine.h"
+#include "write_bin.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef NUM_CHANNELS
+#define NUM_CHANNELS 12 //!< Number of channels tracked by the receiver
+#endif
+
+#ifndef NUM_THREADS
+#define NUM_THREADS 4 //!< Number of workers, including the main thread
+#endif
+
+#ifndef WINDOW_SAMPLES
+#define WINDOW_SAMPLES (64 * 16384) //!< Size of the shared sample window
+#endif
+
+#ifndef PREFETCH_BUFFERS
+#define PREFETCH_BUFFERS 4 //!< Windows read ahead by the reader thread
+#endif
+
+#ifndef SAMPLE_BITS
+#define SAMPLE_BITS 8 //!< Bits per sample in the recording, 2, 4 or 8
+#endif
+
+#ifndef TRACK_PRN
+#define TRACK_PRN 22 //!< PRN tracked by every channel, the one in caCode.bin
+#endif
+
+#ifndef SAMPLE_FILE
+#define SAMPLE_FILE "../data/GPS_and_GIOVE_A-NN-fs16_3676-if4_1304.bin"
+#endif
+
+#if defined(USE_MMAP) && SAMPLE_BITS != 8
+#error "USE_MMAP requires a recording with 8 bits per sample"
+#endif
+
+int main() {
+
+  // Declarations
+
+  int blksize, dataAdaptCoeff, vsmInterval;
+  double remCodePhase, remCarrPhase, seekvalue, samplingFreq, carrFreq;
+  double codeFreq;
+  int64_t firstSample, numSamples, neededSample;
+  int status = EXIT_SUCCESS;
+  long int codePeriods;
+
+#ifdef USE_MMAP
+  const int8_t *rawSignal;
+  gnss_sample_source_t source;
+#else
+  const int8_t *rawSignal;
+  gnss_prefetch_t prefetch;
+#endif
+
+  gnss_channel_config_t cfg;
+  gnss_channel_t channels[NUM_CHANNELS];
+  gnss_track_results_t results;
+  gnss_engine_t engine;
+
+  // Ranging codes of every PRN are generated once, shared by all channels
+  static gnss_code_table_t codeTable;
+  gnss_code_table_init(&codeTable);
+  const int32_t *caCode = gnss_code_table_si32(&codeTable, TRACK_PRN);
+  if (caCode == NULL) {
+    return EXIT_FAILURE;
+  }
+
+  // Get all the vectors/integers/strings from .bin files
+  blksize = getIntFromFile("../data/blksize.bin");
+  remCodePhase = getDoubleFromFile("../data/remCodePhase.bin");
+  samplingFreq = getDoubleFromFile("../data/samplingFreq.bin");
+  remCarrPhase = getDoubleFromFile("../data/remCarrPhase.bin");
+  carrFreq = getDoubleFromFile("../data/carrFreq.bin");
+  char fileid[] = SAMPLE_FILE;
+  seekvalue = getDoubleFromFile("../data/skipvalue.bin");
+  codeFreq =
+      1023002.79220779; // getDoubleFromFile("text_data_files/codeFreq.bin");
+  codePeriods = (long int)getIntFromFile("../data/codePeriods.bin");
+  dataAdaptCoeff = getIntFromFile("../data/dataAdaptCoeff.bin");
+  vsmInterval = getIntFromFile("../data/VSMinterval.bin");
+
+  cfg.samp_freq = samplingFreq;
+  cfg.code_length = getDoubleFromFile("../data/codeLength.bin");
+  cfg.code_freq_basis =
+      1023002.79220779; // getDoubleFromFile("text_data_files/codeFreqBasis.bin");
+  cfg.carr_freq_basis = getDoubleFromFile("../data/carrFreqBasis.bin");
+  cfg.tau1carr = getDoubleFromFile("../data/tau1carr.bin");
+  cfg.tau2carr = getDoubleFromFile("../data/tau2carr.bin");
+  cfg.pdi_carr = getDoubleFromFile("../data/PDIcarr.bin");
+  cfg.tau1code = getDoubleFromFile("../data/tau1code.bin");
+  cfg.tau2code = getDoubleFromFile("../data/tau2code.bin");
+  cfg.pdi_code = getDoubleFromFile("../data/PDIcode.bin");
+  cfg.acc_int = getDoubleFromFile("../data/accTime.bin");
+  cfg.vsm_interval = vsmInterval;
+  cfg.code_periods = codePeriods;
+
+  // Real samples take one int8_t each, complex ones an interleaved I/Q pair
+  if (dataAdaptCoeff != 1 && dataAdaptCoeff != 2) {
+    printf("dataAdaptCoeff must be 1 (real) or 2 (complex) samples\n");
+    return EXIT_FAILURE;
+  }
+  cfg.data_adapt_coeff = dataAdaptCoeff;
+
+  // Carrier lookup tables are built at compile time
+  cfg.sin_lut = gnss_sin_lut_si32;
+  cfg.cos_lut = gnss_cos_lut_si32;
+  cfg.kernels = gnss_dispatch_init();
+
+  // Only channel 0 logs its tracking results
+  if (gnss_track_results_alloc(&results, codePeriods) != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+  for (int c = 0; c < NUM_CHANNELS; c++) {
+    gnss_channel_init(&channels[c], &cfg, caCode, carrFreq, codeFreq,
+                      remCodePhase, remCarrPhase, (int64_t)seekvalue,
+                      (c == 0) ? &results : NULL);
+  }
+
+  // The shared sample window must hold at least one full code period
+  if (WINDOW_SAMPLES < 2 * blksize) {
+    printf("WINDOW_SAMPLES must be at least twice the block size\n");
+    return EXIT_FAILURE;
+  }
+
+#ifdef USE_MMAP
+  // Map the whole file, windows are handed out straight from the mapping
+  if (gnss_source_open(&source, fileid) != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+#else
+  // Start reading ahead, carrying over up to two code periods per window
+  if (gnss_prefetch_open(&prefetch, fileid, dataAdaptCoeff * (int64_t)seekvalue,
+                         PREFETCH_BUFFERS, dataAdaptCoeff * WINDOW_SAMPLES,
+                         dataAdaptCoeff * 2 * blksize, SAMPLE_BITS,
+                         (SAMPLE_BITS == 2) ? cfg.kernels->unpack_2bit_si8
+                                            : cfg.kernels->unpack_4bit_si8) !=
+      EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+#endif
+
+  if (gnss_engine_init(&engine, channels, NUM_CHANNELS, NUM_THREADS) !=
+      EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+
+  printf("\n*** Running: trackC_standalone_multichannel ***\n");
+  printf("  [Tracking %d channels with %d threads and %s kernels]\n",
+         NUM_CHANNELS, engine.num_threads, cfg.kernels->name);
+
+  int sec_count = 0;
+  firstSample = (int64_t)seekvalue;
+  neededSample = firstSample;
+  numSamples = 0;
+  for (;;) {
+
+#ifdef USE_MMAP
+    // Point the window at the oldest sample still needed
+    rawSignal = gnss_source_window(&source, dataAdaptCoeff * firstSample,
+                                   dataAdaptCoeff * WINDOW_SAMPLES,
+                                   &numSamples);
+    if (rawSignal == NULL) {
+      break;
+    }
+    numSamples /= dataAdaptCoeff;
+#else
+    // Take the next prefetched window, starting at the oldest sample needed
+    rawSignal = gnss_prefetch_next(&prefetch, dataAdaptCoeff * neededSample,
+                                   &firstSample, &numSamples);
+    if (rawSignal == NULL) {
+      break;
+    }
+    firstSample /= dataAdaptCoeff;
+    numSamples /= dataAdaptCoeff;
+#endif
+
+    neededSample =
+        gnss_engine_process(&engine, rawSignal, firstSample, numSamples);
+    if (neededSample == GNSS_ENGINE_BEHIND) {
+      status = EXIT_FAILURE;
+      break;
+    }
+
+    if (channels[0].loop_count >= 1000 * sec_count) {
+      printf("  [Completed: %ld seconds]\r", channels[0].loop_count / 1000);
+      fflush(stdout);
+      sec_count = channels[0].loop_count / 1000 + 1;
+    }
+
+#ifdef USE_MMAP
+    // Stop once every channel is done or the file is exhausted
+    if (neededSample < 0 || numSamples < WINDOW_SAMPLES) {
+      break;
+    }
+
+    // Drop the pages that no channel will read again
+    gnss_source_release(&source, dataAdaptCoeff * neededSample);
+#else
+    // Stop once every channel is done
+    if (neededSample < 0) {
+      break;
+    }
+#endif
+    firstSample = neededSample;
+  }
+  printf("\n");
+
+  // Log tracking results to file
+  printf("  [Logging data into the 'plot/data_multichannel' directory]\n");
+  write_file_fl64("../plot/data_multichannel/codeNco_output.bin",
+                  results.code_nco);
+  write_file_fl64("../plot/data_multichannel/codeError_output.bin",
+                  results.code_error);
+  write_file_fl64("../plot/data_multichannel/carrNco_output.bin",
+                  results.carr_nco);
+  write_file_fl64("../plot/data_multichannel/carrError_output.bin",
+                  results.carr_error);
+  write_file_fl64("../plot/data_multichannel/absoluteSample_output.bin",
+                  results.absolute_sample);
+  write_file_fl64("../plot/data_multichannel/carrFreq_output.bin",
+                  results.carr_freq);
+  write_file_fl64("../plot/data_multichannel/codeFreq_output.bin",
+                  results.code_freq);
+  write_file_fl64("../plot/data_multichannel/I_E_output.bin",
+                  results.i_e);
+  write_file_fl64("../plot/data_multichannel/I_P_output.bin",
+                  results.i_p);
+  write_file_fl64("../plot/data_multichannel/I_L_output.bin",
+                  results.i_l);
+  write_file_fl64("../plot/data_multichannel/Q_E_output.bin",
+                  results.q_e);
+  write_file_fl64("../plot/data_multichannel/Q_P_output.bin",
+                  results.q_p);
+  write_file_fl64("../plot/data_multichannel/Q_L_output.bin",
+                  results.q_l);
+
+  // Clearing up memory
+  printf("  [Cleaning up used memory]\n");
+  gnss_engine_free(&engine);
+#ifdef USE_MMAP
+  gnss_source_close(&source);
+#else
+  gnss_prefetch_close(&prefetch);
+#endif
+  gnss_track_results_free(&results);
+
+  // Exit the program
+  if (status != EXIT_SUCCESS) {
+    return status;
+  }
+  printf("*** Job Completed Succesfully! ***\n\n");
+  return EXIT_SUCCESS;
+}
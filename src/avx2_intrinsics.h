@@ -9,7 +9,11 @@
  *  \pre       Make sure you have .bin files containing data and lookup tables
  */
 
+#ifndef AVX2_INTRINSICS_H
+#define AVX2_INTRINSICS_H
+
 #include "immintrin.h"
+#include "nco_state.h"
 #include <math.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -53,7 +57,7 @@ void avx2_nco_si32(int32_t *sig_nco, const int32_t *lut, const int32_t blk_size,
 
   for (inda = 0; inda < eight_points; inda++) {
     // Shift packed 32-bit integers in a right by imm8 while shifting in zeros
-    carr_idx = _mm256_srli_epi32(carr_phase_base, 24);
+    carr_idx = _mm256_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT);
     // carr_idx = _mm256_and_si256(carr_idx, hex_ff);
 
     // Look in lut
@@ -71,12 +75,14 @@ void avx2_nco_si32(int32_t *sig_nco, const int32_t *lut, const int32_t blk_size,
   }
 
   inda = eight_points * 8;
-  nom_carr_phase_base = (uint32_t)_mm256_extract_epi32(carr_phase_base, 7);
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base = (uint32_t)_mm256_extract_epi32(carr_phase_base, 0);
 
   // generate buffer of output
   for (; inda < blk_size; ++inda) {
-    // Obtain integer index in 8:24 number
-    nom_carr_idx = (nom_carr_phase_base >> 24) & 0xFF;
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    nom_carr_idx =
+        (nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT) & GNSS_NCO_LUT_MASK;
     // Look in lut
     *sig_nco++ = lut[nom_carr_idx]; // get sample value from lut
     // Delta step
@@ -84,6 +90,200 @@ void avx2_nco_si32(int32_t *sig_nco, const int32_t *lut, const int32_t blk_size,
   }
 }
 
+/*!
+ *  \brief Generates a phase-continuous NCO based on the Parallel Lookup Table
+ * (PLUT) method
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table to be use for the code
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void avx2_nco_state_si32(int32_t *sig_nco, const int32_t *lut,
+                         const int32_t blk_size, gnss_nco_t *nco) {
+  int32_t inda;
+  const uint32_t eight_points = blk_size / 8;
+  const uint32_t nom_carr_step = nco->step;
+  uint32_t nom_carr_phase_base = nco->phase;
+
+  // Lane k starts k samples ahead of the accumulator
+  __m256i carr_phase_base = _mm256_add_epi32(
+      _mm256_set1_epi32(nom_carr_phase_base),
+      _mm256_set_epi32(7 * nom_carr_step, 6 * nom_carr_step, 5 * nom_carr_step,
+                       4 * nom_carr_step, 3 * nom_carr_step, 2 * nom_carr_step,
+                       1 * nom_carr_step, 0 * nom_carr_step));
+  __m256i carr_step_offset = _mm256_set1_epi32(8 * nom_carr_step);
+  __m256i carr_idx;
+  __m256i sig;
+
+  for (inda = 0; inda < eight_points; inda++) {
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    carr_idx = _mm256_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT);
+
+    // Look in lut
+    sig = _mm256_i32gather_epi32(lut, carr_idx, 4);
+
+    // Delta step
+    carr_phase_base = _mm256_add_epi32(carr_phase_base, carr_step_offset);
+
+    // Store values in output buffer
+    _mm256_storeu_si256((__m256i *)sig_nco, sig);
+    sig_nco += 8;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base = (uint32_t)_mm256_extract_epi32(carr_phase_base, 0);
+
+  for (inda = eight_points * 8; inda < blk_size; ++inda) {
+    *sig_nco++ = lut[nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT];
+    nom_carr_phase_base += nom_carr_step;
+  }
+  nco->phase = nom_carr_phase_base;
+}
+
+/*!
+ *  \brief Generates the sine and cosine carriers of a quadrature NCO
+ *  \details Both carriers come from one phase ramp and one gather of the
+ * packed table built by gnss_nco_sincos_lut_si32().
+ *  \param[out] sig_sin Sine wave generated by the NCO
+ *  \param[out] sig_cos Cosine wave generated by the NCO
+ *  \param[in] sincos_lut Packed sine and cosine lookup table
+ *  \param[in] blk_size Total number of elements in the output vectors
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void avx2_nco_iq_si32(int32_t *sig_sin, int32_t *sig_cos,
+                      const int32_t *sincos_lut, const int32_t blk_size,
+                      gnss_nco_t *nco) {
+  int32_t inda;
+  const uint32_t eight_points = blk_size / 8;
+  const uint32_t nom_carr_step = nco->step;
+  uint32_t nom_carr_phase_base = nco->phase;
+
+  // Lane k starts k samples ahead of the accumulator
+  __m256i carr_phase_base = _mm256_add_epi32(
+      _mm256_set1_epi32(nom_carr_phase_base),
+      _mm256_set_epi32(7 * nom_carr_step, 6 * nom_carr_step, 5 * nom_carr_step,
+                       4 * nom_carr_step, 3 * nom_carr_step, 2 * nom_carr_step,
+                       1 * nom_carr_step, 0 * nom_carr_step));
+  __m256i carr_step_offset = _mm256_set1_epi32(8 * nom_carr_step);
+  __m256i carr_idx;
+  __m256i sincos, sin_val, cos_val;
+  int32_t nom_sincos;
+
+  for (inda = 0; inda < eight_points; inda++) {
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    carr_idx = _mm256_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT);
+
+    // One lookup for both carriers, sine in the upper half of each entry
+    sincos = _mm256_i32gather_epi32(sincos_lut, carr_idx, 4);
+    sin_val = _mm256_srai_epi32(sincos, 16);
+    cos_val = _mm256_srai_epi32(_mm256_slli_epi32(sincos, 16), 16);
+
+    // Delta step
+    carr_phase_base = _mm256_add_epi32(carr_phase_base, carr_step_offset);
+
+    // Store values in output buffers
+    _mm256_storeu_si256((__m256i *)sig_sin, sin_val);
+    _mm256_storeu_si256((__m256i *)sig_cos, cos_val);
+    sig_sin += 8;
+    sig_cos += 8;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base = (uint32_t)_mm256_extract_epi32(carr_phase_base, 0);
+
+  for (inda = eight_points * 8; inda < blk_size; ++inda) {
+    nom_sincos = sincos_lut[nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT];
+    *sig_sin++ = nom_sincos >> 16;
+    *sig_cos++ = (int16_t)nom_sincos;
+    nom_carr_phase_base += nom_carr_step;
+  }
+  nco->phase = nom_carr_phase_base;
+}
+
+/*!
+ *  \brief Generates a NCO from a small lookup table held in registers
+ *  \details Replaces the gather of the PLUT method with vpermd/vpermps on
+ * the 8 entry quarters of the table, blended on the upper index bits for
+ * tables of 16 or 32 entries. Outruns the gather for 8 and 16 entries, while
+ * 32 entries take four permutes per vector on the single shuffle port.
+ * Tables of 2 or 4 entries fill the low lanes of the first register only,
+ * and larger tables than 32 entries fall back to the scalar lookup.
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table of 1 << lut_bits entries
+ *  \param[in] lut_bits Phase bits indexing the table, 1 to 5
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void avx2_nco_perm_si32(int32_t *sig_nco, const int32_t *lut,
+                        const int32_t lut_bits, const int32_t blk_size,
+                        gnss_nco_t *nco) {
+  int32_t inda;
+  const uint32_t eight_points = (lut_bits <= 5) ? blk_size / 8 : 0;
+  const int32_t shift = 32 - lut_bits;
+  const int32_t lut_size = 1 << lut_bits;
+  const uint32_t nom_carr_step = nco->step;
+  uint32_t nom_carr_phase_base = nco->phase;
+
+  // Lane k starts k samples ahead of the accumulator
+  __m256i carr_phase_base = _mm256_add_epi32(
+      _mm256_set1_epi32(nom_carr_phase_base),
+      _mm256_set_epi32(7 * nom_carr_step, 6 * nom_carr_step, 5 * nom_carr_step,
+                       4 * nom_carr_step, 3 * nom_carr_step, 2 * nom_carr_step,
+                       1 * nom_carr_step, 0 * nom_carr_step));
+  __m256i carr_step_offset = _mm256_set1_epi32(8 * nom_carr_step);
+  const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  __m256i carr_idx, sel, sig, sig_hi, mask;
+  __m256i lut_reg[4];
+
+  // Keep the whole table in registers, 8 entries per register, loading only
+  // the entries the table has
+  for (int q = 0; q < 4; q++) {
+    lut_reg[q] = _mm256_setzero_si256();
+    if (8 * q < lut_size) {
+      mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(lut_size - 8 * q), lane);
+      lut_reg[q] = _mm256_maskload_epi32(lut + 8 * q, mask);
+    }
+  }
+
+  for (inda = 0; inda < eight_points; inda++) {
+    // Obtain integer index in lut_bits:(32 - lut_bits) number
+    carr_idx = _mm256_srli_epi32(carr_phase_base, shift);
+
+    // Look in the lower 8 entries, the permute only reads index bits 0 to 2
+    sig = _mm256_permutevar8x32_epi32(lut_reg[0], carr_idx);
+    if (lut_bits > 3) {
+      // Index bit 3 selects the next 8 entries
+      sel = _mm256_srai_epi32(_mm256_slli_epi32(carr_idx, 28), 31);
+      sig_hi = _mm256_permutevar8x32_epi32(lut_reg[1], carr_idx);
+      sig = _mm256_blendv_epi8(sig, sig_hi, sel);
+      if (lut_bits > 4) {
+        // Index bit 4 selects the upper 16 entries
+        sig_hi = _mm256_blendv_epi8(
+            _mm256_permutevar8x32_epi32(lut_reg[2], carr_idx),
+            _mm256_permutevar8x32_epi32(lut_reg[3], carr_idx), sel);
+        sel = _mm256_srai_epi32(_mm256_slli_epi32(carr_idx, 27), 31);
+        sig = _mm256_blendv_epi8(sig, sig_hi, sel);
+      }
+    }
+
+    // Delta step
+    carr_phase_base = _mm256_add_epi32(carr_phase_base, carr_step_offset);
+
+    // Store values in output buffer
+    _mm256_storeu_si256((__m256i *)sig_nco, sig);
+    sig_nco += 8;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base = (uint32_t)_mm256_extract_epi32(carr_phase_base, 0);
+
+  for (inda = eight_points * 8; inda < blk_size; ++inda) {
+    *sig_nco++ = lut[nom_carr_phase_base >> shift];
+    nom_carr_phase_base += nom_carr_step;
+  }
+  nco->phase = nom_carr_phase_base;
+}
+
 /*!
  *  \brief     Generates a nominal NCO based on the Direct Lookup Table (DLUT)
  * method
@@ -106,8 +306,8 @@ void avx2_nom_nco_si32(int32_t *sig_nco, const int32_t *lut,
 
   // for each sample
   for (inda = 0; inda < blk_size; ++inda) {
-    // Obtain integer index in 8:24 number
-    carrIndex = (carrPhaseBase >> 24) & 0xFF;
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    carrIndex = (carrPhaseBase >> GNSS_NCO_LUT_SHIFT) & GNSS_NCO_LUT_MASK;
 
     // Look in lut
     sig_nco[inda] = lut[carrIndex];
@@ -156,6 +356,32 @@ void avx2_nom_code_si32(int32_t *ecode, int32_t *pcode, int32_t *lcode,
   }
 }
 
+/*!
+ *  \brief Finds the chips of the Early, Prompt and Late replicas of 8 samples
+ *  \details The code phase of every sample is computed from its index in the
+ * block rather than accumulated, and rounded up to the chip it falls in, with
+ * the same float operations as nom_code_si32(). The SIMD code generators thus
+ * match the portable ones sample for sample, whatever the block size.
+ *  \param[out] code_idx Early, Prompt and Late chip indices
+ *  \param[in] sample_idx Index of each sample in the block
+ *  \param[in] code_step Code phase step between two samples
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] spacing Early to Prompt spacing in chips
+ */
+static inline void avx2_code_idx(__m256i *code_idx, const __m256i sample_idx,
+                                 const __m256 code_step,
+                                 const __m256 rem_code_phase,
+                                 const __m256 spacing) {
+  __m256 code_phase = _mm256_add_ps(
+      _mm256_mul_ps(_mm256_cvtepi32_ps(sample_idx), code_step), rem_code_phase);
+
+  code_idx[0] = _mm256_cvttps_epi32(
+      _mm256_ceil_ps(_mm256_sub_ps(code_phase, spacing)));
+  code_idx[1] = _mm256_cvttps_epi32(_mm256_ceil_ps(code_phase));
+  code_idx[2] = _mm256_cvttps_epi32(
+      _mm256_ceil_ps(_mm256_add_ps(code_phase, spacing)));
+}
+
 /*!
  *  \brief     Generates an Early, late and Prompt code using SIMD Iinstructions
  *  \param[out] ecode Product vector storing the result of the multiplication
@@ -180,41 +406,24 @@ void avx2_code_si32(int32_t *ecode, int32_t *pcode, int32_t *lcode,
   int32_t pCodeIdx, eCodeIdx, lCodeIdx;
 
   // Important variable declarations
-  __m256 ecode_phase_base = _mm256_set1_ps(rem_code_phase - earlyLateSpc + 0.5);
-  __m256 pcode_phase_base = _mm256_set1_ps(rem_code_phase + 0.5);
-  __m256 lcode_phase_base = _mm256_set1_ps(rem_code_phase + earlyLateSpc + 0.5);
-
-  __m256 code_step_base =
-      _mm256_set_ps(7 * codePhaseStep, 6 * codePhaseStep, 5 * codePhaseStep,
-                    4 * codePhaseStep, 3 * codePhaseStep, 2 * codePhaseStep,
-                    1 * codePhaseStep, 0 * codePhaseStep);
-  __m256i ecode_idx = _mm256_set1_epi32(0);
-  __m256i pcode_idx = _mm256_set1_epi32(0);
-  __m256i lcode_idx = _mm256_set1_epi32(0);
-
+  __m256i sample_idx = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+  __m256i sample_offset = _mm256_set1_epi32(8);
+  __m256 code_step = _mm256_set1_ps(codePhaseStep);
+  __m256 code_phase_base = _mm256_set1_ps(rem_code_phase);
+  __m256 code_spacing = _mm256_set1_ps(earlyLateSpc);
+  __m256i code_idx[3];
   __m256i elut, plut, llut;
-  __m256 code_step_offset = _mm256_set1_ps(8 * codePhaseStep);
-
-  // First iteration happens outside the loop
-  ecode_phase_base = _mm256_add_ps(ecode_phase_base, code_step_base);
-  pcode_phase_base = _mm256_add_ps(pcode_phase_base, code_step_base);
-  lcode_phase_base = _mm256_add_ps(lcode_phase_base, code_step_base);
 
   for (inda = 0; inda < eight_points; inda++) {
-    // Obtain integer index in 8:24 number
-    ecode_idx = _mm256_cvtps_epi32(ecode_phase_base);
-    pcode_idx = _mm256_cvtps_epi32(pcode_phase_base);
-    lcode_idx = _mm256_cvtps_epi32(lcode_phase_base);
+    // Chips of the replicas for the next 8 samples
+    avx2_code_idx(code_idx, sample_idx, code_step, code_phase_base,
+                  code_spacing);
+    sample_idx = _mm256_add_epi32(sample_idx, sample_offset);
 
     // Look in lut
-    elut = _mm256_i32gather_epi32(cacode, ecode_idx, 4);
-    plut = _mm256_i32gather_epi32(cacode, pcode_idx, 4);
-    llut = _mm256_i32gather_epi32(cacode, lcode_idx, 4);
-
-    // Delta step
-    ecode_phase_base = _mm256_add_ps(ecode_phase_base, code_step_offset);
-    pcode_phase_base = _mm256_add_ps(pcode_phase_base, code_step_offset);
-    lcode_phase_base = _mm256_add_ps(lcode_phase_base, code_step_offset);
+    elut = _mm256_i32gather_epi32(cacode, code_idx[0], 4);
+    plut = _mm256_i32gather_epi32(cacode, code_idx[1], 4);
+    llut = _mm256_i32gather_epi32(cacode, code_idx[2], 4);
 
     // 5- Store values in output buffer
     _mm256_storeu_si256((__m256i *)ecode, elut);
@@ -227,10 +436,8 @@ void avx2_code_si32(int32_t *ecode, int32_t *pcode, int32_t *lcode,
     lcode += 8;
   }
 
-  inda = eight_points * 8;
-
   // generate buffer of output
-  for (; inda < blk_size; ++inda) {
+  for (inda = eight_points * 8; inda < blk_size; ++inda) {
     baseCode = (inda * codePhaseStep + rem_code_phase);
     pCodeIdx = (int32_t)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
     eCodeIdx = (int32_t)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
@@ -240,241 +447,2519 @@ void avx2_code_si32(int32_t *ecode, int32_t *pcode, int32_t *lcode,
                    ? (baseCode + earlyLateSpc + 1)
                    : (baseCode + earlyLateSpc);
 
-    ecode[inda] = *(cacode + eCodeIdx);
-    pcode[inda] = *(cacode + pCodeIdx);
-    lcode[inda] = *(cacode + lCodeIdx);
+    *ecode++ = *(cacode + eCodeIdx);
+    *pcode++ = *(cacode + pCodeIdx);
+    *lcode++ = *(cacode + lCodeIdx);
   }
 }
 
 /*!
- *  \brief Generates a NCO based on the Direct Lookup Table (DLUT) method.
- *  \param[out] sig_nco Sinusoidal wave generated byt the NCO
- *  \param[in] lut Lookup table to be use for the code
+ *  \brief Generates a NCO based on the Parallel Lookup Table (PLUT) method as
+ * si16 type
+ *  \details Gathers two vectors of si32 table entries per step and packs them
+ * with saturation into 16 int16_t lanes, so the 16-bit correlators get their
+ * carrier without a scalar conversion pass.
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table of GNSS_NCO_LUT_SIZE entries
  *  \param[in] blk_size Total number of elements in the sig_nco vector
- *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave to
- * be generated \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
  *  \param[in] samp_freq Sampling frequency of the signal to be generated
  */
-void avx2_nco_fl32(float *sig_nco, const float *lut, const int32_t blk_size,
+void avx2_nco_si16(int16_t *sig_nco, const int32_t *lut, const int32_t blk_size,
                    const double rem_carr_phase, const double carr_freq,
                    const double samp_freq) {
   int32_t inda;
-  const uint32_t eight_points = blk_size / 8;
+  const uint32_t sixteenth_points = blk_size / 16;
   const uint32_t nom_carr_step =
       (uint32_t)(carr_freq * (4294967296.0 / samp_freq) + 0.5);
-
-  // Declarations for serial implementation
   uint32_t nom_carr_phase_base =
       (uint32_t)(rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
-  uint32_t nom_carr_idx = 0;
 
-  // Important variable declarations
-  __m256i carr_phase_base = _mm256_set1_epi32(nom_carr_phase_base);
-  __m256i carr_step_base =
+  // Lane k starts k samples ahead of the accumulator
+  __m256i carr_phase_base = _mm256_add_epi32(
+      _mm256_set1_epi32(nom_carr_phase_base),
       _mm256_set_epi32(7 * nom_carr_step, 6 * nom_carr_step, 5 * nom_carr_step,
                        4 * nom_carr_step, 3 * nom_carr_step, 2 * nom_carr_step,
-                       1 * nom_carr_step, 0 * nom_carr_step);
-  __m256i carr_idx = _mm256_set1_epi32(0);
-  __m256i hex_ff =
-      _mm256_set_epi32(0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF);
-  __m256 nco;
+                       1 * nom_carr_step, 0 * nom_carr_step));
   __m256i carr_step_offset = _mm256_set1_epi32(8 * nom_carr_step);
+  __m256i lo, hi;
 
-  // First iteration happens outside the loop
-  carr_phase_base = _mm256_add_epi32(carr_phase_base, carr_step_base);
-
-  for (inda = 0; inda < eight_points; inda++) {
-    // Obtain integer index in 8:24 number
-    carr_idx = _mm256_srli_epi32(carr_phase_base, 24);
-    carr_idx = _mm256_and_si256(carr_idx, hex_ff);
-
-    // Look in lut
-    nco = _mm256_i32gather_ps(lut, carr_idx, 4);
-
-    // Delta step
-    // carr_step_base = _mm256_add_epi32(carr_step_base, carr_step_offset);
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // Look in lut for samples 0 to 7 and 8 to 15
+    lo = _mm256_i32gather_epi32(
+        lut, _mm256_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT), 4);
+    carr_phase_base = _mm256_add_epi32(carr_phase_base, carr_step_offset);
+    hi = _mm256_i32gather_epi32(
+        lut, _mm256_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT), 4);
     carr_phase_base = _mm256_add_epi32(carr_phase_base, carr_step_offset);
 
-    // 5- Store values in output buffer
-    _mm256_storeu_ps((float *)sig_nco, nco);
+    // packs works within 128-bit halves, restore the sample order
+    lo = _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8);
 
-    // 6- Update pointers
-    sig_nco += 8;
+    // Store values in output buffer
+    _mm256_storeu_si256((__m256i *)sig_nco, lo);
+    sig_nco += 16;
   }
 
-  inda = eight_points * 8;
-  nom_carr_phase_base = (uint32_t)_mm256_extract_epi32(carr_phase_base, 7);
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base = (uint32_t)_mm256_extract_epi32(carr_phase_base, 0);
 
-  // generate buffer of output
-  for (; inda < blk_size; ++inda) {
-    // Obtain integer index in 8:24 number
-    nom_carr_idx = (nom_carr_phase_base >> 24) & 0xFF;
-    // Look in lut
-    *sig_nco++ = lut[nom_carr_idx]; // get sample value from lut
-    // Delta step
+  for (inda = sixteenth_points * 16; inda < blk_size; ++inda) {
+    *sig_nco++ = (int16_t)lut[nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT];
     nom_carr_phase_base += nom_carr_step;
   }
 }
 
 /*!
- *  \brief Generates a nominal NCO based on the direct lookup table approach
- *  \param[out] sig_nco Sinusoidal wave generated byt the NCO
- *  \param[in] lut Lookup table to be use for the code
+ *  \brief Generates a NCO based on the Parallel Lookup Table (PLUT) method as
+ * si8 type
+ *  \details Gathers four vectors of si32 table entries per step and packs them
+ * with saturation into 32 int8_t lanes.
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table of GNSS_NCO_LUT_SIZE entries
  *  \param[in] blk_size Total number of elements in the sig_nco vector
- *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave to
- * be generated \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
  *  \param[in] samp_freq Sampling frequency of the signal to be generated
  */
-void avx2_nom_nco_fl32(float *sig_nco, const float *lut, const int32_t blk_size,
-                       const double rem_carr_phase, const double carr_freq,
-                       const double samp_freq) {
+void avx2_nco_si8(int8_t *sig_nco, const int32_t *lut, const int32_t blk_size,
+                  const double rem_carr_phase, const double carr_freq,
+                  const double samp_freq) {
+  int32_t inda;
+  const uint32_t thirtysecond_points = blk_size / 32;
+  const uint32_t nom_carr_step =
+      (uint32_t)(carr_freq * (4294967296.0 / samp_freq) + 0.5);
+  uint32_t nom_carr_phase_base =
+      (uint32_t)(rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+
+  // Lane k starts k samples ahead of the accumulator
+  __m256i carr_phase_base = _mm256_add_epi32(
+      _mm256_set1_epi32(nom_carr_phase_base),
+      _mm256_set_epi32(7 * nom_carr_step, 6 * nom_carr_step, 5 * nom_carr_step,
+                       4 * nom_carr_step, 3 * nom_carr_step, 2 * nom_carr_step,
+                       1 * nom_carr_step, 0 * nom_carr_step));
+  __m256i carr_step_offset = _mm256_set1_epi32(8 * nom_carr_step);
+  __m256i order = _mm256_set_epi32(7, 3, 6, 2, 5, 1, 4, 0);
+  __m256i sig[4];
+
+  for (inda = 0; inda < thirtysecond_points; inda++) {
+    // Look in lut for four groups of 8 samples
+    for (int v = 0; v < 4; v++) {
+      sig[v] = _mm256_i32gather_epi32(
+          lut, _mm256_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT), 4);
+      carr_phase_base = _mm256_add_epi32(carr_phase_base, carr_step_offset);
+    }
+
+    // packs works within 128-bit halves, restore the sample order
+    sig[0] = _mm256_packs_epi16(_mm256_packs_epi32(sig[0], sig[1]),
+                                _mm256_packs_epi32(sig[2], sig[3]));
+    sig[0] = _mm256_permutevar8x32_epi32(sig[0], order);
+
+    // Store values in output buffer
+    _mm256_storeu_si256((__m256i *)sig_nco, sig[0]);
+    sig_nco += 32;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base = (uint32_t)_mm256_extract_epi32(carr_phase_base, 0);
+
+  for (inda = thirtysecond_points * 32; inda < blk_size; ++inda) {
+    *sig_nco++ = (int8_t)lut[nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT];
+    nom_carr_phase_base += nom_carr_step;
+  }
+}
+
+/*!
+ *  \brief Generates an Early, Late and Prompt code using SIMD instructions as
+ * si16 type
+ *  \details Same code phases as avx2_code_si32(), with two gathers per replica
+ * packed into 16 int16_t lanes on every step.
+ *  \param[out] ecode Early replica of the ranging code
+ *  \param[out] pcode Prompt replica of the ranging code
+ *  \param[out] lcode Late replica of the ranging code
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of elements in the code vectors
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void avx2_code_si16(int16_t *ecode, int16_t *pcode, int16_t *lcode,
+                    const int32_t *cacode, const int32_t blk_size,
+                    const float rem_code_phase, const float code_freq,
+                    const float samp_freq) {
 
-  uint32_t carrPhaseBase =
-      (rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
-  uint32_t carrStep = (carr_freq * (4294967296.0 / samp_freq) + 0.5);
-  uint32_t carrIndex = 0;
   int32_t inda;
+  const uint32_t sixteenth_points = blk_size / 16;
+  float earlyLateSpc = 0.5;
+  float codePhaseStep = code_freq / samp_freq;
+  float baseCode;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
 
-  // for each sample
-  for (inda = 0; inda < blk_size; ++inda) {
-    // Obtain integer index in 8:24 number
-    carrIndex = (carrPhaseBase >> 24) & 0xFF;
+  // Important variable declarations
+  __m256i sample_idx = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+  __m256i sample_offset = _mm256_set1_epi32(8);
+  __m256 code_step = _mm256_set1_ps(codePhaseStep);
+  __m256 code_phase_base = _mm256_set1_ps(rem_code_phase);
+  __m256 code_spacing = _mm256_set1_ps(earlyLateSpc);
+  __m256i lo_idx[3], hi_idx[3];
+  __m256i lo, hi;
+  int16_t *code[3] = {ecode, pcode, lcode};
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // Chips of samples 0 to 7 and 8 to 15
+    avx2_code_idx(lo_idx, sample_idx, code_step, code_phase_base,
+                  code_spacing);
+    sample_idx = _mm256_add_epi32(sample_idx, sample_offset);
+    avx2_code_idx(hi_idx, sample_idx, code_step, code_phase_base,
+                  code_spacing);
+    sample_idx = _mm256_add_epi32(sample_idx, sample_offset);
+
+    for (int r = 0; r < 3; r++) {
+      // Look in lut
+      lo = _mm256_i32gather_epi32(cacode, lo_idx[r], 4);
+      hi = _mm256_i32gather_epi32(cacode, hi_idx[r], 4);
+
+      // packs works within 128-bit halves, restore the sample order
+      lo = _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8);
+
+      // Store values in output buffer
+      _mm256_storeu_si256((__m256i *)code[r], lo);
+      code[r] += 16;
+    }
+  }
+
+  // generate buffer of output
+  for (inda = sixteenth_points * 16; inda < blk_size; ++inda) {
+    baseCode = (inda * codePhaseStep + rem_code_phase);
+    pCodeIdx = (int32_t)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
+    eCodeIdx = (int32_t)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
+                   ? (baseCode - earlyLateSpc + 1)
+                   : (baseCode - earlyLateSpc);
+    lCodeIdx = (int32_t)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
+                   ? (baseCode + earlyLateSpc + 1)
+                   : (baseCode + earlyLateSpc);
+
+    ecode[inda] = (int16_t)cacode[eCodeIdx];
+    pcode[inda] = (int16_t)cacode[pCodeIdx];
+    lcode[inda] = (int16_t)cacode[lCodeIdx];
+  }
+}
+
+/*!
+ *  \brief Generates an Early, Late and Prompt code using SIMD instructions as
+ * si8 type
+ *  \details Same code phases as avx2_code_si32(), with four gathers per
+ * replica packed into 32 int8_t lanes on every step.
+ *  \param[out] ecode Early replica of the ranging code
+ *  \param[out] pcode Prompt replica of the ranging code
+ *  \param[out] lcode Late replica of the ranging code
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of elements in the code vectors
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void avx2_code_si8(int8_t *ecode, int8_t *pcode, int8_t *lcode,
+                   const int32_t *cacode, const int32_t blk_size,
+                   const float rem_code_phase, const float code_freq,
+                   const float samp_freq) {
+
+  int32_t inda;
+  const uint32_t thirtysecond_points = blk_size / 32;
+  float earlyLateSpc = 0.5;
+  float codePhaseStep = code_freq / samp_freq;
+  float baseCode;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  // Important variable declarations
+  __m256i sample_idx = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+  __m256i sample_offset = _mm256_set1_epi32(8);
+  __m256 code_step = _mm256_set1_ps(codePhaseStep);
+  __m256 code_phase_base = _mm256_set1_ps(rem_code_phase);
+  __m256 code_spacing = _mm256_set1_ps(earlyLateSpc);
+  __m256i order = _mm256_set_epi32(7, 3, 6, 2, 5, 1, 4, 0);
+  __m256i code_idx[4][3];
+  __m256i chips[4];
+  int8_t *code[3] = {ecode, pcode, lcode};
+
+  for (inda = 0; inda < thirtysecond_points; inda++) {
+    // Chips of four groups of 8 samples
+    for (int v = 0; v < 4; v++) {
+      avx2_code_idx(code_idx[v], sample_idx, code_step, code_phase_base,
+                    code_spacing);
+      sample_idx = _mm256_add_epi32(sample_idx, sample_offset);
+    }
+
+    for (int r = 0; r < 3; r++) {
+      // Look in lut
+      for (int v = 0; v < 4; v++) {
+        chips[v] = _mm256_i32gather_epi32(cacode, code_idx[v][r], 4);
+      }
+
+      // packs works within 128-bit halves, restore the sample order
+      chips[0] = _mm256_packs_epi16(_mm256_packs_epi32(chips[0], chips[1]),
+                                    _mm256_packs_epi32(chips[2], chips[3]));
+      chips[0] = _mm256_permutevar8x32_epi32(chips[0], order);
+
+      // Store values in output buffer
+      _mm256_storeu_si256((__m256i *)code[r], chips[0]);
+      code[r] += 32;
+    }
+  }
+
+  // generate buffer of output
+  for (inda = thirtysecond_points * 32; inda < blk_size; ++inda) {
+    baseCode = (inda * codePhaseStep + rem_code_phase);
+    pCodeIdx = (int32_t)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
+    eCodeIdx = (int32_t)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
+                   ? (baseCode - earlyLateSpc + 1)
+                   : (baseCode - earlyLateSpc);
+    lCodeIdx = (int32_t)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
+                   ? (baseCode + earlyLateSpc + 1)
+                   : (baseCode + earlyLateSpc);
+
+    ecode[inda] = (int8_t)cacode[eCodeIdx];
+    pcode[inda] = (int8_t)cacode[pCodeIdx];
+    lcode[inda] = (int8_t)cacode[lCodeIdx];
+  }
+}
+
+/*!
+ *  \brief Generates an Early, Late and Prompt code from a fixed point code NCO
+ *  \details Each lane keeps the 32.32 code phase as a chip count and a
+ * fraction, the fraction with its sign bit flipped so that signed compares
+ * order it as unsigned. The chip indices of gnss_code_nco_idx() and the carry
+ * of the fraction into the chip count come from integer compares and adds,
+ * so the replicas do not drift and no float conversion sits on the index path.
+ *  \param[out] ecode Early replica of the ranging code
+ *  \param[out] pcode Prompt replica of the ranging code
+ *  \param[out] lcode Late replica of the ranging code
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of elements in the code vectors
+ *  \param[in,out] nco Code NCO state, advanced to the sample that follows the
+ * block
+ */
+void avx2_code_state_si32(int32_t *ecode, int32_t *pcode, int32_t *lcode,
+                          const int32_t *cacode, const int32_t blk_size,
+                          gnss_code_nco_t *nco) {
+  int32_t inda;
+  const uint32_t eight_points = blk_size / 8;
+  const uint64_t code_step = nco->step;
+  uint64_t code_phase = nco->phase;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+  uint32_t lane_chips[8], lane_frac[8];
+
+  // Lane k starts k samples ahead of the accumulator
+  for (int k = 0; k < 8; k++) {
+    lane_chips[k] = (uint32_t)((code_phase + k * code_step) >> 32);
+    lane_frac[k] = (uint32_t)(code_phase + k * code_step) ^ 0x80000000u;
+  }
+  __m256i code_chips = _mm256_loadu_si256((const __m256i *)lane_chips);
+  __m256i code_frac = _mm256_loadu_si256((const __m256i *)lane_frac);
+  const __m256i chip_step = _mm256_set1_epi32((int32_t)((8 * code_step) >> 32));
+  const __m256i frac_step = _mm256_set1_epi32((int32_t)(8 * code_step));
+  const __m256i frac_zero = _mm256_set1_epi32(INT32_MIN);
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i one = _mm256_set1_epi32(1);
+  __m256i above_half, on_chip, next_frac;
+  __m256i ecode_idx, pcode_idx, lcode_idx;
+  __m256i elut, plut, llut;
+
+  for (inda = 0; inda < eight_points; inda++) {
+    // Round up to the next chip, half a chip early and late
+    above_half = _mm256_cmpgt_epi32(code_frac, zero);
+    on_chip = _mm256_cmpeq_epi32(code_frac, frac_zero);
+    ecode_idx = _mm256_sub_epi32(code_chips, above_half);
+    lcode_idx = _mm256_add_epi32(ecode_idx, one);
+    pcode_idx = _mm256_add_epi32(_mm256_add_epi32(code_chips, one), on_chip);
 
     // Look in lut
-    sig_nco[inda] = lut[carrIndex];
+    elut = _mm256_i32gather_epi32(cacode, ecode_idx, 4);
+    plut = _mm256_i32gather_epi32(cacode, pcode_idx, 4);
+    llut = _mm256_i32gather_epi32(cacode, lcode_idx, 4);
+
+    // Delta step, carrying the fraction into the chip count
+    next_frac = _mm256_add_epi32(code_frac, frac_step);
+    code_chips = _mm256_sub_epi32(_mm256_add_epi32(code_chips, chip_step),
+                                  _mm256_cmpgt_epi32(code_frac, next_frac));
+    code_frac = next_frac;
+
+    // Store values in output buffer
+    _mm256_storeu_si256((__m256i *)ecode, elut);
+    _mm256_storeu_si256((__m256i *)pcode, plut);
+    _mm256_storeu_si256((__m256i *)lcode, llut);
+    ecode += 8;
+    pcode += 8;
+    lcode += 8;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  code_phase =
+      ((uint64_t)(uint32_t)_mm256_extract_epi32(code_chips, 0) << 32) |
+      ((uint32_t)_mm256_extract_epi32(code_frac, 0) ^ 0x80000000u);
+
+  for (inda = eight_points * 8; inda < blk_size; ++inda) {
+    gnss_code_nco_idx(code_phase, &eCodeIdx, &pCodeIdx, &lCodeIdx);
+    code_phase += code_step;
+
+    *ecode++ = cacode[eCodeIdx];
+    *pcode++ = cacode[pCodeIdx];
+    *lcode++ = cacode[lCodeIdx];
+  }
+  nco->phase = code_phase;
+}
+
+/*!
+ *  \brief Generates an Early, Late and Prompt code from a fixed point code NCO
+ * as fl32 type
+ *  \details Same code phases as avx2_code_state_si32().
+ *  \param[out] ecode Early replica of the ranging code
+ *  \param[out] pcode Prompt replica of the ranging code
+ *  \param[out] lcode Late replica of the ranging code
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of elements in the code vectors
+ *  \param[in,out] nco Code NCO state, advanced to the sample that follows the
+ * block
+ */
+void avx2_code_state_fl32(float *ecode, float *pcode, float *lcode,
+                          const float *cacode, const int32_t blk_size,
+                          gnss_code_nco_t *nco) {
+  int32_t inda;
+  const uint32_t eight_points = blk_size / 8;
+  const uint64_t code_step = nco->step;
+  uint64_t code_phase = nco->phase;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+  uint32_t lane_chips[8], lane_frac[8];
+
+  // Lane k starts k samples ahead of the accumulator
+  for (int k = 0; k < 8; k++) {
+    lane_chips[k] = (uint32_t)((code_phase + k * code_step) >> 32);
+    lane_frac[k] = (uint32_t)(code_phase + k * code_step) ^ 0x80000000u;
+  }
+  __m256i code_chips = _mm256_loadu_si256((const __m256i *)lane_chips);
+  __m256i code_frac = _mm256_loadu_si256((const __m256i *)lane_frac);
+  const __m256i chip_step = _mm256_set1_epi32((int32_t)((8 * code_step) >> 32));
+  const __m256i frac_step = _mm256_set1_epi32((int32_t)(8 * code_step));
+  const __m256i frac_zero = _mm256_set1_epi32(INT32_MIN);
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i one = _mm256_set1_epi32(1);
+  __m256i above_half, on_chip, next_frac;
+  __m256i ecode_idx, pcode_idx, lcode_idx;
+  __m256 elut, plut, llut;
+
+  for (inda = 0; inda < eight_points; inda++) {
+    // Round up to the next chip, half a chip early and late
+    above_half = _mm256_cmpgt_epi32(code_frac, zero);
+    on_chip = _mm256_cmpeq_epi32(code_frac, frac_zero);
+    ecode_idx = _mm256_sub_epi32(code_chips, above_half);
+    lcode_idx = _mm256_add_epi32(ecode_idx, one);
+    pcode_idx = _mm256_add_epi32(_mm256_add_epi32(code_chips, one), on_chip);
+
+    // Look in lut
+    elut = _mm256_i32gather_ps(cacode, ecode_idx, 4);
+    plut = _mm256_i32gather_ps(cacode, pcode_idx, 4);
+    llut = _mm256_i32gather_ps(cacode, lcode_idx, 4);
+
+    // Delta step, carrying the fraction into the chip count
+    next_frac = _mm256_add_epi32(code_frac, frac_step);
+    code_chips = _mm256_sub_epi32(_mm256_add_epi32(code_chips, chip_step),
+                                  _mm256_cmpgt_epi32(code_frac, next_frac));
+    code_frac = next_frac;
+
+    // Store values in output buffer
+    _mm256_storeu_ps(ecode, elut);
+    _mm256_storeu_ps(pcode, plut);
+    _mm256_storeu_ps(lcode, llut);
+    ecode += 8;
+    pcode += 8;
+    lcode += 8;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  code_phase =
+      ((uint64_t)(uint32_t)_mm256_extract_epi32(code_chips, 0) << 32) |
+      ((uint32_t)_mm256_extract_epi32(code_frac, 0) ^ 0x80000000u);
+
+  for (inda = eight_points * 8; inda < blk_size; ++inda) {
+    gnss_code_nco_idx(code_phase, &eCodeIdx, &pCodeIdx, &lCodeIdx);
+    code_phase += code_step;
+
+    *ecode++ = cacode[eCodeIdx];
+    *pcode++ = cacode[pCodeIdx];
+    *lcode++ = cacode[lCodeIdx];
+  }
+  nco->phase = code_phase;
+}
+
+/*!
+ *  \brief Generates a single Prompt replica of a fixed point code NCO spanning
+ * the Early and Late replicas
+ *  \details The window starts spacing samples before the NCO phase and holds
+ * blk_size + 2 * spacing samples, so the Early, Prompt and Late replicas are
+ * code, code + spacing and code + 2 * spacing. Only the Prompt chip is
+ * gathered, with the lanes stepped as in avx2_code_state_si32(), which cuts
+ * the gathers and stores to a third. The replicas match the code_state
+ * kernels when spacing samples span exactly half a chip.
+ *  \param[out] code Prompt replica, blk_size + 2 * spacing elements
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Number of samples in each of the E/P/L replicas
+ *  \param[in] spacing Early-Prompt spacing in samples, under one chip
+ *  \param[in,out] nco Code NCO state, advanced to the sample that follows the
+ * block
+ */
+void avx2_code_window_si32(int32_t *code, const int32_t *cacode,
+                           const int32_t blk_size, const int32_t spacing,
+                           gnss_code_nco_t *nco) {
+  int32_t inda;
+  const int32_t num_points = blk_size + 2 * spacing;
+  const uint32_t eight_points = num_points / 8;
+  const uint64_t code_step = nco->step;
+  uint64_t code_phase = nco->phase - (uint64_t)spacing * code_step;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+  uint32_t lane_chips[8], lane_frac[8];
+
+  // Lane k starts k samples ahead of the accumulator
+  for (int k = 0; k < 8; k++) {
+    lane_chips[k] = (uint32_t)((code_phase + k * code_step) >> 32);
+    lane_frac[k] = (uint32_t)(code_phase + k * code_step) ^ 0x80000000u;
+  }
+  __m256i code_chips = _mm256_loadu_si256((const __m256i *)lane_chips);
+  __m256i code_frac = _mm256_loadu_si256((const __m256i *)lane_frac);
+  const __m256i chip_step = _mm256_set1_epi32((int32_t)((8 * code_step) >> 32));
+  const __m256i frac_step = _mm256_set1_epi32((int32_t)(8 * code_step));
+  const __m256i frac_zero = _mm256_set1_epi32(INT32_MIN);
+  const __m256i one = _mm256_set1_epi32(1);
+  __m256i on_chip, next_frac, pcode_idx;
+  __m256i plut;
+
+  for (inda = 0; inda < eight_points; inda++) {
+    // Round up to the next chip
+    on_chip = _mm256_cmpeq_epi32(code_frac, frac_zero);
+    pcode_idx = _mm256_add_epi32(_mm256_add_epi32(code_chips, one), on_chip);
+
+    // Look in lut
+    plut = _mm256_i32gather_epi32(cacode, pcode_idx, 4);
+
+    // Delta step, carrying the fraction into the chip count
+    next_frac = _mm256_add_epi32(code_frac, frac_step);
+    code_chips = _mm256_sub_epi32(_mm256_add_epi32(code_chips, chip_step),
+                                  _mm256_cmpgt_epi32(code_frac, next_frac));
+    code_frac = next_frac;
+
+    // Store values in output buffer
+    _mm256_storeu_si256((__m256i *)code, plut);
+    code += 8;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  code_phase =
+      ((uint64_t)(uint32_t)_mm256_extract_epi32(code_chips, 0) << 32) |
+      ((uint32_t)_mm256_extract_epi32(code_frac, 0) ^ 0x80000000u);
+
+  for (inda = eight_points * 8; inda < num_points; ++inda) {
+    gnss_code_nco_idx(code_phase, &eCodeIdx, &pCodeIdx, &lCodeIdx);
+    code_phase += code_step;
+
+    *code++ = cacode[pCodeIdx];
+  }
+  nco->phase += (uint64_t)blk_size * code_step;
+}
+
+/*!
+ *  \brief Generates a single Prompt replica of a fixed point code NCO spanning
+ * the Early and Late replicas as fl32 type
+ *  \details Same window as avx2_code_window_si32().
+ *  \param[out] code Prompt replica, blk_size + 2 * spacing elements
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Number of samples in each of the E/P/L replicas
+ *  \param[in] spacing Early-Prompt spacing in samples, under one chip
+ *  \param[in,out] nco Code NCO state, advanced to the sample that follows the
+ * block
+ */
+void avx2_code_window_fl32(float *code, const float *cacode,
+                           const int32_t blk_size, const int32_t spacing,
+                           gnss_code_nco_t *nco) {
+  int32_t inda;
+  const int32_t num_points = blk_size + 2 * spacing;
+  const uint32_t eight_points = num_points / 8;
+  const uint64_t code_step = nco->step;
+  uint64_t code_phase = nco->phase - (uint64_t)spacing * code_step;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+  uint32_t lane_chips[8], lane_frac[8];
+
+  // Lane k starts k samples ahead of the accumulator
+  for (int k = 0; k < 8; k++) {
+    lane_chips[k] = (uint32_t)((code_phase + k * code_step) >> 32);
+    lane_frac[k] = (uint32_t)(code_phase + k * code_step) ^ 0x80000000u;
+  }
+  __m256i code_chips = _mm256_loadu_si256((const __m256i *)lane_chips);
+  __m256i code_frac = _mm256_loadu_si256((const __m256i *)lane_frac);
+  const __m256i chip_step = _mm256_set1_epi32((int32_t)((8 * code_step) >> 32));
+  const __m256i frac_step = _mm256_set1_epi32((int32_t)(8 * code_step));
+  const __m256i frac_zero = _mm256_set1_epi32(INT32_MIN);
+  const __m256i one = _mm256_set1_epi32(1);
+  __m256i on_chip, next_frac, pcode_idx;
+  __m256 plut;
+
+  for (inda = 0; inda < eight_points; inda++) {
+    // Round up to the next chip
+    on_chip = _mm256_cmpeq_epi32(code_frac, frac_zero);
+    pcode_idx = _mm256_add_epi32(_mm256_add_epi32(code_chips, one), on_chip);
+
+    // Look in lut
+    plut = _mm256_i32gather_ps(cacode, pcode_idx, 4);
+
+    // Delta step, carrying the fraction into the chip count
+    next_frac = _mm256_add_epi32(code_frac, frac_step);
+    code_chips = _mm256_sub_epi32(_mm256_add_epi32(code_chips, chip_step),
+                                  _mm256_cmpgt_epi32(code_frac, next_frac));
+    code_frac = next_frac;
+
+    // Store values in output buffer
+    _mm256_storeu_ps(code, plut);
+    code += 8;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  code_phase =
+      ((uint64_t)(uint32_t)_mm256_extract_epi32(code_chips, 0) << 32) |
+      ((uint32_t)_mm256_extract_epi32(code_frac, 0) ^ 0x80000000u);
+
+  for (inda = eight_points * 8; inda < num_points; ++inda) {
+    gnss_code_nco_idx(code_phase, &eCodeIdx, &pCodeIdx, &lCodeIdx);
+    code_phase += code_step;
+
+    *code++ = cacode[pCodeIdx];
+  }
+  nco->phase += (uint64_t)blk_size * code_step;
+}
+
+/*!
+ *  \brief Generates a NCO with a frequency rate based on the Parallel Lookup
+ * Table (PLUT) method
+ *  \details Every lane carries its own 32.32 phase and step in 64-bit lanes
+ * and moves them eight samples at a time, the phase by eight steps and 28
+ * rates, the step by eight rates, so the second order phase model holds
+ * exactly in every lane. The table is read with 64-bit index gathers.
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table of GNSS_NCO_LUT_SIZE entries
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void avx2_nco_rate_si32(int32_t *sig_nco, const int32_t *lut,
+                        const int32_t blk_size, gnss_nco_rate_t *nco) {
+  int32_t inda;
+  const uint32_t eight_points = blk_size / 8;
+  const uint64_t carr_rate = nco->rate;
+  uint64_t carr_phase = nco->phase;
+  uint64_t carr_step = nco->step;
+  uint64_t lane_phase[8], lane_step[8];
+
+  // Lane k starts k samples ahead of the accumulator
+  for (int k = 0; k < 8; k++) {
+    lane_phase[k] = carr_phase + k * carr_step + (k * (k - 1) / 2) * carr_rate;
+    lane_step[k] = carr_step + k * carr_rate;
+  }
+  __m256i phase_lo = _mm256_loadu_si256((const __m256i *)lane_phase);
+  __m256i phase_hi = _mm256_loadu_si256((const __m256i *)(lane_phase + 4));
+  __m256i step_lo = _mm256_loadu_si256((const __m256i *)lane_step);
+  __m256i step_hi = _mm256_loadu_si256((const __m256i *)(lane_step + 4));
+  const __m256i rate_8 = _mm256_set1_epi64x(8 * carr_rate);
+  const __m256i rate_28 = _mm256_set1_epi64x(28 * carr_rate);
+  __m128i sig_lo, sig_hi;
+
+  for (inda = 0; inda < eight_points; inda++) {
+    // Look in lut with the GNSS_NCO_LUT_BITS upper bits of each phase
+    sig_lo = _mm256_i64gather_epi32(
+        lut, _mm256_srli_epi64(phase_lo, 32 + GNSS_NCO_LUT_SHIFT), 4);
+    sig_hi = _mm256_i64gather_epi32(
+        lut, _mm256_srli_epi64(phase_hi, 32 + GNSS_NCO_LUT_SHIFT), 4);
+
+    // Delta step, then the step itself moves by the rate
+    phase_lo = _mm256_add_epi64(
+        phase_lo, _mm256_add_epi64(_mm256_slli_epi64(step_lo, 3), rate_28));
+    phase_hi = _mm256_add_epi64(
+        phase_hi, _mm256_add_epi64(_mm256_slli_epi64(step_hi, 3), rate_28));
+    step_lo = _mm256_add_epi64(step_lo, rate_8);
+    step_hi = _mm256_add_epi64(step_hi, rate_8);
+
+    // Store values in output buffer
+    _mm256_storeu_si256((__m256i *)sig_nco, _mm256_set_m128i(sig_hi, sig_lo));
+    sig_nco += 8;
+  }
+
+  // Lane 0 holds the phase and step of the first sample not generated yet
+  carr_phase = (uint64_t)_mm256_extract_epi64(phase_lo, 0);
+  carr_step = (uint64_t)_mm256_extract_epi64(step_lo, 0);
+
+  for (inda = eight_points * 8; inda < blk_size; ++inda) {
+    *sig_nco++ = lut[carr_phase >> (32 + GNSS_NCO_LUT_SHIFT)];
+    carr_phase += carr_step;
+    carr_step += carr_rate;
+  }
+  nco->phase = carr_phase;
+  nco->step = carr_step;
+}
+
+/*!
+ *  \brief Generates an Early, Late and Prompt code with a code frequency rate
+ *  \details The code phase and step of every lane are carried in double
+ * precision, since the rate is far below the resolution of the 32.32 step,
+ * and move eight samples at a time as in avx2_nco_rate_si32(). The chip
+ * indices are rounded up with vroundpd before the conversion.
+ *  \param[out] ecode Early replica of the ranging code
+ *  \param[out] pcode Prompt replica of the ranging code
+ *  \param[out] lcode Late replica of the ranging code
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of elements in the code vectors
+ *  \param[in,out] nco Code NCO state, advanced to the sample that follows the
+ * block
+ *  \param[in] code_rate Code step increment per sample, see
+ * gnss_code_nco_rate()
+ */
+void avx2_code_rate_si32(int32_t *ecode, int32_t *pcode, int32_t *lcode,
+                         const int32_t *cacode, const int32_t blk_size,
+                         gnss_code_nco_t *nco, const double code_rate) {
+  int32_t inda;
+  const uint32_t eight_points = blk_size / 8;
+  double code_phase = gnss_code_nco_phase(nco);
+  double code_step = nco->step * (1.0 / 4294967296.0);
+  double lane_phase[8], lane_step[8];
+
+  // Lane k starts k samples ahead of the accumulator
+  for (int k = 0; k < 8; k++) {
+    lane_phase[k] = code_phase + k * code_step + 0.5 * k * (k - 1) * code_rate;
+    lane_step[k] = code_step + k * code_rate;
+  }
+  __m256d phase_lo = _mm256_loadu_pd(lane_phase);
+  __m256d phase_hi = _mm256_loadu_pd(lane_phase + 4);
+  __m256d step_lo = _mm256_loadu_pd(lane_step);
+  __m256d step_hi = _mm256_loadu_pd(lane_step + 4);
+  const __m256d eight = _mm256_set1_pd(8.0);
+  const __m256d rate_8 = _mm256_set1_pd(8.0 * code_rate);
+  const __m256d rate_28 = _mm256_set1_pd(28.0 * code_rate);
+  const __m256d half = _mm256_set1_pd(0.5);
+  __m256i ecode_idx, pcode_idx, lcode_idx;
+  __m256i elut, plut, llut;
+
+  for (inda = 0; inda < eight_points; inda++) {
+    // Round up to the next chip, half a chip early and late
+    ecode_idx = _mm256_set_m128i(
+        _mm256_cvttpd_epi32(_mm256_ceil_pd(_mm256_sub_pd(phase_hi, half))),
+        _mm256_cvttpd_epi32(_mm256_ceil_pd(_mm256_sub_pd(phase_lo, half))));
+    pcode_idx = _mm256_set_m128i(_mm256_cvttpd_epi32(_mm256_ceil_pd(phase_hi)),
+                                 _mm256_cvttpd_epi32(_mm256_ceil_pd(phase_lo)));
+    lcode_idx = _mm256_set_m128i(
+        _mm256_cvttpd_epi32(_mm256_ceil_pd(_mm256_add_pd(phase_hi, half))),
+        _mm256_cvttpd_epi32(_mm256_ceil_pd(_mm256_add_pd(phase_lo, half))));
+
+    // Look in lut
+    elut = _mm256_i32gather_epi32(cacode, ecode_idx, 4);
+    plut = _mm256_i32gather_epi32(cacode, pcode_idx, 4);
+    llut = _mm256_i32gather_epi32(cacode, lcode_idx, 4);
+
+    // Delta step, then the step itself moves by the rate
+    phase_lo = _mm256_add_pd(
+        phase_lo, _mm256_add_pd(_mm256_mul_pd(step_lo, eight), rate_28));
+    phase_hi = _mm256_add_pd(
+        phase_hi, _mm256_add_pd(_mm256_mul_pd(step_hi, eight), rate_28));
+    step_lo = _mm256_add_pd(step_lo, rate_8);
+    step_hi = _mm256_add_pd(step_hi, rate_8);
+
+    // Store values in output buffer
+    _mm256_storeu_si256((__m256i *)ecode, elut);
+    _mm256_storeu_si256((__m256i *)pcode, plut);
+    _mm256_storeu_si256((__m256i *)lcode, llut);
+    ecode += 8;
+    pcode += 8;
+    lcode += 8;
+  }
+
+  // Lane 0 holds the phase and step of the first sample not generated yet
+  code_phase = _mm256_cvtsd_f64(phase_lo);
+  code_step = _mm256_cvtsd_f64(step_lo);
+
+  for (inda = eight_points * 8; inda < blk_size; ++inda) {
+    *ecode++ = cacode[(int32_t)ceil(code_phase - 0.5)];
+    *pcode++ = cacode[(int32_t)ceil(code_phase)];
+    *lcode++ = cacode[(int32_t)ceil(code_phase + 0.5)];
+    code_phase += code_step;
+    code_step += code_rate;
+  }
+  nco->phase = (uint64_t)(int64_t)floor(code_phase * 4294967296.0 + 0.5);
+  nco->step = (uint64_t)(code_step * 4294967296.0 + 0.5);
+}
+
+/*!
+ *  \brief Wipes off the carrier, generates the Early, Prompt and Late codes and
+ * correlates them against the raw signal in a single pass as si32 types
+ *  \details Fuses avx2_nco_si32(), avx2_code_si32(), the carrier mixing and
+ * avx2_correlate_epl_si32(). Carrier and code replicas only live in
+ * registers, so no intermediate blk_size buffers are written or read back.
+ *  \param[out] i_e Early in-phase correlation
+ *  \param[out] i_p Prompt in-phase correlation
+ *  \param[out] i_l Late in-phase correlation
+ *  \param[out] q_e Early quadrature correlation
+ *  \param[out] q_p Prompt quadrature correlation
+ *  \param[out] q_l Late quadrature correlation
+ *  \param[in] signal Raw real signal samples
+ *  \param[in] sin_lut Sine lookup table of 256 entries
+ *  \param[in] cos_lut Cosine lookup table of 256 entries
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of samples to correlate
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void avx2_fused_epl_si32(double *i_e, double *i_p, double *i_l, double *q_e,
+                         double *q_p, double *q_l, const int8_t *signal,
+                         const int32_t *sin_lut, const int32_t *cos_lut,
+                         const int32_t *cacode, const int32_t blk_size,
+                         const double rem_carr_phase, const double carr_freq,
+                         const double rem_code_phase, const double code_freq,
+                         const double samp_freq) {
+
+  int32_t inda, k;
+  const uint32_t eight_points = blk_size / 8;
+  int32_t tempBuffer[6][8];
+  int32_t returnValue[6] = {0, 0, 0, 0, 0, 0};
+  int32_t sinMix, cosMix;
+
+  // Carrier NCO declarations
+  const uint32_t nom_carr_step =
+      (uint32_t)(carr_freq * (4294967296.0 / samp_freq) + 0.5);
+  uint32_t nom_carr_phase_base =
+      (uint32_t)(rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+  uint32_t nom_carr_idx = 0;
+
+  __m256i carr_phase_base = _mm256_set1_epi32(nom_carr_phase_base);
+  __m256i carr_step_base =
+      _mm256_set_epi32(7 * nom_carr_step, 6 * nom_carr_step, 5 * nom_carr_step,
+                       4 * nom_carr_step, 3 * nom_carr_step, 2 * nom_carr_step,
+                       1 * nom_carr_step, 0 * nom_carr_step);
+  __m256i carr_step_offset = _mm256_set1_epi32(8 * nom_carr_step);
+  __m256i carr_idx;
+
+  // Code NCO declarations, kept in fl32 to match avx2_code_si32()
+  const float earlyLateSpc = 0.5;
+  const float remCodePhase = (float)rem_code_phase;
+  const float codePhaseStep = (float)code_freq / (float)samp_freq;
+  float baseCode;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  __m256 ecode_phase_base = _mm256_set1_ps(remCodePhase - earlyLateSpc + 0.5);
+  __m256 pcode_phase_base = _mm256_set1_ps(remCodePhase + 0.5);
+  __m256 lcode_phase_base = _mm256_set1_ps(remCodePhase + earlyLateSpc + 0.5);
+  __m256 code_step_base =
+      _mm256_set_ps(7 * codePhaseStep, 6 * codePhaseStep, 5 * codePhaseStep,
+                    4 * codePhaseStep, 3 * codePhaseStep, 2 * codePhaseStep,
+                    1 * codePhaseStep, 0 * codePhaseStep);
+  __m256 code_step_offset = _mm256_set1_ps(8 * codePhaseStep);
+  __m256i ecode_idx, pcode_idx, lcode_idx;
+
+  __m256i sig, sinVal, cosVal, eVal, pVal, lVal;
+  __m256i acc_ie = _mm256_setzero_si256();
+  __m256i acc_ip = _mm256_setzero_si256();
+  __m256i acc_il = _mm256_setzero_si256();
+  __m256i acc_qe = _mm256_setzero_si256();
+  __m256i acc_qp = _mm256_setzero_si256();
+  __m256i acc_ql = _mm256_setzero_si256();
+
+  // First iteration happens outside the loop
+  carr_phase_base = _mm256_add_epi32(carr_phase_base, carr_step_base);
+  ecode_phase_base = _mm256_add_ps(ecode_phase_base, code_step_base);
+  pcode_phase_base = _mm256_add_ps(pcode_phase_base, code_step_base);
+  lcode_phase_base = _mm256_add_ps(lcode_phase_base, code_step_base);
+
+  for (inda = 0; inda < eight_points; inda++) {
+    // 1- Sign extend eight int8 samples into si32 lanes
+    sig = _mm256_cvtepi8_epi32(_mm_loadl_epi64((__m128i *)signal));
+
+    // 2- Carrier generation and wipeoff
+    carr_idx = _mm256_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT);
+    sinVal = _mm256_i32gather_epi32(sin_lut, carr_idx, 4);
+    cosVal = _mm256_i32gather_epi32(cos_lut, carr_idx, 4);
+    sinVal = _mm256_mullo_epi32(sinVal, sig);
+    cosVal = _mm256_mullo_epi32(cosVal, sig);
+
+    // 3- Early, Prompt and Late code generation
+    ecode_idx = _mm256_cvtps_epi32(ecode_phase_base);
+    pcode_idx = _mm256_cvtps_epi32(pcode_phase_base);
+    lcode_idx = _mm256_cvtps_epi32(lcode_phase_base);
+    eVal = _mm256_i32gather_epi32(cacode, ecode_idx, 4);
+    pVal = _mm256_i32gather_epi32(cacode, pcode_idx, 4);
+    lVal = _mm256_i32gather_epi32(cacode, lcode_idx, 4);
+
+    // 4- Correlation
+    acc_ie = _mm256_add_epi32(acc_ie, _mm256_mullo_epi32(eVal, sinVal));
+    acc_ip = _mm256_add_epi32(acc_ip, _mm256_mullo_epi32(pVal, sinVal));
+    acc_il = _mm256_add_epi32(acc_il, _mm256_mullo_epi32(lVal, sinVal));
+    acc_qe = _mm256_add_epi32(acc_qe, _mm256_mullo_epi32(eVal, cosVal));
+    acc_qp = _mm256_add_epi32(acc_qp, _mm256_mullo_epi32(pVal, cosVal));
+    acc_ql = _mm256_add_epi32(acc_ql, _mm256_mullo_epi32(lVal, cosVal));
+
+    // 5- Delta step
+    carr_phase_base = _mm256_add_epi32(carr_phase_base, carr_step_offset);
+    ecode_phase_base = _mm256_add_ps(ecode_phase_base, code_step_offset);
+    pcode_phase_base = _mm256_add_ps(pcode_phase_base, code_step_offset);
+    lcode_phase_base = _mm256_add_ps(lcode_phase_base, code_step_offset);
+
+    // 6- Update pointers
+    signal += 8;
+  }
+
+  _mm256_storeu_si256((__m256i *)tempBuffer[0], acc_ie);
+  _mm256_storeu_si256((__m256i *)tempBuffer[1], acc_ip);
+  _mm256_storeu_si256((__m256i *)tempBuffer[2], acc_il);
+  _mm256_storeu_si256((__m256i *)tempBuffer[3], acc_qe);
+  _mm256_storeu_si256((__m256i *)tempBuffer[4], acc_qp);
+  _mm256_storeu_si256((__m256i *)tempBuffer[5], acc_ql);
+
+  for (k = 0; k < 6; k++) {
+    returnValue[k] = tempBuffer[k][0];
+    returnValue[k] += tempBuffer[k][1];
+    returnValue[k] += tempBuffer[k][2];
+    returnValue[k] += tempBuffer[k][3];
+    returnValue[k] += tempBuffer[k][4];
+    returnValue[k] += tempBuffer[k][5];
+    returnValue[k] += tempBuffer[k][6];
+    returnValue[k] += tempBuffer[k][7];
+  }
+
+  inda = eight_points * 8;
+  nom_carr_phase_base += inda * nom_carr_step;
+
+  // Perform non SIMD leftover operations
+  for (; inda < blk_size; ++inda) {
+    nom_carr_idx =
+        (nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT) & GNSS_NCO_LUT_MASK;
+    sinMix = sin_lut[nom_carr_idx] * (*signal);
+    cosMix = cos_lut[nom_carr_idx] * (*signal++);
+    nom_carr_phase_base += nom_carr_step;
+
+    baseCode = (inda * codePhaseStep + remCodePhase);
+    pCodeIdx = (int32_t)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
+    eCodeIdx = (int32_t)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
+                   ? (baseCode - earlyLateSpc + 1)
+                   : (baseCode - earlyLateSpc);
+    lCodeIdx = (int32_t)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
+                   ? (baseCode + earlyLateSpc + 1)
+                   : (baseCode + earlyLateSpc);
+
+    returnValue[0] += cacode[eCodeIdx] * sinMix;
+    returnValue[1] += cacode[pCodeIdx] * sinMix;
+    returnValue[2] += cacode[lCodeIdx] * sinMix;
+    returnValue[3] += cacode[eCodeIdx] * cosMix;
+    returnValue[4] += cacode[pCodeIdx] * cosMix;
+    returnValue[5] += cacode[lCodeIdx] * cosMix;
+  }
+
+  *i_e = returnValue[0];
+  *i_p = returnValue[1];
+  *i_l = returnValue[2];
+  *q_e = returnValue[3];
+  *q_p = returnValue[4];
+  *q_l = returnValue[5];
+}
+
+/*!
+ *  \brief Wipes off the carrier of interleaved I/Q int8 samples as si32 types
+ *  \details Performs the full complex multiply of the baseband samples with the
+ * carrier replica, sig_sin = I * sin + Q * cos and sig_cos = I * cos - Q * sin,
+ * matching the real data convention where the in-phase arm is correlated
+ * against the sine. Carrier values are packed next to each other as int16 pairs
+ * so that a single madd_epi16 wipes off 8 samples per arm.
+ *  \pre Carrier replica values must fit in int16_t.
+ *  \param[out] sig_sin Baseband signal mixed with the sine carrier
+ *  \param[out] sig_cos Baseband signal mixed with the cosine carrier
+ *  \param[in] signal Interleaved I/Q samples, 2 * blk_size elements
+ *  \param[in] sin_nco Sine carrier replica
+ *  \param[in] cos_nco Cosine carrier replica
+ *  \param[in] blk_size Total number of complex samples
+ */
+void avx2_mix_iq8_si32(int32_t *sig_sin, int32_t *sig_cos, const int8_t *signal,
+                       const int32_t *sin_nco, const int32_t *cos_nco,
+                       const int32_t blk_size) {
+
+  int32_t inda;
+  const uint32_t eight_points = blk_size / 8;
+
+  // Important variable declarations
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i iq, sinVal, cosVal, sinCos, cosNegSin;
+
+  for (inda = 0; inda < eight_points; inda++) {
+
+    // Sign extend eight I/Q pairs into si16 lanes
+    iq = _mm256_cvtepi8_epi16(_mm_loadu_si128((__m128i *)signal));
+
+    // Pack the carrier as (sin, cos) and (cos, -sin) si16 pairs
+    sinVal = _mm256_loadu_si256((__m256i *)sin_nco);
+    cosVal = _mm256_loadu_si256((__m256i *)cos_nco);
+    sinCos = _mm256_blend_epi16(sinVal, _mm256_slli_epi32(cosVal, 16), 0xAA);
+    cosNegSin = _mm256_blend_epi16(
+        cosVal, _mm256_slli_epi32(_mm256_sub_epi32(zero, sinVal), 16), 0xAA);
+
+    // I * sin + Q * cos and I * cos - Q * sin
+    _mm256_storeu_si256((__m256i *)sig_sin, _mm256_madd_epi16(iq, sinCos));
+    _mm256_storeu_si256((__m256i *)sig_cos, _mm256_madd_epi16(iq, cosNegSin));
+
+    // Increment pointers
+    signal += 16;
+    sin_nco += 8;
+    cos_nco += 8;
+    sig_sin += 8;
+    sig_cos += 8;
+  }
+
+  // Perform non SIMD leftover operations
+  for (inda = eight_points * 8; inda < blk_size; inda++) {
+    *sig_sin++ = signal[0] * (*sin_nco) + signal[1] * (*cos_nco);
+    *sig_cos++ = signal[0] * (*cos_nco++) - signal[1] * (*sin_nco++);
+    signal += 2;
+  }
+}
+
+/*!
+ *  \brief Wipes off the carrier of interleaved I/Q int16 samples as si32 types
+ *  \details Performs the full complex multiply of the baseband samples with the
+ * carrier replica, sig_sin = I * sin + Q * cos and sig_cos = I * cos - Q * sin,
+ * matching the real data convention where the in-phase arm is correlated
+ * against the sine. Carrier values are packed next to each other as int16 pairs
+ * so that a single madd_epi16 wipes off 8 samples per arm.
+ *  \pre Carrier replica values must fit in int16_t.
+ *  \param[out] sig_sin Baseband signal mixed with the sine carrier
+ *  \param[out] sig_cos Baseband signal mixed with the cosine carrier
+ *  \param[in] signal Interleaved I/Q samples, 2 * blk_size elements
+ *  \param[in] sin_nco Sine carrier replica
+ *  \param[in] cos_nco Cosine carrier replica
+ *  \param[in] blk_size Total number of complex samples
+ */
+void avx2_mix_iq16_si32(int32_t *sig_sin, int32_t *sig_cos,
+                        const int16_t *signal, const int32_t *sin_nco,
+                        const int32_t *cos_nco, const int32_t blk_size) {
+
+  int32_t inda;
+  const uint32_t eight_points = blk_size / 8;
+
+  // Important variable declarations
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i iq, sinVal, cosVal, sinCos, cosNegSin;
+
+  for (inda = 0; inda < eight_points; inda++) {
+
+    // Load eight I/Q pairs as si16 lanes
+    iq = _mm256_loadu_si256((__m256i *)signal);
+
+    // Pack the carrier as (sin, cos) and (cos, -sin) si16 pairs
+    sinVal = _mm256_loadu_si256((__m256i *)sin_nco);
+    cosVal = _mm256_loadu_si256((__m256i *)cos_nco);
+    sinCos = _mm256_blend_epi16(sinVal, _mm256_slli_epi32(cosVal, 16), 0xAA);
+    cosNegSin = _mm256_blend_epi16(
+        cosVal, _mm256_slli_epi32(_mm256_sub_epi32(zero, sinVal), 16), 0xAA);
+
+    // I * sin + Q * cos and I * cos - Q * sin
+    _mm256_storeu_si256((__m256i *)sig_sin, _mm256_madd_epi16(iq, sinCos));
+    _mm256_storeu_si256((__m256i *)sig_cos, _mm256_madd_epi16(iq, cosNegSin));
+
+    // Increment pointers
+    signal += 16;
+    sin_nco += 8;
+    cos_nco += 8;
+    sig_sin += 8;
+    sig_cos += 8;
+  }
+
+  // Perform non SIMD leftover operations
+  for (inda = eight_points * 8; inda < blk_size; inda++) {
+    *sig_sin++ = signal[0] * (*sin_nco) + signal[1] * (*cos_nco);
+    *sig_cos++ = signal[0] * (*cos_nco++) - signal[1] * (*sin_nco++);
+    signal += 2;
+  }
+}
+
+/*!
+ *  \brief Wipes off the carrier, generates the Early, Prompt and Late codes and
+ * correlates them against interleaved I/Q int8 samples in a single pass as si32
+ * types
+ *  \details Complex input counterpart of avx2_fused_epl_si32(). The carrier is
+ * wiped off with the full complex multiply of avx2_mix_iq8_si32(), a single
+ * madd_epi16 per arm on (sin, cos) and (cos, -sin) si16 pairs.
+ *  \pre Carrier lookup table values must fit in int16_t.
+ *  \param[out] i_e Early in-phase correlation
+ *  \param[out] i_p Prompt in-phase correlation
+ *  \param[out] i_l Late in-phase correlation
+ *  \param[out] q_e Early quadrature correlation
+ *  \param[out] q_p Prompt quadrature correlation
+ *  \param[out] q_l Late quadrature correlation
+ *  \param[in] signal Interleaved I/Q samples, 2 * blk_size elements
+ *  \param[in] sin_lut Sine lookup table of 256 entries
+ *  \param[in] cos_lut Cosine lookup table of 256 entries
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of complex samples to correlate
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void avx2_fused_epl_iq8_si32(double *i_e, double *i_p, double *i_l, double *q_e,
+                             double *q_p, double *q_l, const int8_t *signal,
+                             const int32_t *sin_lut, const int32_t *cos_lut,
+                             const int32_t *cacode, const int32_t blk_size,
+                             const double rem_carr_phase,
+                             const double carr_freq,
+                             const double rem_code_phase,
+                             const double code_freq, const double samp_freq) {
+
+  int32_t inda, k;
+  const uint32_t eight_points = blk_size / 8;
+  int32_t tempBuffer[6][8];
+  int32_t returnValue[6] = {0, 0, 0, 0, 0, 0};
+  int32_t sinMix, cosMix;
+
+  // Carrier NCO declarations
+  const uint32_t nom_carr_step =
+      (uint32_t)(carr_freq * (4294967296.0 / samp_freq) + 0.5);
+  uint32_t nom_carr_phase_base =
+      (uint32_t)(rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+  uint32_t nom_carr_idx = 0;
+
+  __m256i carr_phase_base = _mm256_set1_epi32(nom_carr_phase_base);
+  __m256i carr_step_base =
+      _mm256_set_epi32(7 * nom_carr_step, 6 * nom_carr_step, 5 * nom_carr_step,
+                       4 * nom_carr_step, 3 * nom_carr_step, 2 * nom_carr_step,
+                       1 * nom_carr_step, 0 * nom_carr_step);
+  __m256i carr_step_offset = _mm256_set1_epi32(8 * nom_carr_step);
+  __m256i carr_idx;
+
+  // Code NCO declarations, kept in fl32 to match avx2_code_si32()
+  const float earlyLateSpc = 0.5;
+  const float remCodePhase = (float)rem_code_phase;
+  const float codePhaseStep = (float)code_freq / (float)samp_freq;
+  float baseCode;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  __m256 ecode_phase_base = _mm256_set1_ps(remCodePhase - earlyLateSpc + 0.5);
+  __m256 pcode_phase_base = _mm256_set1_ps(remCodePhase + 0.5);
+  __m256 lcode_phase_base = _mm256_set1_ps(remCodePhase + earlyLateSpc + 0.5);
+  __m256 code_step_base =
+      _mm256_set_ps(7 * codePhaseStep, 6 * codePhaseStep, 5 * codePhaseStep,
+                    4 * codePhaseStep, 3 * codePhaseStep, 2 * codePhaseStep,
+                    1 * codePhaseStep, 0 * codePhaseStep);
+  __m256 code_step_offset = _mm256_set1_ps(8 * codePhaseStep);
+  __m256i ecode_idx, pcode_idx, lcode_idx;
+
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i sig, sinVal, cosVal, sinCos, cosNegSin, eVal, pVal, lVal;
+  __m256i acc_ie = _mm256_setzero_si256();
+  __m256i acc_ip = _mm256_setzero_si256();
+  __m256i acc_il = _mm256_setzero_si256();
+  __m256i acc_qe = _mm256_setzero_si256();
+  __m256i acc_qp = _mm256_setzero_si256();
+  __m256i acc_ql = _mm256_setzero_si256();
+
+  // First iteration happens outside the loop
+  carr_phase_base = _mm256_add_epi32(carr_phase_base, carr_step_base);
+  ecode_phase_base = _mm256_add_ps(ecode_phase_base, code_step_base);
+  pcode_phase_base = _mm256_add_ps(pcode_phase_base, code_step_base);
+  lcode_phase_base = _mm256_add_ps(lcode_phase_base, code_step_base);
+
+  for (inda = 0; inda < eight_points; inda++) {
+    // 1- Sign extend eight I/Q pairs into si16 lanes
+    sig = _mm256_cvtepi8_epi16(_mm_loadu_si128((__m128i *)signal));
+
+    // 2- Carrier generation and complex wipeoff
+    carr_idx = _mm256_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT);
+    sinVal = _mm256_i32gather_epi32(sin_lut, carr_idx, 4);
+    cosVal = _mm256_i32gather_epi32(cos_lut, carr_idx, 4);
+    sinCos = _mm256_blend_epi16(sinVal, _mm256_slli_epi32(cosVal, 16), 0xAA);
+    cosNegSin = _mm256_blend_epi16(
+        cosVal, _mm256_slli_epi32(_mm256_sub_epi32(zero, sinVal), 16), 0xAA);
+    sinVal = _mm256_madd_epi16(sig, sinCos);
+    cosVal = _mm256_madd_epi16(sig, cosNegSin);
+
+    // 3- Early, Prompt and Late code generation
+    ecode_idx = _mm256_cvtps_epi32(ecode_phase_base);
+    pcode_idx = _mm256_cvtps_epi32(pcode_phase_base);
+    lcode_idx = _mm256_cvtps_epi32(lcode_phase_base);
+    eVal = _mm256_i32gather_epi32(cacode, ecode_idx, 4);
+    pVal = _mm256_i32gather_epi32(cacode, pcode_idx, 4);
+    lVal = _mm256_i32gather_epi32(cacode, lcode_idx, 4);
+
+    // 4- Correlation
+    acc_ie = _mm256_add_epi32(acc_ie, _mm256_mullo_epi32(eVal, sinVal));
+    acc_ip = _mm256_add_epi32(acc_ip, _mm256_mullo_epi32(pVal, sinVal));
+    acc_il = _mm256_add_epi32(acc_il, _mm256_mullo_epi32(lVal, sinVal));
+    acc_qe = _mm256_add_epi32(acc_qe, _mm256_mullo_epi32(eVal, cosVal));
+    acc_qp = _mm256_add_epi32(acc_qp, _mm256_mullo_epi32(pVal, cosVal));
+    acc_ql = _mm256_add_epi32(acc_ql, _mm256_mullo_epi32(lVal, cosVal));
+
+    // 5- Delta step
+    carr_phase_base = _mm256_add_epi32(carr_phase_base, carr_step_offset);
+    ecode_phase_base = _mm256_add_ps(ecode_phase_base, code_step_offset);
+    pcode_phase_base = _mm256_add_ps(pcode_phase_base, code_step_offset);
+    lcode_phase_base = _mm256_add_ps(lcode_phase_base, code_step_offset);
+
+    // 6- Update pointers
+    signal += 16;
+  }
+
+  _mm256_storeu_si256((__m256i *)tempBuffer[0], acc_ie);
+  _mm256_storeu_si256((__m256i *)tempBuffer[1], acc_ip);
+  _mm256_storeu_si256((__m256i *)tempBuffer[2], acc_il);
+  _mm256_storeu_si256((__m256i *)tempBuffer[3], acc_qe);
+  _mm256_storeu_si256((__m256i *)tempBuffer[4], acc_qp);
+  _mm256_storeu_si256((__m256i *)tempBuffer[5], acc_ql);
+
+  for (k = 0; k < 6; k++) {
+    returnValue[k] = tempBuffer[k][0];
+    returnValue[k] += tempBuffer[k][1];
+    returnValue[k] += tempBuffer[k][2];
+    returnValue[k] += tempBuffer[k][3];
+    returnValue[k] += tempBuffer[k][4];
+    returnValue[k] += tempBuffer[k][5];
+    returnValue[k] += tempBuffer[k][6];
+    returnValue[k] += tempBuffer[k][7];
+  }
+
+  inda = eight_points * 8;
+  nom_carr_phase_base += inda * nom_carr_step;
+
+  // Perform non SIMD leftover operations
+  for (; inda < blk_size; ++inda) {
+    nom_carr_idx =
+        (nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT) & GNSS_NCO_LUT_MASK;
+    sinMix = signal[0] * sin_lut[nom_carr_idx] +
+             signal[1] * cos_lut[nom_carr_idx];
+    cosMix = signal[0] * cos_lut[nom_carr_idx] -
+             signal[1] * sin_lut[nom_carr_idx];
+    signal += 2;
+    nom_carr_phase_base += nom_carr_step;
+
+    baseCode = (inda * codePhaseStep + remCodePhase);
+    pCodeIdx = (int32_t)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
+    eCodeIdx = (int32_t)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
+                   ? (baseCode - earlyLateSpc + 1)
+                   : (baseCode - earlyLateSpc);
+    lCodeIdx = (int32_t)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
+                   ? (baseCode + earlyLateSpc + 1)
+                   : (baseCode + earlyLateSpc);
+
+    returnValue[0] += cacode[eCodeIdx] * sinMix;
+    returnValue[1] += cacode[pCodeIdx] * sinMix;
+    returnValue[2] += cacode[lCodeIdx] * sinMix;
+    returnValue[3] += cacode[eCodeIdx] * cosMix;
+    returnValue[4] += cacode[pCodeIdx] * cosMix;
+    returnValue[5] += cacode[lCodeIdx] * cosMix;
+  }
+
+  *i_e = returnValue[0];
+  *i_p = returnValue[1];
+  *i_l = returnValue[2];
+  *q_e = returnValue[3];
+  *q_p = returnValue[4];
+  *q_l = returnValue[5];
+}
+
+/*!
+ *  \brief Correlates the in-phase and quadrature baseband signals against an
+ * arbitrary number of code replicas in a single pass as si32 types
+ *  \details Generalizes avx2_code_si32() and avx2_correlate_epl_si32() to
+ * num_taps replicas, each one delayed by tap_offsets[t] chips from the prompt
+ * replica. Every sample of sig_sin and sig_cos is loaded once and correlated
+ * against all the taps before moving on, so no code buffers are written and
+ * the memory traffic does not grow with the number of taps up to
+ * GNSS_MAX_TAPS.
+ *  \pre cacode[ceil(rem_code_phase + tap_offsets[t] + k * code_freq /
+ * samp_freq)] must be readable for every tap t and sample k. The 1025 entries
+ * caCode.bin layout only pads one chip on each side, which covers offsets
+ * within +/-0.5 chips. Wider tap spacings need a code padded with at least
+ * ceil(max|tap_offsets|) chips on each side, and cacode pointing to the entry
+ * that holds the last chip of the code, so that negative indices stay inside
+ * the buffer.
+ *  \param[out] i_taps In-phase correlation of each tap
+ *  \param[out] q_taps Quadrature correlation of each tap
+ *  \param[in] sig_sin Baseband signal mixed with the sine carrier
+ *  \param[in] sig_cos Baseband signal mixed with the cosine carrier
+ *  \param[in] cacode Padded satellite ranging code
+ *  \param[in] tap_offsets Offset of each tap from the prompt replica in chips
+ *  \param[in] num_taps Number of taps, nothing is correlated below 1. Up to
+ * GNSS_MAX_TAPS taps are correlated per pass over the signal
+ *  \param[in] blk_size Total number of samples to correlate
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void avx2_correlate_ntap_si32(double *i_taps, double *q_taps,
+                              const int32_t *sig_sin, const int32_t *sig_cos,
+                              const int32_t *cacode, const float *tap_offsets,
+                              const int32_t num_taps, const int32_t blk_size,
+                              const float rem_code_phase, const float code_freq,
+                              const float samp_freq) {
+
+  int32_t inda, t, k;
+  const int32_t taps = (num_taps < GNSS_MAX_TAPS) ? num_taps : GNSS_MAX_TAPS;
+  const uint32_t eight_points = blk_size / 8;
+  float codePhaseStep = code_freq / samp_freq;
+  float baseCode;
+  int32_t codeIdx;
+  int32_t tempBuffer[8];
+  int32_t returnValue[2];
+
+  if (num_taps < 1) {
+    return;
+  }
+
+  // Taps beyond the accumulators are correlated in further passes
+  if (num_taps > GNSS_MAX_TAPS) {
+    avx2_correlate_ntap_si32(
+        i_taps + GNSS_MAX_TAPS, q_taps + GNSS_MAX_TAPS, sig_sin, sig_cos,
+        cacode, tap_offsets + GNSS_MAX_TAPS, num_taps - GNSS_MAX_TAPS,
+        blk_size, rem_code_phase, code_freq, samp_freq);
+  }
+
+  // Accumulators of every tap are kept in L1 between iterations
+  __m256i acc_i[GNSS_MAX_TAPS], acc_q[GNSS_MAX_TAPS];
+
+  // Important variable declarations
+  __m256 code_phase_base = _mm256_set1_ps(rem_code_phase + 0.5);
+  __m256 code_step_base =
+      _mm256_set_ps(7 * codePhaseStep, 6 * codePhaseStep, 5 * codePhaseStep,
+                    4 * codePhaseStep, 3 * codePhaseStep, 2 * codePhaseStep,
+                    1 * codePhaseStep, 0 * codePhaseStep);
+  __m256 code_step_offset = _mm256_set1_ps(8 * codePhaseStep);
+  __m256i code_idx;
+  __m256i codeVal, sinVal, cosVal;
+
+  for (t = 0; t < taps; t++) {
+    acc_i[t] = _mm256_setzero_si256();
+    acc_q[t] = _mm256_setzero_si256();
+  }
+
+  // First iteration happens outside the loop
+  code_phase_base = _mm256_add_ps(code_phase_base, code_step_base);
+
+  for (inda = 0; inda < eight_points; inda++) {
+
+    // Load the baseband samples only once for all the taps
+    sinVal = _mm256_loadu_si256((__m256i *)sig_sin);
+    cosVal = _mm256_loadu_si256((__m256i *)sig_cos);
+
+    for (t = 0; t < taps; t++) {
+      // Obtain the code index of the tap and look in the code table
+      code_idx = _mm256_cvtps_epi32(
+          _mm256_add_ps(code_phase_base, _mm256_set1_ps(tap_offsets[t])));
+      codeVal = _mm256_i32gather_epi32(cacode, code_idx, 4);
+
+      // Multiply and accumulate both arms
+      acc_i[t] =
+          _mm256_add_epi32(acc_i[t], _mm256_mullo_epi32(codeVal, sinVal));
+      acc_q[t] =
+          _mm256_add_epi32(acc_q[t], _mm256_mullo_epi32(codeVal, cosVal));
+    }
+
+    // Delta step
+    code_phase_base = _mm256_add_ps(code_phase_base, code_step_offset);
+
+    // Increment pointers
+    sig_sin += 8;
+    sig_cos += 8;
+  }
+
+  for (t = 0; t < taps; t++) {
+    _mm256_storeu_si256((__m256i *)tempBuffer, acc_i[t]);
+    returnValue[0] = tempBuffer[0];
+    for (k = 1; k < 8; k++) {
+      returnValue[0] += tempBuffer[k];
+    }
+    _mm256_storeu_si256((__m256i *)tempBuffer, acc_q[t]);
+    returnValue[1] = tempBuffer[0];
+    for (k = 1; k < 8; k++) {
+      returnValue[1] += tempBuffer[k];
+    }
+
+    // Perform non SIMD leftover operations
+    for (inda = eight_points * 8; inda < blk_size; inda++) {
+      baseCode = inda * codePhaseStep + rem_code_phase + tap_offsets[t];
+      codeIdx = (int32_t)baseCode < baseCode ? (int32_t)baseCode + 1
+                                             : (int32_t)baseCode;
+      returnValue[0] += cacode[codeIdx] * sig_sin[inda - eight_points * 8];
+      returnValue[1] += cacode[codeIdx] * sig_cos[inda - eight_points * 8];
+    }
+
+    i_taps[t] = returnValue[0];
+    q_taps[t] = returnValue[1];
+  }
+}
+
+/*!
+ *  \brief Generates a NCO based on the Direct Lookup Table (DLUT) method.
+ *  \param[out] sig_nco Sinusoidal wave generated byt the NCO
+ *  \param[in] lut Lookup table to be use for the code
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave to
+ * be generated \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] samp_freq Sampling frequency of the signal to be generated
+ */
+void avx2_nco_fl32(float *sig_nco, const float *lut, const int32_t blk_size,
+                   const double rem_carr_phase, const double carr_freq,
+                   const double samp_freq) {
+  int32_t inda;
+  const uint32_t eight_points = blk_size / 8;
+  const uint32_t nom_carr_step =
+      (uint32_t)(carr_freq * (4294967296.0 / samp_freq) + 0.5);
+
+  // Declarations for serial implementation
+  uint32_t nom_carr_phase_base =
+      (uint32_t)(rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+  uint32_t nom_carr_idx = 0;
+
+  // Important variable declarations
+  __m256i carr_phase_base = _mm256_set1_epi32(nom_carr_phase_base);
+  __m256i carr_step_base =
+      _mm256_set_epi32(7 * nom_carr_step, 6 * nom_carr_step, 5 * nom_carr_step,
+                       4 * nom_carr_step, 3 * nom_carr_step, 2 * nom_carr_step,
+                       1 * nom_carr_step, 0 * nom_carr_step);
+  __m256i carr_idx = _mm256_set1_epi32(0);
+  __m256i hex_ff = _mm256_set1_epi32(GNSS_NCO_LUT_MASK);
+  __m256 nco;
+  __m256i carr_step_offset = _mm256_set1_epi32(8 * nom_carr_step);
+
+  // First iteration happens outside the loop
+  carr_phase_base = _mm256_add_epi32(carr_phase_base, carr_step_base);
+
+  for (inda = 0; inda < eight_points; inda++) {
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    carr_idx = _mm256_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT);
+    carr_idx = _mm256_and_si256(carr_idx, hex_ff);
+
+    // Look in lut
+    nco = _mm256_i32gather_ps(lut, carr_idx, 4);
+
+    // Delta step
+    // carr_step_base = _mm256_add_epi32(carr_step_base, carr_step_offset);
+    carr_phase_base = _mm256_add_epi32(carr_phase_base, carr_step_offset);
+
+    // 5- Store values in output buffer
+    _mm256_storeu_ps((float *)sig_nco, nco);
+
+    // 6- Update pointers
+    sig_nco += 8;
+  }
+
+  inda = eight_points * 8;
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base = (uint32_t)_mm256_extract_epi32(carr_phase_base, 0);
+
+  // generate buffer of output
+  for (; inda < blk_size; ++inda) {
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    nom_carr_idx =
+        (nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT) & GNSS_NCO_LUT_MASK;
+    // Look in lut
+    *sig_nco++ = lut[nom_carr_idx]; // get sample value from lut
+    // Delta step
+    nom_carr_phase_base += nom_carr_step;
+  }
+}
+
+/*!
+ *  \brief Generates a phase-continuous NCO based on the Parallel Lookup Table
+ * (PLUT) method
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table to be use for the code
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void avx2_nco_state_fl32(float *sig_nco, const float *lut,
+                         const int32_t blk_size, gnss_nco_t *nco) {
+  int32_t inda;
+  const uint32_t eight_points = blk_size / 8;
+  const uint32_t nom_carr_step = nco->step;
+  uint32_t nom_carr_phase_base = nco->phase;
+
+  // Lane k starts k samples ahead of the accumulator
+  __m256i carr_phase_base = _mm256_add_epi32(
+      _mm256_set1_epi32(nom_carr_phase_base),
+      _mm256_set_epi32(7 * nom_carr_step, 6 * nom_carr_step, 5 * nom_carr_step,
+                       4 * nom_carr_step, 3 * nom_carr_step, 2 * nom_carr_step,
+                       1 * nom_carr_step, 0 * nom_carr_step));
+  __m256i carr_step_offset = _mm256_set1_epi32(8 * nom_carr_step);
+  __m256i carr_idx;
+  __m256 sig;
+
+  for (inda = 0; inda < eight_points; inda++) {
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    carr_idx = _mm256_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT);
+
+    // Look in lut
+    sig = _mm256_i32gather_ps(lut, carr_idx, 4);
+
+    // Delta step
+    carr_phase_base = _mm256_add_epi32(carr_phase_base, carr_step_offset);
+
+    // Store values in output buffer
+    _mm256_storeu_ps(sig_nco, sig);
+    sig_nco += 8;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base = (uint32_t)_mm256_extract_epi32(carr_phase_base, 0);
+
+  for (inda = eight_points * 8; inda < blk_size; ++inda) {
+    *sig_nco++ = lut[nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT];
+    nom_carr_phase_base += nom_carr_step;
+  }
+  nco->phase = nom_carr_phase_base;
+}
+
+/*!
+ *  \brief Generates the sine and cosine carriers of a quadrature NCO
+ *  \details Both carriers come from one phase ramp over the interleaved table
+ * built by gnss_nco_sincos_lut_fl32(), the sine and cosine gathers sharing
+ * the same index vector.
+ *  \param[out] sig_sin Sine wave generated by the NCO
+ *  \param[out] sig_cos Cosine wave generated by the NCO
+ *  \param[in] sincos_lut Interleaved sine and cosine lookup table
+ *  \param[in] blk_size Total number of elements in the output vectors
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void avx2_nco_iq_fl32(float *sig_sin, float *sig_cos, const float *sincos_lut,
+                      const int32_t blk_size, gnss_nco_t *nco) {
+  int32_t inda;
+  const uint32_t eight_points = blk_size / 8;
+  const uint32_t nom_carr_step = nco->step;
+  uint32_t nom_carr_phase_base = nco->phase;
+
+  // Lane k starts k samples ahead of the accumulator
+  __m256i carr_phase_base = _mm256_add_epi32(
+      _mm256_set1_epi32(nom_carr_phase_base),
+      _mm256_set_epi32(7 * nom_carr_step, 6 * nom_carr_step, 5 * nom_carr_step,
+                       4 * nom_carr_step, 3 * nom_carr_step, 2 * nom_carr_step,
+                       1 * nom_carr_step, 0 * nom_carr_step));
+  __m256i carr_step_offset = _mm256_set1_epi32(8 * nom_carr_step);
+  __m256i carr_idx;
+  __m256 sin_val, cos_val;
+  uint32_t nom_carr_idx;
+
+  for (inda = 0; inda < eight_points; inda++) {
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    carr_idx = _mm256_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT);
+
+    // Sines sit at the even entries of the table and cosines at the odd ones
+    carr_idx = _mm256_slli_epi32(carr_idx, 1);
+    sin_val = _mm256_i32gather_ps(sincos_lut, carr_idx, 4);
+    cos_val = _mm256_i32gather_ps(sincos_lut + 1, carr_idx, 4);
+
+    // Delta step
+    carr_phase_base = _mm256_add_epi32(carr_phase_base, carr_step_offset);
+
+    // Store values in output buffers
+    _mm256_storeu_ps(sig_sin, sin_val);
+    _mm256_storeu_ps(sig_cos, cos_val);
+    sig_sin += 8;
+    sig_cos += 8;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base = (uint32_t)_mm256_extract_epi32(carr_phase_base, 0);
+
+  for (inda = eight_points * 8; inda < blk_size; ++inda) {
+    nom_carr_idx = nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT;
+    *sig_sin++ = sincos_lut[2 * nom_carr_idx];
+    *sig_cos++ = sincos_lut[2 * nom_carr_idx + 1];
+    nom_carr_phase_base += nom_carr_step;
+  }
+  nco->phase = nom_carr_phase_base;
+}
+
+/*!
+ *  \brief Generates a NCO from a small lookup table held in registers
+ *  \details Replaces the gather of the PLUT method with vpermd/vpermps on
+ * the 8 entry quarters of the table, blended on the upper index bits for
+ * tables of 16 or 32 entries. Outruns the gather for 8 and 16 entries, while
+ * 32 entries take four permutes per vector on the single shuffle port.
+ * Tables of 2 or 4 entries fill the low lanes of the first register only,
+ * and larger tables than 32 entries fall back to the scalar lookup.
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table of 1 << lut_bits entries
+ *  \param[in] lut_bits Phase bits indexing the table, 1 to 5
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void avx2_nco_perm_fl32(float *sig_nco, const float *lut,
+                        const int32_t lut_bits, const int32_t blk_size,
+                        gnss_nco_t *nco) {
+  int32_t inda;
+  const uint32_t eight_points = (lut_bits <= 5) ? blk_size / 8 : 0;
+  const int32_t shift = 32 - lut_bits;
+  const int32_t lut_size = 1 << lut_bits;
+  const uint32_t nom_carr_step = nco->step;
+  uint32_t nom_carr_phase_base = nco->phase;
+
+  // Lane k starts k samples ahead of the accumulator
+  __m256i carr_phase_base = _mm256_add_epi32(
+      _mm256_set1_epi32(nom_carr_phase_base),
+      _mm256_set_epi32(7 * nom_carr_step, 6 * nom_carr_step, 5 * nom_carr_step,
+                       4 * nom_carr_step, 3 * nom_carr_step, 2 * nom_carr_step,
+                       1 * nom_carr_step, 0 * nom_carr_step));
+  __m256i carr_step_offset = _mm256_set1_epi32(8 * nom_carr_step);
+  const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  __m256i carr_idx, mask;
+  __m256 sel, sig, sig_hi;
+  __m256 lut_reg[4];
+
+  // Keep the whole table in registers, 8 entries per register, loading only
+  // the entries the table has
+  for (int q = 0; q < 4; q++) {
+    lut_reg[q] = _mm256_setzero_ps();
+    if (8 * q < lut_size) {
+      mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(lut_size - 8 * q), lane);
+      lut_reg[q] = _mm256_maskload_ps(lut + 8 * q, mask);
+    }
+  }
+
+  for (inda = 0; inda < eight_points; inda++) {
+    // Obtain integer index in lut_bits:(32 - lut_bits) number
+    carr_idx = _mm256_srli_epi32(carr_phase_base, shift);
+
+    // Look in the lower 8 entries, the permute only reads index bits 0 to 2
+    sig = _mm256_permutevar8x32_ps(lut_reg[0], carr_idx);
+    if (lut_bits > 3) {
+      // Index bit 3 selects the next 8 entries
+      sel = _mm256_castsi256_ps(_mm256_slli_epi32(carr_idx, 28));
+      sig_hi = _mm256_permutevar8x32_ps(lut_reg[1], carr_idx);
+      sig = _mm256_blendv_ps(sig, sig_hi, sel);
+      if (lut_bits > 4) {
+        // Index bit 4 selects the upper 16 entries
+        sig_hi = _mm256_blendv_ps(
+            _mm256_permutevar8x32_ps(lut_reg[2], carr_idx),
+            _mm256_permutevar8x32_ps(lut_reg[3], carr_idx), sel);
+        sel = _mm256_castsi256_ps(_mm256_slli_epi32(carr_idx, 27));
+        sig = _mm256_blendv_ps(sig, sig_hi, sel);
+      }
+    }
+
+    // Delta step
+    carr_phase_base = _mm256_add_epi32(carr_phase_base, carr_step_offset);
+
+    // Store values in output buffer
+    _mm256_storeu_ps(sig_nco, sig);
+    sig_nco += 8;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base = (uint32_t)_mm256_extract_epi32(carr_phase_base, 0);
+
+  for (inda = eight_points * 8; inda < blk_size; ++inda) {
+    *sig_nco++ = lut[nom_carr_phase_base >> shift];
+    nom_carr_phase_base += nom_carr_step;
+  }
+  nco->phase = nom_carr_phase_base;
+}
+
+#pragma GCC push_options
+#pragma GCC target("fma")
+/*!
+ *  \brief Generates the sine and cosine carriers of a polynomial NCO
+ *  \details Computes both carriers with the range reduction and minimax
+ * polynomials of gnss_nco_sincos_poly(), evaluated with FMA, so no gathers or
+ * tables are involved. Keeps the gather ports free for the code replicas when
+ * many channels run at once, and follows the exact phase of every sample
+ * rather than the GNSS_NCO_LUT_BITS upper bits. Requires FMA on top of AVX2.
+ *  \param[out] sig_sin Sine wave generated by the NCO
+ *  \param[out] sig_cos Cosine wave generated by the NCO
+ *  \param[in] amplitude Peak amplitude of the carriers
+ *  \param[in] blk_size Total number of elements in the output vectors
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void avx2_nco_poly_fl32(float *sig_sin, float *sig_cos, const float amplitude,
+                        const int32_t blk_size, gnss_nco_t *nco) {
+  int32_t inda;
+  const uint32_t eight_points = blk_size / 8;
+  const uint32_t nom_carr_step = nco->step;
+  uint32_t nom_carr_phase_base = nco->phase;
+
+  // Lane k starts k samples ahead of the accumulator
+  __m256i carr_phase_base = _mm256_add_epi32(
+      _mm256_set1_epi32(nom_carr_phase_base),
+      _mm256_set_epi32(7 * nom_carr_step, 6 * nom_carr_step, 5 * nom_carr_step,
+                       4 * nom_carr_step, 3 * nom_carr_step, 2 * nom_carr_step,
+                       1 * nom_carr_step, 0 * nom_carr_step));
+  __m256i carr_step_offset = _mm256_set1_epi32(8 * nom_carr_step);
+  __m256i half_quadrant = _mm256_set1_epi32(0x20000000);
+  __m256i sign_bit = _mm256_set1_epi32(0x80000000);
+  __m256i one_epi32 = _mm256_set1_epi32(1);
+  __m256 rad_per_lsb = _mm256_set1_ps(GNSS_NCO_POLY_RAD_PER_LSB);
+  __m256 s1 = _mm256_set1_ps(GNSS_NCO_POLY_S1);
+  __m256 s2 = _mm256_set1_ps(GNSS_NCO_POLY_S2);
+  __m256 s3 = _mm256_set1_ps(GNSS_NCO_POLY_S3);
+  __m256 c0 = _mm256_set1_ps(GNSS_NCO_POLY_C0);
+  __m256 c1 = _mm256_set1_ps(GNSS_NCO_POLY_C1);
+  __m256 c2 = _mm256_set1_ps(GNSS_NCO_POLY_C2);
+  __m256 minus_half = _mm256_set1_ps(-0.5f);
+  __m256 one = _mm256_set1_ps(1.0f);
+  __m256 amp = _mm256_set1_ps(amplitude);
+  __m256i quadrant;
+  __m256 x, z, s, c, swap, sin_val, cos_val, sin_amp, cos_amp;
+
+  for (inda = 0; inda < eight_points; inda++) {
+    // Round the phase to the nearest quadrant, keep the remainder in radians
+    quadrant = _mm256_srli_epi32(
+        _mm256_add_epi32(carr_phase_base, half_quadrant), 30);
+    x = _mm256_mul_ps(
+        _mm256_cvtepi32_ps(_mm256_sub_epi32(carr_phase_base,
+                                            _mm256_slli_epi32(quadrant, 30))),
+        rad_per_lsb);
+    z = _mm256_mul_ps(x, x);
+
+    // sin(x) = x + x^3 * (s1 + z * (s2 + z * s3))
+    s = _mm256_fmadd_ps(_mm256_fmadd_ps(s3, z, s2), z, s1);
+    s = _mm256_fmadd_ps(_mm256_mul_ps(s, z), x, x);
+
+    // cos(x) = 1 - z / 2 + z^2 * (c0 + z * (c1 + z * c2))
+    c = _mm256_fmadd_ps(_mm256_fmadd_ps(c2, z, c1), z, c0);
+    c = _mm256_fmadd_ps(c, z, minus_half);
+    c = _mm256_fmadd_ps(c, z, one);
+
+    // Odd quadrants swap the outputs, quadrants 2 and 3 negate the sine and
+    // quadrants 1 and 2 the cosine
+    swap = _mm256_castsi256_ps(_mm256_slli_epi32(quadrant, 31));
+    sin_val = _mm256_blendv_ps(s, c, swap);
+    cos_val = _mm256_blendv_ps(c, s, swap);
+    sin_amp = _mm256_castsi256_ps(_mm256_xor_si256(
+        _mm256_castps_si256(amp),
+        _mm256_and_si256(_mm256_slli_epi32(quadrant, 30), sign_bit)));
+    cos_amp = _mm256_castsi256_ps(_mm256_xor_si256(
+        _mm256_castps_si256(amp),
+        _mm256_and_si256(
+            _mm256_slli_epi32(_mm256_add_epi32(quadrant, one_epi32), 30),
+            sign_bit)));
+
+    // Delta step
+    carr_phase_base = _mm256_add_epi32(carr_phase_base, carr_step_offset);
+
+    // Store values in output buffers
+    _mm256_storeu_ps(sig_sin, _mm256_mul_ps(sin_val, sin_amp));
+    _mm256_storeu_ps(sig_cos, _mm256_mul_ps(cos_val, cos_amp));
+    sig_sin += 8;
+    sig_cos += 8;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base = (uint32_t)_mm256_extract_epi32(carr_phase_base, 0);
+
+  for (inda = eight_points * 8; inda < blk_size; ++inda) {
+    gnss_nco_sincos_poly(nom_carr_phase_base, amplitude, sig_sin++, sig_cos++);
+    nom_carr_phase_base += nom_carr_step;
+  }
+  nco->phase = nom_carr_phase_base;
+}
+
+/*!
+ *  \brief Generates a NCO with a complex phase rotator
+ *  \details Four vectors hold the phasors exp(j * (rem_carr_phase + k * dphi))
+ * of 32 consecutive samples. Each step stores them and multiplies them by
+ * exp(j * 32 * dphi) with FMA, the four independent chains hiding the
+ * latency of the complex multiply, and every GNSS_NCO_ROT_RENORM samples they
+ * are pulled back to unit magnitude. The carrier then costs no gathers or
+ * tables. Takes the signature of avx2_nco_fl32(), the table only giving the
+ * amplitude through its quarter cycle entry.
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Sine lookup table of GNSS_NCO_LUT_SIZE entries
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] samp_freq Sampling frequency of the signal to be generated
+ */
+void avx2_nco_rot_fl32(float *sig_nco, const float *lut, const int32_t blk_size,
+                       const double rem_carr_phase, const double carr_freq,
+                       const double samp_freq) {
+  int32_t inda;
+  const uint32_t span_points = blk_size / 32;
+  const double carr_step = 2.0 * M_PI * carr_freq / samp_freq;
+  const float amplitude = lut[GNSS_NCO_LUT_SIZE / 4];
+  const double step_re = cos(carr_step), step_im = sin(carr_step);
+  const float nom_rot_re = (float)step_re;
+  const float nom_rot_im = (float)step_im;
+  double seed_re = cos(rem_carr_phase), seed_im = sin(rem_carr_phase), seed;
+  float lane_re[8], lane_im[8];
+  float nom_phasor_re, nom_phasor_im, tmp;
+
+  __m256 phasor_re[4], phasor_im[4], tmp_re, gain;
+  __m256 lane_rot_re = _mm256_set1_ps((float)cos(8 * carr_step));
+  __m256 lane_rot_im = _mm256_set1_ps((float)sin(8 * carr_step));
+  __m256 rot_re = _mm256_set1_ps((float)cos(32 * carr_step));
+  __m256 rot_im = _mm256_set1_ps((float)sin(32 * carr_step));
+  __m256 amp = _mm256_set1_ps(amplitude);
+  __m256 half = _mm256_set1_ps(0.5f);
+  __m256 three_halves = _mm256_set1_ps(1.5f);
+
+  // Lane k of vector v starts 8 * v + k samples ahead of the remainder,
+  // the first vector rotated in double precision from one lane to the next
+  for (int k = 0; k < 8; k++) {
+    lane_re[k] = (float)seed_re;
+    lane_im[k] = (float)seed_im;
+    seed = seed_re * step_re - seed_im * step_im;
+    seed_im = seed_re * step_im + seed_im * step_re;
+    seed_re = seed;
+  }
+  phasor_re[0] = _mm256_loadu_ps(lane_re);
+  phasor_im[0] = _mm256_loadu_ps(lane_im);
+  for (int v = 1; v < 4; v++) {
+    tmp_re = _mm256_mul_ps(phasor_im[v - 1], lane_rot_im);
+    phasor_re[v] = _mm256_fmsub_ps(phasor_re[v - 1], lane_rot_re, tmp_re);
+    phasor_im[v] = _mm256_mul_ps(phasor_im[v - 1], lane_rot_re);
+    phasor_im[v] =
+        _mm256_fmadd_ps(phasor_re[v - 1], lane_rot_im, phasor_im[v]);
+  }
+
+  for (inda = 0; inda < span_points; inda++) {
+    for (int v = 0; v < 4; v++) {
+      // Store values in output buffer
+      _mm256_storeu_ps(sig_nco + 8 * v, _mm256_mul_ps(phasor_im[v], amp));
+
+      // Rotate every lane by 32 samples
+      tmp_re = _mm256_mul_ps(phasor_im[v], rot_im);
+      tmp_re = _mm256_fmsub_ps(phasor_re[v], rot_re, tmp_re);
+      phasor_im[v] = _mm256_mul_ps(phasor_im[v], rot_re);
+      phasor_im[v] = _mm256_fmadd_ps(phasor_re[v], rot_im, phasor_im[v]);
+      phasor_re[v] = tmp_re;
+    }
+    sig_nco += 32;
+
+    // One Newton step of 1 / sqrt(|phasor|^2) keeps the magnitude at one
+    if ((inda + 1) % (GNSS_NCO_ROT_RENORM / 32) == 0) {
+      for (int v = 0; v < 4; v++) {
+        gain = _mm256_mul_ps(phasor_im[v], phasor_im[v]);
+        gain = _mm256_fmadd_ps(phasor_re[v], phasor_re[v], gain);
+        gain = _mm256_fnmadd_ps(half, gain, three_halves);
+        phasor_re[v] = _mm256_mul_ps(phasor_re[v], gain);
+        phasor_im[v] = _mm256_mul_ps(phasor_im[v], gain);
+      }
+    }
+  }
+
+  // Lane 0 of the first vector holds the phasor of the next sample
+  nom_phasor_re = _mm256_cvtss_f32(phasor_re[0]);
+  nom_phasor_im = _mm256_cvtss_f32(phasor_im[0]);
+
+  for (inda = span_points * 32; inda < blk_size; ++inda) {
+    *sig_nco++ = amplitude * nom_phasor_im;
+    tmp = nom_phasor_re * nom_rot_re - nom_phasor_im * nom_rot_im;
+    nom_phasor_im = nom_phasor_re * nom_rot_im + nom_phasor_im * nom_rot_re;
+    nom_phasor_re = tmp;
+  }
+}
+#pragma GCC pop_options
+
+/*!
+ *  \brief Generates a nominal NCO based on the direct lookup table approach
+ *  \param[out] sig_nco Sinusoidal wave generated byt the NCO
+ *  \param[in] lut Lookup table to be use for the code
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave to
+ * be generated \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] samp_freq Sampling frequency of the signal to be generated
+ */
+void avx2_nom_nco_fl32(float *sig_nco, const float *lut, const int32_t blk_size,
+                       const double rem_carr_phase, const double carr_freq,
+                       const double samp_freq) {
+
+  uint32_t carrPhaseBase =
+      (rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+  uint32_t carrStep = (carr_freq * (4294967296.0 / samp_freq) + 0.5);
+  uint32_t carrIndex = 0;
+  int32_t inda;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    carrIndex = (carrPhaseBase >> GNSS_NCO_LUT_SHIFT) & GNSS_NCO_LUT_MASK;
+
+    // Look in lut
+    sig_nco[inda] = lut[carrIndex];
+
+    // Delta step
+    carrPhaseBase += carrStep;
+  }
+}
+
+/*!
+ *  \brief Generates an Early, Late and Propmt CA code based on the direct
+ * lookup table approach \param[out] ecode Early CA code \param[out] pcode
+ * Prompt CA code \param[out] lcode Late CA code \param[in] cacode Nominal
+ * satellite ranging code \param[in] blk_size Total number of elements in the
+ * sig_nco vector \param[in] rem_code_phase Carrier phase remainder of the
+ * sinusoidal wave to be generated \param[in] code_freq Carrier frequency of the
+ * sinusoidal wave \param[in] samp_freq Sampling frequency of the signal to be
+ * generated
+ */
+void avx2_nom_code_fl32(float *ecode, float *pcode, float *lcode,
+                        const float *cacode, const int32_t blk_size,
+                        const double rem_code_phase, const double code_freq,
+                        const double samp_freq) {
+
+  int32_t inda;
+  double earlyLateSpc = 0.5;
+  double codePhaseStep = code_freq / samp_freq;
+  double baseCode;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    baseCode = (inda * codePhaseStep + rem_code_phase);
+    pCodeIdx = (float)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
+    eCodeIdx = (float)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
+                   ? (baseCode - earlyLateSpc + 1)
+                   : (baseCode - earlyLateSpc);
+    lCodeIdx = (float)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
+                   ? (baseCode + earlyLateSpc + 1)
+                   : (baseCode + earlyLateSpc);
+
+    ecode[inda] = *(cacode + eCodeIdx);
+    pcode[inda] = *(cacode + pCodeIdx);
+    lcode[inda] = *(cacode + lCodeIdx);
+  }
+}
+
+/*!
+ *  \brief Generates an Early, Late and Propmt CA code based on the Parallelized
+ * Lookup Table (PLUT) approach.
+ *  \param[out] ecode Early CA code
+ *  \param[out] pcode Prompt CA code
+ *  \param[out] lcode Late CA code
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in] rem_code_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] code_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] samp_freq Sampling frequency of the signal to be generated
+ */
+void avx2_code_fl32(float *ecode, float *pcode, float *lcode,
+                    const float *cacode, const int32_t blk_size,
+                    const float rem_code_phase, const float code_freq,
+                    const float samp_freq) {
+
+  int32_t inda;
+  const uint32_t eight_points = blk_size / 8;
+  float earlyLateSpc = 0.5;
+  float codePhaseStep = code_freq / samp_freq;
+  float baseCode;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  // Important variable declarations
+  __m256i sample_idx = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+  __m256i sample_offset = _mm256_set1_epi32(8);
+  __m256 code_step = _mm256_set1_ps(codePhaseStep);
+  __m256 code_phase_base = _mm256_set1_ps(rem_code_phase);
+  __m256 code_spacing = _mm256_set1_ps(earlyLateSpc);
+  __m256i code_idx[3];
+  __m256 elut, plut, llut;
+
+  for (inda = 0; inda < eight_points; inda++) {
+    // Chips of the replicas for the next 8 samples
+    avx2_code_idx(code_idx, sample_idx, code_step, code_phase_base,
+                  code_spacing);
+    sample_idx = _mm256_add_epi32(sample_idx, sample_offset);
+
+    // Look in lut
+    elut = _mm256_i32gather_ps(cacode, code_idx[0], 4);
+    plut = _mm256_i32gather_ps(cacode, code_idx[1], 4);
+    llut = _mm256_i32gather_ps(cacode, code_idx[2], 4);
+
+    // 5- Store values in output buffer
+    _mm256_storeu_ps(ecode, elut);
+    _mm256_storeu_ps(pcode, plut);
+    _mm256_storeu_ps(lcode, llut);
+
+    // 6- Update pointers
+    ecode += 8;
+    pcode += 8;
+    lcode += 8;
+  }
+
+  // generate buffer of output
+  for (inda = eight_points * 8; inda < blk_size; ++inda) {
+    baseCode = (inda * codePhaseStep + rem_code_phase);
+    pCodeIdx = (int32_t)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
+    eCodeIdx = (int32_t)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
+                   ? (baseCode - earlyLateSpc + 1)
+                   : (baseCode - earlyLateSpc);
+    lCodeIdx = (int32_t)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
+                   ? (baseCode + earlyLateSpc + 1)
+                   : (baseCode + earlyLateSpc);
+
+    *ecode++ = *(cacode + eCodeIdx);
+    *pcode++ = *(cacode + pCodeIdx);
+    *lcode++ = *(cacode + lCodeIdx);
+  }
+}
+
+/*!
+ *  \brief Wipes off the carrier, generates the Early, Prompt and Late codes and
+ * correlates them against the raw signal in a single pass as fl32 types
+ *  \details Fuses avx2_nco_fl32(), avx2_code_fl32(), the carrier mixing and
+ * avx2_correlate_epl_fl32(). Carrier and code replicas only live in
+ * registers, so no intermediate blk_size buffers are written or read back.
+ *  \param[out] i_e Early in-phase correlation
+ *  \param[out] i_p Prompt in-phase correlation
+ *  \param[out] i_l Late in-phase correlation
+ *  \param[out] q_e Early quadrature correlation
+ *  \param[out] q_p Prompt quadrature correlation
+ *  \param[out] q_l Late quadrature correlation
+ *  \param[in] signal Raw real signal samples
+ *  \param[in] sin_lut Sine lookup table of 256 entries
+ *  \param[in] cos_lut Cosine lookup table of 256 entries
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of samples to correlate
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void avx2_fused_epl_fl32(double *i_e, double *i_p, double *i_l, double *q_e,
+                         double *q_p, double *q_l, const int8_t *signal,
+                         const float *sin_lut, const float *cos_lut,
+                         const float *cacode, const int32_t blk_size,
+                         const double rem_carr_phase, const double carr_freq,
+                         const double rem_code_phase, const double code_freq,
+                         const double samp_freq) {
+
+  int32_t inda, k;
+  const uint32_t eight_points = blk_size / 8;
+  float tempBuffer[6][8];
+  float returnValue[6] = {0, 0, 0, 0, 0, 0};
+  float sinMix, cosMix;
+
+  // Carrier NCO declarations
+  const uint32_t nom_carr_step =
+      (uint32_t)(carr_freq * (4294967296.0 / samp_freq) + 0.5);
+  uint32_t nom_carr_phase_base =
+      (uint32_t)(rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+  uint32_t nom_carr_idx = 0;
+
+  __m256i carr_phase_base = _mm256_set1_epi32(nom_carr_phase_base);
+  __m256i carr_step_base =
+      _mm256_set_epi32(7 * nom_carr_step, 6 * nom_carr_step, 5 * nom_carr_step,
+                       4 * nom_carr_step, 3 * nom_carr_step, 2 * nom_carr_step,
+                       1 * nom_carr_step, 0 * nom_carr_step);
+  __m256i carr_step_offset = _mm256_set1_epi32(8 * nom_carr_step);
+  __m256i carr_idx;
+
+  // Code NCO declarations, kept in fl32 to match avx2_code_fl32()
+  const float earlyLateSpc = 0.5;
+  const float remCodePhase = (float)rem_code_phase;
+  const float codePhaseStep = (float)code_freq / (float)samp_freq;
+  float baseCode;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  __m256 ecode_phase_base = _mm256_set1_ps(remCodePhase - earlyLateSpc + 0.5);
+  __m256 pcode_phase_base = _mm256_set1_ps(remCodePhase + 0.5);
+  __m256 lcode_phase_base = _mm256_set1_ps(remCodePhase + earlyLateSpc + 0.5);
+  __m256 code_step_base =
+      _mm256_set_ps(7 * codePhaseStep, 6 * codePhaseStep, 5 * codePhaseStep,
+                    4 * codePhaseStep, 3 * codePhaseStep, 2 * codePhaseStep,
+                    1 * codePhaseStep, 0 * codePhaseStep);
+  __m256 code_step_offset = _mm256_set1_ps(8 * codePhaseStep);
+  __m256i ecode_idx, pcode_idx, lcode_idx;
+
+  __m256 sig, sinVal, cosVal, eVal, pVal, lVal;
+  __m256 acc_ie = _mm256_setzero_ps();
+  __m256 acc_ip = _mm256_setzero_ps();
+  __m256 acc_il = _mm256_setzero_ps();
+  __m256 acc_qe = _mm256_setzero_ps();
+  __m256 acc_qp = _mm256_setzero_ps();
+  __m256 acc_ql = _mm256_setzero_ps();
+
+  // First iteration happens outside the loop
+  carr_phase_base = _mm256_add_epi32(carr_phase_base, carr_step_base);
+  ecode_phase_base = _mm256_add_ps(ecode_phase_base, code_step_base);
+  pcode_phase_base = _mm256_add_ps(pcode_phase_base, code_step_base);
+  lcode_phase_base = _mm256_add_ps(lcode_phase_base, code_step_base);
+
+  for (inda = 0; inda < eight_points; inda++) {
+    // 1- Convert eight int8 samples into fl32 lanes
+    sig = _mm256_cvtepi32_ps(
+        _mm256_cvtepi8_epi32(_mm_loadl_epi64((__m128i *)signal)));
+
+    // 2- Carrier generation and wipeoff
+    carr_idx = _mm256_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT);
+    sinVal = _mm256_i32gather_ps(sin_lut, carr_idx, 4);
+    cosVal = _mm256_i32gather_ps(cos_lut, carr_idx, 4);
+    sinVal = _mm256_mul_ps(sinVal, sig);
+    cosVal = _mm256_mul_ps(cosVal, sig);
+
+    // 3- Early, Prompt and Late code generation
+    ecode_idx = _mm256_cvtps_epi32(ecode_phase_base);
+    pcode_idx = _mm256_cvtps_epi32(pcode_phase_base);
+    lcode_idx = _mm256_cvtps_epi32(lcode_phase_base);
+    eVal = _mm256_i32gather_ps(cacode, ecode_idx, 4);
+    pVal = _mm256_i32gather_ps(cacode, pcode_idx, 4);
+    lVal = _mm256_i32gather_ps(cacode, lcode_idx, 4);
+
+    // 4- Correlation
+    acc_ie = _mm256_add_ps(acc_ie, _mm256_mul_ps(eVal, sinVal));
+    acc_ip = _mm256_add_ps(acc_ip, _mm256_mul_ps(pVal, sinVal));
+    acc_il = _mm256_add_ps(acc_il, _mm256_mul_ps(lVal, sinVal));
+    acc_qe = _mm256_add_ps(acc_qe, _mm256_mul_ps(eVal, cosVal));
+    acc_qp = _mm256_add_ps(acc_qp, _mm256_mul_ps(pVal, cosVal));
+    acc_ql = _mm256_add_ps(acc_ql, _mm256_mul_ps(lVal, cosVal));
+
+    // 5- Delta step
+    carr_phase_base = _mm256_add_epi32(carr_phase_base, carr_step_offset);
+    ecode_phase_base = _mm256_add_ps(ecode_phase_base, code_step_offset);
+    pcode_phase_base = _mm256_add_ps(pcode_phase_base, code_step_offset);
+    lcode_phase_base = _mm256_add_ps(lcode_phase_base, code_step_offset);
+
+    // 6- Update pointers
+    signal += 8;
+  }
+
+  _mm256_storeu_ps(tempBuffer[0], acc_ie);
+  _mm256_storeu_ps(tempBuffer[1], acc_ip);
+  _mm256_storeu_ps(tempBuffer[2], acc_il);
+  _mm256_storeu_ps(tempBuffer[3], acc_qe);
+  _mm256_storeu_ps(tempBuffer[4], acc_qp);
+  _mm256_storeu_ps(tempBuffer[5], acc_ql);
+
+  for (k = 0; k < 6; k++) {
+    returnValue[k] = tempBuffer[k][0];
+    returnValue[k] += tempBuffer[k][1];
+    returnValue[k] += tempBuffer[k][2];
+    returnValue[k] += tempBuffer[k][3];
+    returnValue[k] += tempBuffer[k][4];
+    returnValue[k] += tempBuffer[k][5];
+    returnValue[k] += tempBuffer[k][6];
+    returnValue[k] += tempBuffer[k][7];
+  }
+
+  inda = eight_points * 8;
+  nom_carr_phase_base += inda * nom_carr_step;
+
+  // Perform non SIMD leftover operations
+  for (; inda < blk_size; ++inda) {
+    nom_carr_idx =
+        (nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT) & GNSS_NCO_LUT_MASK;
+    sinMix = sin_lut[nom_carr_idx] * (*signal);
+    cosMix = cos_lut[nom_carr_idx] * (*signal++);
+    nom_carr_phase_base += nom_carr_step;
+
+    baseCode = (inda * codePhaseStep + remCodePhase);
+    pCodeIdx = (int32_t)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
+    eCodeIdx = (int32_t)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
+                   ? (baseCode - earlyLateSpc + 1)
+                   : (baseCode - earlyLateSpc);
+    lCodeIdx = (int32_t)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
+                   ? (baseCode + earlyLateSpc + 1)
+                   : (baseCode + earlyLateSpc);
+
+    returnValue[0] += cacode[eCodeIdx] * sinMix;
+    returnValue[1] += cacode[pCodeIdx] * sinMix;
+    returnValue[2] += cacode[lCodeIdx] * sinMix;
+    returnValue[3] += cacode[eCodeIdx] * cosMix;
+    returnValue[4] += cacode[pCodeIdx] * cosMix;
+    returnValue[5] += cacode[lCodeIdx] * cosMix;
+  }
+
+  *i_e = returnValue[0];
+  *i_p = returnValue[1];
+  *i_l = returnValue[2];
+  *q_e = returnValue[3];
+  *q_p = returnValue[4];
+  *q_l = returnValue[5];
+}
+
+/*!
+ *  \brief Correlates the in-phase and quadrature baseband signals against an
+ * arbitrary number of code replicas in a single pass as fl32 types
+ *  \details Generalizes avx2_code_fl32() and avx2_correlate_epl_fl32() to
+ * num_taps replicas, each one delayed by tap_offsets[t] chips from the prompt
+ * replica. Every sample of sig_sin and sig_cos is loaded once and correlated
+ * against all the taps before moving on, so no code buffers are written and
+ * the memory traffic does not grow with the number of taps up to
+ * GNSS_MAX_TAPS.
+ *  \pre cacode[ceil(rem_code_phase + tap_offsets[t] + k * code_freq /
+ * samp_freq)] must be readable for every tap t and sample k. The 1025 entries
+ * caCode.bin layout only pads one chip on each side, which covers offsets
+ * within +/-0.5 chips. Wider tap spacings need a code padded with at least
+ * ceil(max|tap_offsets|) chips on each side, and cacode pointing to the entry
+ * that holds the last chip of the code, so that negative indices stay inside
+ * the buffer.
+ *  \param[out] i_taps In-phase correlation of each tap
+ *  \param[out] q_taps Quadrature correlation of each tap
+ *  \param[in] sig_sin Baseband signal mixed with the sine carrier
+ *  \param[in] sig_cos Baseband signal mixed with the cosine carrier
+ *  \param[in] cacode Padded satellite ranging code
+ *  \param[in] tap_offsets Offset of each tap from the prompt replica in chips
+ *  \param[in] num_taps Number of taps, nothing is correlated below 1. Up to
+ * GNSS_MAX_TAPS taps are correlated per pass over the signal
+ *  \param[in] blk_size Total number of samples to correlate
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void avx2_correlate_ntap_fl32(double *i_taps, double *q_taps,
+                              const float *sig_sin, const float *sig_cos,
+                              const float *cacode, const float *tap_offsets,
+                              const int32_t num_taps, const int32_t blk_size,
+                              const float rem_code_phase, const float code_freq,
+                              const float samp_freq) {
+
+  int32_t inda, t, k;
+  const int32_t taps = (num_taps < GNSS_MAX_TAPS) ? num_taps : GNSS_MAX_TAPS;
+  const uint32_t eight_points = blk_size / 8;
+  float codePhaseStep = code_freq / samp_freq;
+  float baseCode;
+  int32_t codeIdx;
+  float tempBuffer[8];
+  float returnValue[2];
+
+  if (num_taps < 1) {
+    return;
+  }
+
+  // Taps beyond the accumulators are correlated in further passes
+  if (num_taps > GNSS_MAX_TAPS) {
+    avx2_correlate_ntap_fl32(
+        i_taps + GNSS_MAX_TAPS, q_taps + GNSS_MAX_TAPS, sig_sin, sig_cos,
+        cacode, tap_offsets + GNSS_MAX_TAPS, num_taps - GNSS_MAX_TAPS,
+        blk_size, rem_code_phase, code_freq, samp_freq);
+  }
+
+  // Accumulators of every tap are kept in L1 between iterations
+  __m256 acc_i[GNSS_MAX_TAPS], acc_q[GNSS_MAX_TAPS];
+
+  // Important variable declarations
+  __m256 code_phase_base = _mm256_set1_ps(rem_code_phase + 0.5);
+  __m256 code_step_base =
+      _mm256_set_ps(7 * codePhaseStep, 6 * codePhaseStep, 5 * codePhaseStep,
+                    4 * codePhaseStep, 3 * codePhaseStep, 2 * codePhaseStep,
+                    1 * codePhaseStep, 0 * codePhaseStep);
+  __m256 code_step_offset = _mm256_set1_ps(8 * codePhaseStep);
+  __m256i code_idx;
+  __m256 codeVal, sinVal, cosVal;
+
+  for (t = 0; t < taps; t++) {
+    acc_i[t] = _mm256_setzero_ps();
+    acc_q[t] = _mm256_setzero_ps();
+  }
+
+  // First iteration happens outside the loop
+  code_phase_base = _mm256_add_ps(code_phase_base, code_step_base);
+
+  for (inda = 0; inda < eight_points; inda++) {
+
+    // Load the baseband samples only once for all the taps
+    sinVal = _mm256_loadu_ps(sig_sin);
+    cosVal = _mm256_loadu_ps(sig_cos);
+
+    for (t = 0; t < taps; t++) {
+      // Obtain the code index of the tap and look in the code table
+      code_idx = _mm256_cvtps_epi32(
+          _mm256_add_ps(code_phase_base, _mm256_set1_ps(tap_offsets[t])));
+      codeVal = _mm256_i32gather_ps(cacode, code_idx, 4);
+
+      // Multiply and accumulate both arms
+      acc_i[t] = _mm256_add_ps(acc_i[t], _mm256_mul_ps(codeVal, sinVal));
+      acc_q[t] = _mm256_add_ps(acc_q[t], _mm256_mul_ps(codeVal, cosVal));
+    }
+
+    // Delta step
+    code_phase_base = _mm256_add_ps(code_phase_base, code_step_offset);
+
+    // Increment pointers
+    sig_sin += 8;
+    sig_cos += 8;
+  }
+
+  for (t = 0; t < taps; t++) {
+    _mm256_storeu_ps(tempBuffer, acc_i[t]);
+    returnValue[0] = tempBuffer[0];
+    for (k = 1; k < 8; k++) {
+      returnValue[0] += tempBuffer[k];
+    }
+    _mm256_storeu_ps(tempBuffer, acc_q[t]);
+    returnValue[1] = tempBuffer[0];
+    for (k = 1; k < 8; k++) {
+      returnValue[1] += tempBuffer[k];
+    }
+
+    // Perform non SIMD leftover operations
+    for (inda = eight_points * 8; inda < blk_size; inda++) {
+      baseCode = inda * codePhaseStep + rem_code_phase + tap_offsets[t];
+      codeIdx = (int32_t)baseCode < baseCode ? (int32_t)baseCode + 1
+                                             : (int32_t)baseCode;
+      returnValue[0] += cacode[codeIdx] * sig_sin[inda - eight_points * 8];
+      returnValue[1] += cacode[codeIdx] * sig_cos[inda - eight_points * 8];
+    }
+
+    i_taps[t] = returnValue[0];
+    q_taps[t] = returnValue[1];
+  }
+}
+
+/*!
+ *  \brief Unpacks 2-bit sign/magnitude samples into one int8_t per sample
+ *  \details Each byte holds four samples, the first one in the two least
+ * significant bits. Within a sample the high bit is the sign and the low bit
+ * the magnitude, mapped to the usual front-end levels -3, -1, +1 and +3. The
+ * levels are looked up with a byte shuffle and interleaved back into sample
+ * order, producing 128 samples per 32 packed bytes.
+ *  \param[out] samples Unpacked samples, 4 * num_bytes elements
+ *  \param[in] packed Packed samples
+ *  \param[in] num_bytes Number of packed bytes
+ */
+void avx2_unpack_2bit_si8(int8_t *samples, const uint8_t *packed,
+                          const int32_t num_bytes) {
+
+  int32_t inda;
+  const uint32_t thirtysecond_points = num_bytes / 32;
+  const int8_t levels[4] = {1, 3, -1, -3};
+
+  // Important variable declarations
+  const __m256i lut = _mm256_setr_epi8(
+      1, 3, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, -1, -3, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m256i mask = _mm256_set1_epi8(0x03);
+  __m256i packedVal, s0, s1, s2, s3;
+  __m256i pairLo, pairHi, quadLo, quadHi;
+  __m256i q0, q1, q2, q3;
+
+  for (inda = 0; inda < thirtysecond_points; inda++) {
+
+    packedVal = _mm256_loadu_si256((__m256i *)packed);
+
+    // Look up the level of each of the four samples of every byte
+    s0 = _mm256_shuffle_epi8(lut, _mm256_and_si256(packedVal, mask));
+    s1 = _mm256_shuffle_epi8(
+        lut, _mm256_and_si256(_mm256_srli_epi16(packedVal, 2), mask));
+    s2 = _mm256_shuffle_epi8(
+        lut, _mm256_and_si256(_mm256_srli_epi16(packedVal, 4), mask));
+    s3 = _mm256_shuffle_epi8(
+        lut, _mm256_and_si256(_mm256_srli_epi16(packedVal, 6), mask));
+
+    // Interleave back into sample order, one 128-bit lane at a time
+    pairLo = _mm256_unpacklo_epi8(s0, s1);
+    pairHi = _mm256_unpackhi_epi8(s0, s1);
+    quadLo = _mm256_unpacklo_epi8(s2, s3);
+    quadHi = _mm256_unpackhi_epi8(s2, s3);
+    q0 = _mm256_unpacklo_epi16(pairLo, quadLo);
+    q1 = _mm256_unpackhi_epi16(pairLo, quadLo);
+    q2 = _mm256_unpacklo_epi16(pairHi, quadHi);
+    q3 = _mm256_unpackhi_epi16(pairHi, quadHi);
+
+    // Undo the lane split of the unpack instructions
+    _mm256_storeu_si256((__m256i *)samples,
+                        _mm256_permute2x128_si256(q0, q1, 0x20));
+    _mm256_storeu_si256((__m256i *)(samples + 32),
+                        _mm256_permute2x128_si256(q2, q3, 0x20));
+    _mm256_storeu_si256((__m256i *)(samples + 64),
+                        _mm256_permute2x128_si256(q0, q1, 0x31));
+    _mm256_storeu_si256((__m256i *)(samples + 96),
+                        _mm256_permute2x128_si256(q2, q3, 0x31));
+
+    // Increment pointers
+    packed += 32;
+    samples += 128;
+  }
 
-    // Delta step
-    carrPhaseBase += carrStep;
+  // Perform non SIMD leftover operations
+  for (inda = thirtysecond_points * 32; inda < num_bytes; inda++) {
+    samples[0] = levels[*packed & 0x03];
+    samples[1] = levels[(*packed >> 2) & 0x03];
+    samples[2] = levels[(*packed >> 4) & 0x03];
+    samples[3] = levels[(*packed >> 6) & 0x03];
+    packed++;
+    samples += 4;
   }
 }
 
 /*!
- *  \brief Generates an Early, Late and Propmt CA code based on the direct
- * lookup table approach \param[out] ecode Early CA code \param[out] pcode
- * Prompt CA code \param[out] lcode Late CA code \param[in] cacode Nominal
- * satellite ranging code \param[in] blk_size Total number of elements in the
- * sig_nco vector \param[in] rem_code_phase Carrier phase remainder of the
- * sinusoidal wave to be generated \param[in] code_freq Carrier frequency of the
- * sinusoidal wave \param[in] samp_freq Sampling frequency of the signal to be
- * generated
+ *  \brief Unpacks 4-bit sign/magnitude samples into one int8_t per sample
+ *  \details Each byte holds two samples, the first one in the low nibble.
+ * Within a sample bit 3 is the sign and bits 0-2 the magnitude, giving levels
+ * from -7 to +7. The levels are looked up with a byte shuffle and interleaved
+ * back into sample order, producing 64 samples per 32 packed bytes.
+ *  \param[out] samples Unpacked samples, 2 * num_bytes elements
+ *  \param[in] packed Packed samples
+ *  \param[in] num_bytes Number of packed bytes
  */
-void avx2_nom_code_fl32(float *ecode, float *pcode, float *lcode,
-                        const float *cacode, const int32_t blk_size,
-                        const double rem_code_phase, const double code_freq,
-                        const double samp_freq) {
+void avx2_unpack_4bit_si8(int8_t *samples, const uint8_t *packed,
+                          const int32_t num_bytes) {
 
   int32_t inda;
-  double earlyLateSpc = 0.5;
-  double codePhaseStep = code_freq / samp_freq;
-  double baseCode;
-  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+  const uint32_t thirtysecond_points = num_bytes / 32;
+  const int8_t levels[16] = {0, 1,  2,  3,  4,  5,  6,  7,
+                             0, -1, -2, -3, -4, -5, -6, -7};
 
-  // for each sample
-  for (inda = 0; inda < blk_size; ++inda) {
-    baseCode = (inda * codePhaseStep + rem_code_phase);
-    pCodeIdx = (float)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
-    eCodeIdx = (float)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
-                   ? (baseCode - earlyLateSpc + 1)
-                   : (baseCode - earlyLateSpc);
-    lCodeIdx = (float)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
-                   ? (baseCode + earlyLateSpc + 1)
-                   : (baseCode + earlyLateSpc);
+  // Important variable declarations
+  const __m256i lut = _mm256_setr_epi8(
+      0, 1, 2, 3, 4, 5, 6, 7, 0, -1, -2, -3, -4, -5, -6, -7, 0, 1, 2, 3, 4, 5,
+      6, 7, 0, -1, -2, -3, -4, -5, -6, -7);
+  const __m256i mask = _mm256_set1_epi8(0x0F);
+  __m256i packedVal, s0, s1, pairLo, pairHi;
 
-    ecode[inda] = *(cacode + eCodeIdx);
-    pcode[inda] = *(cacode + pCodeIdx);
-    lcode[inda] = *(cacode + lCodeIdx);
+  for (inda = 0; inda < thirtysecond_points; inda++) {
+
+    packedVal = _mm256_loadu_si256((__m256i *)packed);
+
+    // Look up the level of both samples of every byte
+    s0 = _mm256_shuffle_epi8(lut, _mm256_and_si256(packedVal, mask));
+    s1 = _mm256_shuffle_epi8(
+        lut, _mm256_and_si256(_mm256_srli_epi16(packedVal, 4), mask));
+
+    // Interleave back into sample order and undo the lane split
+    pairLo = _mm256_unpacklo_epi8(s0, s1);
+    pairHi = _mm256_unpackhi_epi8(s0, s1);
+    _mm256_storeu_si256((__m256i *)samples,
+                        _mm256_permute2x128_si256(pairLo, pairHi, 0x20));
+    _mm256_storeu_si256((__m256i *)(samples + 32),
+                        _mm256_permute2x128_si256(pairLo, pairHi, 0x31));
+
+    // Increment pointers
+    packed += 32;
+    samples += 64;
+  }
+
+  // Perform non SIMD leftover operations
+  for (inda = thirtysecond_points * 32; inda < num_bytes; inda++) {
+    samples[0] = levels[*packed & 0x0F];
+    samples[1] = levels[*packed >> 4];
+    packed++;
+    samples += 2;
   }
 }
 
 /*!
- *  \brief Generates an Early, Late and Propmt CA code based on the Parallelized
- * Lookup Table (PLUT) approach.
- *  \param[out] ecode Early CA code
- *  \param[out] pcode Prompt CA code
- *  \param[out] lcode Late CA code
- *  \param[in] cacode Nominal satellite ranging code
- *  \param[in] blk_size Total number of elements in the sig_nco vector
- *  \param[in] rem_code_phase Carrier phase remainder of the sinusoidal wave
- *  \param[in] code_freq Carrier frequency of the sinusoidal wave
- *  \param[in] samp_freq Sampling frequency of the signal to be generated
+ *  \brief Packs the signs of int8_t samples into 64-bit words
+ *  \details Same layout as nom_pack_sign_si8(). A byte movemask turns 32
+ * samples into 32 sign bits, two of them filling a word.
+ *  \param[out] bits Packed signs, (num_points + 63) / 64 words
+ *  \param[in] samples Samples to pack
+ *  \param[in] num_points Number of samples
  */
-void avx2_code_fl32(float *ecode, float *pcode, float *lcode,
-                    const float *cacode, const int32_t blk_size,
-                    const float rem_code_phase, const float code_freq,
-                    const float samp_freq) {
+void avx2_pack_sign_si8(uint64_t *bits, const int8_t *samples,
+                        const int32_t num_points) {
 
   int32_t inda;
-  const uint32_t eight_points = blk_size / 8;
-  float earlyLateSpc = 0.5;
-  float codePhaseStep = code_freq / samp_freq;
-  float baseCode;
-  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+  const uint32_t sixtyfourth_points = num_points / 64;
+  uint32_t lo, hi;
+
+  for (inda = 0; inda < sixtyfourth_points; inda++) {
+    lo = (uint32_t)_mm256_movemask_epi8(
+        _mm256_loadu_si256((const __m256i *)samples));
+    hi = (uint32_t)_mm256_movemask_epi8(
+        _mm256_loadu_si256((const __m256i *)(samples + 32)));
+    *bits++ = ((uint64_t)hi << 32) | lo;
+    samples += 64;
+  }
 
-  // Important variable declarations
-  __m256 ecode_phase_base = _mm256_set1_ps(rem_code_phase - earlyLateSpc + 0.5);
-  __m256 pcode_phase_base = _mm256_set1_ps(rem_code_phase + 0.5);
-  __m256 lcode_phase_base = _mm256_set1_ps(rem_code_phase + earlyLateSpc + 0.5);
+  // Perform non SIMD leftover operations
+  if (num_points % 64) {
+    *bits = 0;
+    for (inda = 0; inda < num_points % 64; inda++) {
+      *bits |= (uint64_t)(samples[inda] < 0) << inda;
+    }
+  }
+}
 
-  __m256 code_step_base =
-      _mm256_set_ps(7 * codePhaseStep, 6 * codePhaseStep, 5 * codePhaseStep,
-                    4 * codePhaseStep, 3 * codePhaseStep, 2 * codePhaseStep,
-                    1 * codePhaseStep, 0 * codePhaseStep);
-  __m256i ecode_idx = _mm256_set1_epi32(0);
-  __m256i pcode_idx = _mm256_set1_epi32(0);
-  __m256i lcode_idx = _mm256_set1_epi32(0);
+/*!
+ *  \brief Packs the signs of int32_t samples into 64-bit words
+ *  \details Same layout as nom_pack_sign_si8(). A float movemask turns 8
+ * samples into 8 sign bits, eight of them filling a word.
+ *  \param[out] bits Packed signs, (num_points + 63) / 64 words
+ *  \param[in] samples Samples to pack
+ *  \param[in] num_points Number of samples
+ */
+void avx2_pack_sign_si32(uint64_t *bits, const int32_t *samples,
+                         const int32_t num_points) {
 
-  __m256 elut, plut, llut;
-  __m256 code_step_offset = _mm256_set1_ps(8 * codePhaseStep);
+  int32_t inda;
+  const uint32_t sixtyfourth_points = num_points / 64;
+  uint64_t word;
+
+  for (inda = 0; inda < sixtyfourth_points; inda++) {
+    word = 0;
+    for (int k = 0; k < 8; k++) {
+      word |= (uint64_t)_mm256_movemask_ps(
+                  _mm256_loadu_ps((const float *)(samples + 8 * k)))
+              << (8 * k);
+    }
+    *bits++ = word;
+    samples += 64;
+  }
 
-  // First iteration happens outside the loop
-  ecode_phase_base = _mm256_add_ps(ecode_phase_base, code_step_base);
-  pcode_phase_base = _mm256_add_ps(pcode_phase_base, code_step_base);
-  lcode_phase_base = _mm256_add_ps(lcode_phase_base, code_step_base);
+  // Perform non SIMD leftover operations
+  if (num_points % 64) {
+    *bits = 0;
+    for (inda = 0; inda < num_points % 64; inda++) {
+      *bits |= (uint64_t)(samples[inda] < 0) << inda;
+    }
+  }
+}
 
-  for (inda = 0; inda < eight_points; inda++) {
-    // Obtain integer index in 8:24 number
-    ecode_idx = _mm256_cvtps_epi32(ecode_phase_base);
-    pcode_idx = _mm256_cvtps_epi32(pcode_phase_base);
-    lcode_idx = _mm256_cvtps_epi32(lcode_phase_base);
+/*!
+ *  \brief Correlates two vectors of packed signs
+ *  \details Same result as nom_xor_and_acc_b1(). AVX2 has no vector
+ * popcount, so the bits set in a XOR b are counted per nibble with a byte
+ * shuffle and summed into 64-bit lanes with a sum of absolute differences,
+ * 256 samples per iteration.
+ *  \param[in] a_bits First vector of packed signs
+ *  \param[in] b_bits Second vector of packed signs
+ *  \param[in] num_points Number of points in each vector
+ *  \return Correlation of the +1/-1 values
+ */
+int32_t avx2_xor_and_acc_b1(const uint64_t *a_bits, const uint64_t *b_bits,
+                            const int32_t num_points) {
 
-    // Look in lut
-    elut = _mm256_i32gather_ps(cacode, ecode_idx, 4);
-    plut = _mm256_i32gather_ps(cacode, pcode_idx, 4);
-    llut = _mm256_i32gather_ps(cacode, lcode_idx, 4);
+  int32_t inda;
+  const int32_t num_words = num_points / 64;
+  const uint32_t quarter_words = num_words / 4;
+  int64_t flips;
+  int64_t lanes[4];
+  uint64_t diff;
+
+  const __m256i lut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2,
+                                       3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2,
+                                       2, 3, 2, 3, 3, 4);
+  const __m256i mask = _mm256_set1_epi8(0x0F);
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i diffVal, count;
+  __m256i accumulator = _mm256_setzero_si256();
 
-    // Delta step
-    ecode_phase_base = _mm256_add_ps(ecode_phase_base, code_step_offset);
-    pcode_phase_base = _mm256_add_ps(pcode_phase_base, code_step_offset);
-    lcode_phase_base = _mm256_add_ps(lcode_phase_base, code_step_offset);
+  for (inda = 0; inda < quarter_words; inda++) {
+    diffVal = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)a_bits),
+                               _mm256_loadu_si256((const __m256i *)b_bits));
 
-    // 5- Store values in output buffer
-    _mm256_storeu_ps((float *)ecode, elut);
-    _mm256_storeu_ps((float *)pcode, plut);
-    _mm256_storeu_ps((float *)lcode, llut);
+    // Bits set in the low and high nibble of every byte
+    count = _mm256_add_epi8(
+        _mm256_shuffle_epi8(lut, _mm256_and_si256(diffVal, mask)),
+        _mm256_shuffle_epi8(
+            lut, _mm256_and_si256(_mm256_srli_epi16(diffVal, 4), mask)));
+    accumulator = _mm256_add_epi64(accumulator, _mm256_sad_epu8(count, zero));
 
-    // 6- Update pointers
-    ecode += 8;
-    pcode += 8;
-    lcode += 8;
+    // Increment pointers
+    a_bits += 4;
+    b_bits += 4;
   }
 
-  inda = eight_points * 8;
-
-  // generate buffer of output
-  for (; inda < blk_size; ++inda) {
-    baseCode = (inda * codePhaseStep + rem_code_phase);
-    pCodeIdx = (float)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
-    eCodeIdx = (float)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
-                   ? (baseCode - earlyLateSpc + 1)
-                   : (baseCode - earlyLateSpc);
-    lCodeIdx = (float)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
-                   ? (baseCode + earlyLateSpc + 1)
-                   : (baseCode + earlyLateSpc);
+  _mm256_storeu_si256((__m256i *)lanes, accumulator);
+  flips = lanes[0] + lanes[1] + lanes[2] + lanes[3];
 
-    ecode[inda] = *(cacode + eCodeIdx);
-    pcode[inda] = *(cacode + pCodeIdx);
-    lcode[inda] = *(cacode + lCodeIdx);
+  // Perform non SIMD leftover operations
+  for (inda = quarter_words * 4; inda < num_words; inda++) {
+    flips += __builtin_popcountll(*a_bits++ ^ *b_bits++);
+  }
+  if (num_points % 64) {
+    diff = (*a_bits ^ *b_bits) & ((1ull << (num_points % 64)) - 1);
+    flips += __builtin_popcountll(diff);
   }
+  return num_points - 2 * (int32_t)flips;
 }
 
 /*!
@@ -537,6 +3022,111 @@ static inline float avx2_mul_and_acc_fl32(const float *aVector,
   return returnValue;
 }
 
+/*!
+ *  \brief Correlates the Early, Prompt and Late codes against the in-phase and
+ * quadrature baseband signals in a single pass as fl32 types
+ *  \details Equivalent to six avx2_mul_and_acc_fl32() calls, but every input
+ * vector is streamed through the cache only once.
+ *  \param[out] i_e Early in-phase correlation
+ *  \param[out] i_p Prompt in-phase correlation
+ *  \param[out] i_l Late in-phase correlation
+ *  \param[out] q_e Early quadrature correlation
+ *  \param[out] q_p Prompt quadrature correlation
+ *  \param[out] q_l Late quadrature correlation
+ *  \param[in] ecode Early CA code
+ *  \param[in] pcode Prompt CA code
+ *  \param[in] lcode Late CA code
+ *  \param[in] sig_sin Baseband signal mixed with the sine carrier
+ *  \param[in] sig_cos Baseband signal mixed with the cosine carrier
+ *  \param[in] num_points Number of points in each vector
+ */
+static inline void
+avx2_correlate_epl_fl32(double *i_e, double *i_p, double *i_l, double *q_e,
+                        double *q_p, double *q_l, const float *ecode,
+                        const float *pcode, const float *lcode,
+                        const float *sig_sin, const float *sig_cos,
+                        uint32_t num_points) {
+
+  uint32_t number = 0;
+  const uint32_t eigthPoints = num_points / 8;
+  float tempBuffer[6][8];
+  float returnValue[6] = {0, 0, 0, 0, 0, 0};
+  int32_t k;
+
+  __m256 eVal, pVal, lVal, sinVal, cosVal;
+  __m256 acc_ie = _mm256_setzero_ps();
+  __m256 acc_ip = _mm256_setzero_ps();
+  __m256 acc_il = _mm256_setzero_ps();
+  __m256 acc_qe = _mm256_setzero_ps();
+  __m256 acc_qp = _mm256_setzero_ps();
+  __m256 acc_ql = _mm256_setzero_ps();
+
+  for (; number < eigthPoints; number++) {
+
+    // Load every input only once per iteration
+    eVal = _mm256_loadu_ps(ecode);
+    pVal = _mm256_loadu_ps(pcode);
+    lVal = _mm256_loadu_ps(lcode);
+    sinVal = _mm256_loadu_ps(sig_sin);
+    cosVal = _mm256_loadu_ps(sig_cos);
+
+    // In-phase arm
+    acc_ie = _mm256_add_ps(acc_ie, _mm256_mul_ps(eVal, sinVal));
+    acc_ip = _mm256_add_ps(acc_ip, _mm256_mul_ps(pVal, sinVal));
+    acc_il = _mm256_add_ps(acc_il, _mm256_mul_ps(lVal, sinVal));
+
+    // Quadrature arm
+    acc_qe = _mm256_add_ps(acc_qe, _mm256_mul_ps(eVal, cosVal));
+    acc_qp = _mm256_add_ps(acc_qp, _mm256_mul_ps(pVal, cosVal));
+    acc_ql = _mm256_add_ps(acc_ql, _mm256_mul_ps(lVal, cosVal));
+
+    // Increment pointers
+    ecode += 8;
+    pcode += 8;
+    lcode += 8;
+    sig_sin += 8;
+    sig_cos += 8;
+  }
+
+  _mm256_storeu_ps(tempBuffer[0], acc_ie);
+  _mm256_storeu_ps(tempBuffer[1], acc_ip);
+  _mm256_storeu_ps(tempBuffer[2], acc_il);
+  _mm256_storeu_ps(tempBuffer[3], acc_qe);
+  _mm256_storeu_ps(tempBuffer[4], acc_qp);
+  _mm256_storeu_ps(tempBuffer[5], acc_ql);
+
+  for (k = 0; k < 6; k++) {
+    returnValue[k] = tempBuffer[k][0];
+    returnValue[k] += tempBuffer[k][1];
+    returnValue[k] += tempBuffer[k][2];
+    returnValue[k] += tempBuffer[k][3];
+    returnValue[k] += tempBuffer[k][4];
+    returnValue[k] += tempBuffer[k][5];
+    returnValue[k] += tempBuffer[k][6];
+    returnValue[k] += tempBuffer[k][7];
+  }
+
+  // Perform non SIMD leftover operations
+  number = eigthPoints * 8;
+  for (; number < num_points; number++) {
+    returnValue[0] += (*ecode) * (*sig_sin);
+    returnValue[1] += (*pcode) * (*sig_sin);
+    returnValue[2] += (*lcode) * (*sig_sin);
+    returnValue[3] += (*ecode++) * (*sig_cos);
+    returnValue[4] += (*pcode++) * (*sig_cos);
+    returnValue[5] += (*lcode++) * (*sig_cos);
+    sig_sin++;
+    sig_cos++;
+  }
+
+  *i_e = returnValue[0];
+  *i_p = returnValue[1];
+  *i_l = returnValue[2];
+  *q_e = returnValue[3];
+  *q_p = returnValue[4];
+  *q_l = returnValue[5];
+}
+
 /*!
  *  \brief Multiply point to point two vectors together as a fl32 type
  * \param[out] cvector Product of point to point multiplication
@@ -641,6 +3231,111 @@ static inline double avx2_mul_and_acc_si32(const int32_t *aVector,
   return returnValue;
 }
 
+/*!
+ *  \brief Correlates the Early, Prompt and Late codes against the in-phase and
+ * quadrature baseband signals in a single pass as si32 types
+ *  \details Equivalent to six avx2_mul_and_acc_si32() calls, but every input
+ * vector is streamed through the cache only once.
+ *  \param[out] i_e Early in-phase correlation
+ *  \param[out] i_p Prompt in-phase correlation
+ *  \param[out] i_l Late in-phase correlation
+ *  \param[out] q_e Early quadrature correlation
+ *  \param[out] q_p Prompt quadrature correlation
+ *  \param[out] q_l Late quadrature correlation
+ *  \param[in] ecode Early CA code
+ *  \param[in] pcode Prompt CA code
+ *  \param[in] lcode Late CA code
+ *  \param[in] sig_sin Baseband signal mixed with the sine carrier
+ *  \param[in] sig_cos Baseband signal mixed with the cosine carrier
+ *  \param[in] num_points Number of points in each vector
+ */
+static inline void
+avx2_correlate_epl_si32(double *i_e, double *i_p, double *i_l, double *q_e,
+                        double *q_p, double *q_l, const int32_t *ecode,
+                        const int32_t *pcode, const int32_t *lcode,
+                        const int32_t *sig_sin, const int32_t *sig_cos,
+                        uint32_t num_points) {
+
+  uint32_t number = 0;
+  const uint32_t eigthPoints = num_points / 8;
+  int32_t tempBuffer[6][8];
+  int32_t returnValue[6] = {0, 0, 0, 0, 0, 0};
+  int32_t k;
+
+  __m256i eVal, pVal, lVal, sinVal, cosVal;
+  __m256i acc_ie = _mm256_setzero_si256();
+  __m256i acc_ip = _mm256_setzero_si256();
+  __m256i acc_il = _mm256_setzero_si256();
+  __m256i acc_qe = _mm256_setzero_si256();
+  __m256i acc_qp = _mm256_setzero_si256();
+  __m256i acc_ql = _mm256_setzero_si256();
+
+  for (; number < eigthPoints; number++) {
+
+    // Load every input only once per iteration
+    eVal = _mm256_loadu_si256((__m256i *)ecode);
+    pVal = _mm256_loadu_si256((__m256i *)pcode);
+    lVal = _mm256_loadu_si256((__m256i *)lcode);
+    sinVal = _mm256_loadu_si256((__m256i *)sig_sin);
+    cosVal = _mm256_loadu_si256((__m256i *)sig_cos);
+
+    // In-phase arm
+    acc_ie = _mm256_add_epi32(acc_ie, _mm256_mullo_epi32(eVal, sinVal));
+    acc_ip = _mm256_add_epi32(acc_ip, _mm256_mullo_epi32(pVal, sinVal));
+    acc_il = _mm256_add_epi32(acc_il, _mm256_mullo_epi32(lVal, sinVal));
+
+    // Quadrature arm
+    acc_qe = _mm256_add_epi32(acc_qe, _mm256_mullo_epi32(eVal, cosVal));
+    acc_qp = _mm256_add_epi32(acc_qp, _mm256_mullo_epi32(pVal, cosVal));
+    acc_ql = _mm256_add_epi32(acc_ql, _mm256_mullo_epi32(lVal, cosVal));
+
+    // Increment pointers
+    ecode += 8;
+    pcode += 8;
+    lcode += 8;
+    sig_sin += 8;
+    sig_cos += 8;
+  }
+
+  _mm256_storeu_si256((__m256i *)tempBuffer[0], acc_ie);
+  _mm256_storeu_si256((__m256i *)tempBuffer[1], acc_ip);
+  _mm256_storeu_si256((__m256i *)tempBuffer[2], acc_il);
+  _mm256_storeu_si256((__m256i *)tempBuffer[3], acc_qe);
+  _mm256_storeu_si256((__m256i *)tempBuffer[4], acc_qp);
+  _mm256_storeu_si256((__m256i *)tempBuffer[5], acc_ql);
+
+  for (k = 0; k < 6; k++) {
+    returnValue[k] = tempBuffer[k][0];
+    returnValue[k] += tempBuffer[k][1];
+    returnValue[k] += tempBuffer[k][2];
+    returnValue[k] += tempBuffer[k][3];
+    returnValue[k] += tempBuffer[k][4];
+    returnValue[k] += tempBuffer[k][5];
+    returnValue[k] += tempBuffer[k][6];
+    returnValue[k] += tempBuffer[k][7];
+  }
+
+  // Perform non SIMD leftover operations
+  number = eigthPoints * 8;
+  for (; number < num_points; number++) {
+    returnValue[0] += (*ecode) * (*sig_sin);
+    returnValue[1] += (*pcode) * (*sig_sin);
+    returnValue[2] += (*lcode) * (*sig_sin);
+    returnValue[3] += (*ecode++) * (*sig_cos);
+    returnValue[4] += (*pcode++) * (*sig_cos);
+    returnValue[5] += (*lcode++) * (*sig_cos);
+    sig_sin++;
+    sig_cos++;
+  }
+
+  *i_e = returnValue[0];
+  *i_p = returnValue[1];
+  *i_l = returnValue[2];
+  *q_e = returnValue[3];
+  *q_p = returnValue[4];
+  *q_l = returnValue[5];
+}
+
 /*!
  *  \brief Multiply point to point two vectors together as a si32 type
  * \param[out] cvector Product of point to point multiplication
@@ -905,6 +3600,226 @@ static inline double avx2_mul_and_acc_short(const short *aVector,
   return returnValue;
 }
 
+/*!
+ *  \brief Multiply and accumulates two vectors of si16 type into si32 lanes
+ *  \details vpmaddwd multiplies the 16-bit samples into 32-bit products and
+ * adds adjacent pairs in one instruction, so unlike avx2_mul_and_acc_short()
+ * no product is truncated and the sum is not saturated. The lanes wrap modulo
+ * 2^32 like the nominal si32 sum; a single pair only overflows when all four
+ * samples are -32768.
+ *  \param[in] aVector First vector to multiply
+ *  \param[in] bVector Second vector to multiply
+ *  \param[in] num_points Number of points in each vector
+ *  \return Accumulation result as a double
+ */
+static inline double avx2_mul_and_acc_si16(const int16_t *aVector,
+                                           const int16_t *bVector,
+                                           uint32_t num_points) {
+
+  int32_t returnValue = 0;
+  uint32_t number = 0;
+  const uint32_t sixteenthPoints = num_points / 16;
+  int32_t lanes[8];
+  __m256i aVal, bVal;
+  __m256i accumulator = _mm256_setzero_si256();
+
+  for (; number < sixteenthPoints; number++) {
+    aVal = _mm256_loadu_si256((const __m256i *)aVector);
+    bVal = _mm256_loadu_si256((const __m256i *)bVector);
+    accumulator = _mm256_add_epi32(accumulator, _mm256_madd_epi16(aVal, bVal));
+
+    // Increment pointers
+    aVector += 16;
+    bVector += 16;
+  }
+
+  _mm256_storeu_si256((__m256i *)lanes, accumulator);
+  for (int k = 0; k < 8; k++) {
+    returnValue += lanes[k];
+  }
+
+  // Perform non SIMD leftover operations
+  for (number = sixteenthPoints * 16; number < num_points; number++) {
+    returnValue += (*aVector++) * (*bVector++);
+  }
+  return returnValue;
+}
+
+/*!
+ *  \brief Multiply and accumulates two vectors of si8 type into si32 lanes
+ *  \details Sign extends both vectors to 16 bits and accumulates them with
+ * vpmaddwd as avx2_mul_and_acc_si16() does, for CPUs without AVX-VNNI.
+ *  \param[in] aVector First vector to multiply
+ *  \param[in] bVector Second vector to multiply
+ *  \param[in] num_points Number of points in each vector
+ *  \return Accumulation result as a double
+ */
+static inline double avx2_mul_and_acc_si8(const int8_t *aVector,
+                                          const int8_t *bVector,
+                                          uint32_t num_points) {
+
+  int32_t returnValue = 0;
+  uint32_t number = 0;
+  const uint32_t sixteenthPoints = num_points / 16;
+  int32_t lanes[8];
+  __m256i aVal, bVal;
+  __m256i accumulator = _mm256_setzero_si256();
+
+  for (; number < sixteenthPoints; number++) {
+    aVal = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)aVector));
+    bVal = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)bVector));
+    accumulator = _mm256_add_epi32(accumulator, _mm256_madd_epi16(aVal, bVal));
+
+    // Increment pointers
+    aVector += 16;
+    bVector += 16;
+  }
+
+  _mm256_storeu_si256((__m256i *)lanes, accumulator);
+  for (int k = 0; k < 8; k++) {
+    returnValue += lanes[k];
+  }
+
+  // Perform non SIMD leftover operations
+  for (number = sixteenthPoints * 16; number < num_points; number++) {
+    returnValue += (*aVector++) * (*bVector++);
+  }
+  return returnValue;
+}
+
+#pragma GCC push_options
+#pragma GCC target("avxvnni")
+
+/*!
+ *  \brief Multiply and accumulates two vectors of si16 type with AVX-VNNI
+ *  \details VEX encoded vpdpwssd for cores with AVX-VNNI but no AVX512,
+ * same result as avx512_mul_and_acc_si16_vnni(). Four accumulators hide the
+ * latency of vpdpwssd.
+ *  \param[in] aVector First vector to multiply
+ *  \param[in] bVector Second vector to multiply
+ *  \param[in] num_points Number of points in each vector
+ *  \return Accumulation result as a double
+ */
+static inline double avx2_mul_and_acc_si16_vnni(const int16_t *aVector,
+                                                const int16_t *bVector,
+                                                uint32_t num_points) {
+
+  int32_t returnValue = 0;
+  uint32_t number = 0;
+  const uint32_t sixteenthPoints = num_points / 16;
+  int32_t lanes[8];
+  __m256i acc0 = _mm256_setzero_si256();
+  __m256i acc1 = _mm256_setzero_si256();
+  __m256i acc2 = _mm256_setzero_si256();
+  __m256i acc3 = _mm256_setzero_si256();
+
+  for (; number + 4 <= sixteenthPoints; number += 4) {
+    acc0 = _mm256_dpwssd_avx_epi32(
+        acc0, _mm256_loadu_si256((const __m256i *)aVector),
+        _mm256_loadu_si256((const __m256i *)bVector));
+    acc1 = _mm256_dpwssd_avx_epi32(
+        acc1, _mm256_loadu_si256((const __m256i *)(aVector + 16)),
+        _mm256_loadu_si256((const __m256i *)(bVector + 16)));
+    acc2 = _mm256_dpwssd_avx_epi32(
+        acc2, _mm256_loadu_si256((const __m256i *)(aVector + 32)),
+        _mm256_loadu_si256((const __m256i *)(bVector + 32)));
+    acc3 = _mm256_dpwssd_avx_epi32(
+        acc3, _mm256_loadu_si256((const __m256i *)(aVector + 48)),
+        _mm256_loadu_si256((const __m256i *)(bVector + 48)));
+
+    // Increment pointers
+    aVector += 64;
+    bVector += 64;
+  }
+  for (; number < sixteenthPoints; number++) {
+    acc0 = _mm256_dpwssd_avx_epi32(
+        acc0, _mm256_loadu_si256((const __m256i *)aVector),
+        _mm256_loadu_si256((const __m256i *)bVector));
+    aVector += 16;
+    bVector += 16;
+  }
+
+  acc0 = _mm256_add_epi32(_mm256_add_epi32(acc0, acc1),
+                          _mm256_add_epi32(acc2, acc3));
+  _mm256_storeu_si256((__m256i *)lanes, acc0);
+  for (int k = 0; k < 8; k++) {
+    returnValue += lanes[k];
+  }
+
+  // Perform non SIMD leftover operations
+  for (number = sixteenthPoints * 16; number < num_points; number++) {
+    returnValue += (*aVector++) * (*bVector++);
+  }
+  return returnValue;
+}
+
+/*!
+ *  \brief Multiply and accumulates two vectors of si8 type with AVX-VNNI
+ *  \details VEX encoded vpdpbusd for cores with AVX-VNNI but no AVX512,
+ * with the same sign bias and accumulator pairs as
+ * avx512_mul_and_acc_si8_vnni().
+ *  \param[in] aVector First vector to multiply
+ *  \param[in] bVector Second vector to multiply
+ *  \param[in] num_points Number of points in each vector
+ *  \return Accumulation result as a double
+ */
+static inline double avx2_mul_and_acc_si8_vnni(const int8_t *aVector,
+                                               const int8_t *bVector,
+                                               uint32_t num_points) {
+
+  int32_t returnValue = 0;
+  uint32_t number = 0;
+  const uint32_t thirtysecondthPoints = num_points / 32;
+  const __m256i bias = _mm256_set1_epi8((char)0x80);
+  int32_t lanes[8];
+  __m256i aVal, bVal, cVal, dVal;
+  __m256i acc0 = _mm256_setzero_si256();
+  __m256i acc1 = _mm256_setzero_si256();
+  __m256i biasSum0 = _mm256_setzero_si256();
+  __m256i biasSum1 = _mm256_setzero_si256();
+
+  for (; number + 2 <= thirtysecondthPoints; number += 2) {
+    aVal = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)aVector),
+                            bias);
+    bVal = _mm256_loadu_si256((const __m256i *)bVector);
+    cVal = _mm256_xor_si256(
+        _mm256_loadu_si256((const __m256i *)(aVector + 32)), bias);
+    dVal = _mm256_loadu_si256((const __m256i *)(bVector + 32));
+    acc0 = _mm256_dpbusd_avx_epi32(acc0, aVal, bVal);
+    biasSum0 = _mm256_dpbusd_avx_epi32(biasSum0, bias, bVal);
+    acc1 = _mm256_dpbusd_avx_epi32(acc1, cVal, dVal);
+    biasSum1 = _mm256_dpbusd_avx_epi32(biasSum1, bias, dVal);
+
+    // Increment pointers
+    aVector += 64;
+    bVector += 64;
+  }
+  for (; number < thirtysecondthPoints; number++) {
+    aVal = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)aVector),
+                            bias);
+    bVal = _mm256_loadu_si256((const __m256i *)bVector);
+    acc0 = _mm256_dpbusd_avx_epi32(acc0, aVal, bVal);
+    biasSum0 = _mm256_dpbusd_avx_epi32(biasSum0, bias, bVal);
+    aVector += 32;
+    bVector += 32;
+  }
+
+  acc0 = _mm256_add_epi32(acc0, acc1);
+  biasSum0 = _mm256_add_epi32(biasSum0, biasSum1);
+  _mm256_storeu_si256((__m256i *)lanes, _mm256_sub_epi32(acc0, biasSum0));
+  for (int k = 0; k < 8; k++) {
+    returnValue += lanes[k];
+  }
+
+  // Perform non SIMD leftover operations
+  for (number = thirtysecondthPoints * 32; number < num_points; number++) {
+    returnValue += (*aVector++) * (*bVector++);
+  }
+  return returnValue;
+}
+
+#pragma GCC pop_options
+
 /*!
  *  \brief Multiply point to point two vectors together as a si32 type
  * \param[out] cvector Product of point to point multiplication
@@ -997,3 +3912,5 @@ static inline double avx_accumulate_int(const int32_t *inputBuffer,
   }
   return returnValue;
 }
+
+#endif /* AVX2_INTRINSICS_H */
@@ -10,7 +10,11 @@
  *  \note      Functions in the file must target AVX512 enabled platforms.
  */
 
+#ifndef AVX512_INTRINSICS_H
+#define AVX512_INTRINSICS_H
+
 #include "immintrin.h"
+#include "nco_state.h"
 #include <math.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -48,17 +52,16 @@ void avx512_nco_si32(int32_t *sig_nco, const int32_t *lut,
       3 * nom_carr_step, 2 * nom_carr_step, 1 * nom_carr_step,
       0 * nom_carr_step);
   __m512i carr_idx = _mm512_set1_epi32(0);
-  __m512i hex_ff = _mm512_set1_epi32(0xFF);
+  __m512i hex_ff = _mm512_set1_epi32(GNSS_NCO_LUT_MASK);
   __m512i nco;
   __m512i carr_step_offset = _mm512_set1_epi32(16 * nom_carr_step);
-  __m256i phase_base;
 
   // First iteration happens outside the loop
   carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_base);
 
   for (inda = 0; inda < sixteenth_points; inda++) {
-    // Obtain integer index in 8:24 number
-    carr_idx = _mm512_srli_epi32(carr_phase_base, 24);
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    carr_idx = _mm512_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT);
     carr_idx = _mm512_and_si512(carr_idx, hex_ff);
 
     // Look in lut
@@ -76,13 +79,15 @@ void avx512_nco_si32(int32_t *sig_nco, const int32_t *lut,
   }
 
   inda = sixteenth_points * 16;
-  phase_base = _mm512_extracti32x8_epi32(carr_phase_base, 1);
-  nom_carr_phase_base = (uint32_t)_mm256_extract_epi32(phase_base, 7);
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base =
+      (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(carr_phase_base));
 
   // generate buffer of output
   for (; inda < blk_size; ++inda) {
-    // Obtain integer index in 8:24 number
-    nom_carr_idx = (nom_carr_phase_base >> 24) & 0xFF;
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    nom_carr_idx =
+        (nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT) & GNSS_NCO_LUT_MASK;
     // Look in lut
     *sig_nco++ = lut[nom_carr_idx]; // get sample value from lut
     // Delta step
@@ -90,6 +95,181 @@ void avx512_nco_si32(int32_t *sig_nco, const int32_t *lut,
   }
 }
 
+/*!
+ *  \brief Generates a phase-continuous NCO based on the Paralelized Lookup
+ * Table (PLUT) approach
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table to be use for the code
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void avx512_nco_state_si32(int32_t *sig_nco, const int32_t *lut,
+                           const int32_t blk_size, gnss_nco_t *nco) {
+  int32_t inda;
+  const uint32_t sixteenth_points = blk_size / 16;
+  const uint32_t nom_carr_step = nco->step;
+  uint32_t nom_carr_phase_base = nco->phase;
+
+  // Lane k starts k samples ahead of the accumulator
+  __m512i carr_phase_base = _mm512_add_epi32(
+      _mm512_set1_epi32(nom_carr_phase_base),
+      _mm512_mullo_epi32(_mm512_set1_epi32(nom_carr_step),
+                         _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6,
+                                          5, 4, 3, 2, 1, 0)));
+  __m512i carr_step_offset = _mm512_set1_epi32(16 * nom_carr_step);
+  __m512i carr_idx;
+  __m512i sig;
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    carr_idx = _mm512_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT);
+
+    // Look in lut
+    sig = _mm512_i32gather_epi32(carr_idx, lut, 4);
+
+    // Delta step
+    carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_offset);
+
+    // Store values in output buffer
+    _mm512_storeu_si512((__m512i *)sig_nco, sig);
+    sig_nco += 16;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base =
+      (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(carr_phase_base));
+
+  for (inda = sixteenth_points * 16; inda < blk_size; ++inda) {
+    *sig_nco++ = lut[nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT];
+    nom_carr_phase_base += nom_carr_step;
+  }
+  nco->phase = nom_carr_phase_base;
+}
+
+/*!
+ *  \brief Generates the sine and cosine carriers of a quadrature NCO
+ *  \details Both carriers come from one phase ramp and one gather of the
+ * packed table built by gnss_nco_sincos_lut_si32().
+ *  \param[out] sig_sin Sine wave generated by the NCO
+ *  \param[out] sig_cos Cosine wave generated by the NCO
+ *  \param[in] sincos_lut Packed sine and cosine lookup table
+ *  \param[in] blk_size Total number of elements in the output vectors
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void avx512_nco_iq_si32(int32_t *sig_sin, int32_t *sig_cos,
+                        const int32_t *sincos_lut, const int32_t blk_size,
+                        gnss_nco_t *nco) {
+  int32_t inda;
+  const uint32_t sixteenth_points = blk_size / 16;
+  const uint32_t nom_carr_step = nco->step;
+  uint32_t nom_carr_phase_base = nco->phase;
+
+  // Lane k starts k samples ahead of the accumulator
+  __m512i carr_phase_base = _mm512_add_epi32(
+      _mm512_set1_epi32(nom_carr_phase_base),
+      _mm512_mullo_epi32(_mm512_set1_epi32(nom_carr_step),
+                         _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6,
+                                          5, 4, 3, 2, 1, 0)));
+  __m512i carr_step_offset = _mm512_set1_epi32(16 * nom_carr_step);
+  __m512i carr_idx;
+  __m512i sincos, sin_val, cos_val;
+  int32_t nom_sincos;
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    carr_idx = _mm512_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT);
+
+    // One lookup for both carriers, sine in the upper half of each entry
+    sincos = _mm512_i32gather_epi32(carr_idx, sincos_lut, 4);
+    sin_val = _mm512_srai_epi32(sincos, 16);
+    cos_val = _mm512_srai_epi32(_mm512_slli_epi32(sincos, 16), 16);
+
+    // Delta step
+    carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_offset);
+
+    // Store values in output buffers
+    _mm512_storeu_si512((__m512i *)sig_sin, sin_val);
+    _mm512_storeu_si512((__m512i *)sig_cos, cos_val);
+    sig_sin += 16;
+    sig_cos += 16;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base =
+      (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(carr_phase_base));
+
+  for (inda = sixteenth_points * 16; inda < blk_size; ++inda) {
+    nom_sincos = sincos_lut[nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT];
+    *sig_sin++ = nom_sincos >> 16;
+    *sig_cos++ = (int16_t)nom_sincos;
+    nom_carr_phase_base += nom_carr_step;
+  }
+  nco->phase = nom_carr_phase_base;
+}
+
+/*!
+ *  \brief Generates a NCO from a small lookup table held in registers
+ *  \details Replaces the gather of the PLUT method with a single
+ * vpermi2d/vpermi2ps over two registers holding up to 32 table entries.
+ * Larger tables do not fit and fall back to the scalar lookup.
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table of 1 << lut_bits entries
+ *  \param[in] lut_bits Phase bits indexing the table, 1 to 5
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void avx512_nco_perm_si32(int32_t *sig_nco, const int32_t *lut,
+                          const int32_t lut_bits, const int32_t blk_size,
+                          gnss_nco_t *nco) {
+  int32_t inda;
+  const uint32_t sixteenth_points = (lut_bits <= 5) ? blk_size / 16 : 0;
+  const int32_t shift = 32 - lut_bits;
+  const int32_t lut_size = 1 << lut_bits;
+  const uint32_t nom_carr_step = nco->step;
+  uint32_t nom_carr_phase_base = nco->phase;
+
+  // Lane k starts k samples ahead of the accumulator
+  __m512i carr_phase_base = _mm512_add_epi32(
+      _mm512_set1_epi32(nom_carr_phase_base),
+      _mm512_mullo_epi32(_mm512_set1_epi32(nom_carr_step),
+                         _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6,
+                                          5, 4, 3, 2, 1, 0)));
+  __m512i carr_step_offset = _mm512_set1_epi32(16 * nom_carr_step);
+  __m512i carr_idx;
+  __m512i sig;
+
+  // Keep the whole table in registers, masking off the missing entries
+  const __m512i lut_lo = _mm512_maskz_loadu_epi32(
+      (__mmask16)((lut_size < 16) ? (1 << lut_size) - 1 : 0xFFFF), lut);
+  const __m512i lut_hi = _mm512_maskz_loadu_epi32(
+      (__mmask16)((lut_size > 16) ? 0xFFFF : 0), lut + 16);
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // Obtain integer index in lut_bits:(32 - lut_bits) number
+    carr_idx = _mm512_srli_epi32(carr_phase_base, shift);
+
+    // Look in the table registers
+    sig = _mm512_permutex2var_epi32(lut_lo, carr_idx, lut_hi);
+
+    // Delta step
+    carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_offset);
+
+    // Store values in output buffer
+    _mm512_storeu_si512((__m512i *)sig_nco, sig);
+    sig_nco += 16;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base =
+      (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(carr_phase_base));
+
+  for (inda = sixteenth_points * 16; inda < blk_size; ++inda) {
+    *sig_nco++ = lut[nom_carr_phase_base >> shift];
+    nom_carr_phase_base += nom_carr_step;
+  }
+  nco->phase = nom_carr_phase_base;
+}
+
 /*!
  *  \brief Generates a nominal NCO based on the Direct Lookup Table (DLUT)
  * approach. \param[out] sig_nco Sinusoidal wave generated byt the NCO
@@ -111,8 +291,8 @@ void avx512_nom_nco_si32(int32_t *sig_nco, const int32_t *lut,
 
   // for each sample
   for (inda = 0; inda < blk_size; ++inda) {
-    // Obtain integer index in 8:24 number
-    carrIndex = (carrPhaseBase >> 24) & 0xFF;
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    carrIndex = (carrPhaseBase >> GNSS_NCO_LUT_SHIFT) & GNSS_NCO_LUT_MASK;
 
     // Look in lut
     sig_nco[inda] = lut[carrIndex];
@@ -162,6 +342,39 @@ void avx512_nom_code_si32(int32_t *ecode, int32_t *pcode, int32_t *lcode,
   }
 }
 
+/*!
+ *  \brief Finds the chips of the Early, Prompt and Late replicas of 16 samples
+ *  \details The code phase of every sample is computed from its index in the
+ * block rather than accumulated, and rounded up to the chip it falls in, with
+ * the same float operations as nom_code_si32(). The SIMD code generators thus
+ * match the portable ones sample for sample, whatever the block size.
+ *  \param[out] code_idx Early, Prompt and Late chip indices
+ *  \param[in] sample_idx Index of each sample in the block
+ *  \param[in] code_step Code phase step between two samples
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] spacing Early to Prompt spacing in chips
+ */
+static inline void avx512_code_idx(__m512i *code_idx, const __m512i sample_idx,
+                                   const __m512 code_step,
+                                   const __m512 rem_code_phase,
+                                   const __m512 spacing) {
+  // The explicit rounding keeps the add from being fused into an FMA, which
+  // would round the code phase differently from nom_code_si32()
+  __m512 code_phase = _mm512_add_round_ps(
+      _mm512_mul_ps(_mm512_cvtepi32_ps(sample_idx), code_step), rem_code_phase,
+      _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+  // Converted rounding up, a single instruction with the embedded rounding
+  code_idx[0] = _mm512_cvt_roundps_epi32(_mm512_sub_ps(code_phase, spacing),
+                                         _MM_FROUND_TO_POS_INF |
+                                             _MM_FROUND_NO_EXC);
+  code_idx[1] = _mm512_cvt_roundps_epi32(
+      code_phase, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+  code_idx[2] = _mm512_cvt_roundps_epi32(_mm512_add_ps(code_phase, spacing),
+                                         _MM_FROUND_TO_POS_INF |
+                                             _MM_FROUND_NO_EXC);
+}
+
 /*!
  *  \brief Generates an Early, Late and Propmt CA code based on the Parallelized
  * Lookup Table (PLUT) approach.
@@ -181,50 +394,30 @@ void avx512_code_si32(int32_t *ecode, int32_t *pcode, int32_t *lcode,
 
   int32_t inda;
   const uint32_t sixteenth_points = blk_size / 16;
+  const __mmask16 tail = (1u << (blk_size - sixteenth_points * 16)) - 1;
   float earlyLateSpc = 0.5;
   float codePhaseStep = code_freq / samp_freq;
-  float baseCode;
-  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
 
   // Important variable declarations
-  __m512 ecode_phase_base = _mm512_set1_ps(rem_code_phase - earlyLateSpc + 0.5);
-  __m512 pcode_phase_base = _mm512_set1_ps(rem_code_phase + 0.5);
-  __m512 lcode_phase_base = _mm512_set1_ps(rem_code_phase + earlyLateSpc + 0.5);
-
-  __m512 code_step_base =
-      _mm512_set_ps(15 * codePhaseStep, 14 * codePhaseStep, 12 * codePhaseStep,
-                    12 * codePhaseStep, 11 * codePhaseStep, 10 * codePhaseStep,
-                    9 * codePhaseStep, 8 * codePhaseStep, 7 * codePhaseStep,
-                    6 * codePhaseStep, 5 * codePhaseStep, 4 * codePhaseStep,
-                    3 * codePhaseStep, 2 * codePhaseStep, 1 * codePhaseStep,
-                    0 * codePhaseStep);
-  __m512i ecode_idx = _mm512_set1_epi32(0);
-  __m512i pcode_idx = _mm512_set1_epi32(0);
-  __m512i lcode_idx = _mm512_set1_epi32(0);
-
+  __m512i sample_idx =
+      _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+  __m512i sample_offset = _mm512_set1_epi32(16);
+  __m512 code_step = _mm512_set1_ps(codePhaseStep);
+  __m512 code_phase_base = _mm512_set1_ps(rem_code_phase);
+  __m512 code_spacing = _mm512_set1_ps(earlyLateSpc);
+  __m512i code_idx[3];
   __m512i elut, plut, llut;
-  __m512 code_step_offset = _mm512_set1_ps(16 * codePhaseStep);
-
-  // First iteration happens outside the loop
-  ecode_phase_base = _mm512_add_ps(ecode_phase_base, code_step_base);
-  pcode_phase_base = _mm512_add_ps(pcode_phase_base, code_step_base);
-  lcode_phase_base = _mm512_add_ps(lcode_phase_base, code_step_base);
 
   for (inda = 0; inda < sixteenth_points; inda++) {
-    // Obtain integer index in 8:24 number
-    ecode_idx = _mm512_cvtps_epi32(ecode_phase_base);
-    pcode_idx = _mm512_cvtps_epi32(pcode_phase_base);
-    lcode_idx = _mm512_cvtps_epi32(lcode_phase_base);
+    // Chips of the replicas for the next 16 samples
+    avx512_code_idx(code_idx, sample_idx, code_step, code_phase_base,
+                    code_spacing);
+    sample_idx = _mm512_add_epi32(sample_idx, sample_offset);
 
     // Look in lut
-    elut = _mm512_i32gather_epi32(ecode_idx, cacode, 4);
-    plut = _mm512_i32gather_epi32(pcode_idx, cacode, 4);
-    llut = _mm512_i32gather_epi32(lcode_idx, cacode, 4);
-
-    // Delta step
-    ecode_phase_base = _mm512_add_ps(ecode_phase_base, code_step_offset);
-    pcode_phase_base = _mm512_add_ps(pcode_phase_base, code_step_offset);
-    lcode_phase_base = _mm512_add_ps(lcode_phase_base, code_step_offset);
+    elut = _mm512_i32gather_epi32(code_idx[0], cacode, 4);
+    plut = _mm512_i32gather_epi32(code_idx[1], cacode, 4);
+    llut = _mm512_i32gather_epi32(code_idx[2], cacode, 4);
 
     // 5- Store values in output buffer
     _mm512_storeu_si512((__m512i *)ecode, elut);
@@ -237,380 +430,2832 @@ void avx512_code_si32(int32_t *ecode, int32_t *pcode, int32_t *lcode,
     lcode += 16;
   }
 
-  inda = sixteenth_points * 16;
-
-  // generate buffer of output
-  for (; inda < blk_size; ++inda) {
-    baseCode = (inda * codePhaseStep + rem_code_phase);
-    pCodeIdx = (int32_t)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
-    eCodeIdx = (int32_t)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
-                   ? (baseCode - earlyLateSpc + 1)
-                   : (baseCode - earlyLateSpc);
-    lCodeIdx = (int32_t)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
-                   ? (baseCode + earlyLateSpc + 1)
-                   : (baseCode + earlyLateSpc);
-
-    ecode[inda] = *(cacode + eCodeIdx);
-    pcode[inda] = *(cacode + pCodeIdx);
-    lcode[inda] = *(cacode + lCodeIdx);
+  // Remaining samples through one masked step of the same float path
+  if (tail) {
+    avx512_code_idx(code_idx, sample_idx, code_step, code_phase_base,
+                    code_spacing);
+    elut = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), tail,
+                                       code_idx[0], cacode, 4);
+    plut = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), tail,
+                                       code_idx[1], cacode, 4);
+    llut = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), tail,
+                                       code_idx[2], cacode, 4);
+    _mm512_mask_storeu_epi32(ecode, tail, elut);
+    _mm512_mask_storeu_epi32(pcode, tail, plut);
+    _mm512_mask_storeu_epi32(lcode, tail, llut);
   }
 }
 
 /*!
- *  \brief Multiply and accumulates product of two vectors storing the result in
- * an fl32 type
- * \param[in] avector First vector to multiply
- * \param[in] bvector Second vector to multiply
- * \param[in] num_points Number of points in each vector
+ *  \brief Generates a NCO based on the Parallel Lookup Table (PLUT) method as
+ * si16 type
+ *  \details Gathers 16 si32 table entries per step and narrows them with
+ * saturation into int16_t lanes with vpmovsdw, so the 16-bit correlators get
+ * their carrier without a scalar conversion pass.
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table of GNSS_NCO_LUT_SIZE entries
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] samp_freq Sampling frequency of the signal to be generated
  */
-static inline double avx512_mul_and_acc_si32(const int32_t *avector,
-                                             const int32_t *bvector,
-                                             uint32_t num_points) {
-
-  int32_t returnValue = 0;
-  uint32_t number = 0;
-  const uint32_t sixteenth_points = num_points / 16;
-
-  const int32_t *aPtr = avector;
-  const int32_t *bPtr = bvector;
-  int32_t tempBuffer[16];
-
-  __m512i aVal, bVal, cVal;
-  __m512i accumulator = _mm512_setzero_si512();
-
-  for (; number < sixteenth_points; number++) {
-
-    // Load 256-bits of integer data from memory into dst. mem_addr does not
-    // need to be aligned on any particular boundary.
-    aVal = _mm512_loadu_si512((__m512i *)aPtr);
-    bVal = _mm512_loadu_si512((__m512i *)bPtr);
-
-    // TODO: More efficient way to exclude having this intermediate cVal
-    // variable??
-    cVal = _mm512_mullo_epi32(aVal, bVal);
-
-    // accumulator += _mm256_mullo_epi16(aVal, bVal);
-    accumulator = _mm512_add_epi32(accumulator, cVal);
+void avx512_nco_si16(int16_t *sig_nco, const int32_t *lut,
+                     const int32_t blk_size, const double rem_carr_phase,
+                     const double carr_freq, const double samp_freq) {
+  int32_t inda;
+  const uint32_t sixteenth_points = blk_size / 16;
+  const uint32_t nom_carr_step =
+      (uint32_t)(carr_freq * (4294967296.0 / samp_freq) + 0.5);
+  uint32_t nom_carr_phase_base =
+      (uint32_t)(rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
 
-    // Increment pointers
-    aPtr += 16;
-    bPtr += 16;
-  }
+  // Lane k starts k samples ahead of the accumulator
+  __m512i carr_phase_base = _mm512_add_epi32(
+      _mm512_set1_epi32(nom_carr_phase_base),
+      _mm512_mullo_epi32(_mm512_set1_epi32(nom_carr_step),
+                         _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6,
+                                          5, 4, 3, 2, 1, 0)));
+  __m512i carr_step_offset = _mm512_set1_epi32(16 * nom_carr_step);
+  __m512i sig;
 
-  _mm512_storeu_si512((__m512i *)tempBuffer, accumulator);
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    sig = _mm512_i32gather_epi32(
+        _mm512_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT), lut, 4);
 
-  returnValue = tempBuffer[0];
-  returnValue += tempBuffer[1];
-  returnValue += tempBuffer[2];
-  returnValue += tempBuffer[3];
-  returnValue += tempBuffer[4];
-  returnValue += tempBuffer[5];
-  returnValue += tempBuffer[6];
-  returnValue += tempBuffer[7];
-  returnValue += tempBuffer[8];
-  returnValue += tempBuffer[9];
-  returnValue += tempBuffer[10];
-  returnValue += tempBuffer[11];
-  returnValue += tempBuffer[12];
-  returnValue += tempBuffer[13];
-  returnValue += tempBuffer[14];
-  returnValue += tempBuffer[15];
+    // Delta step
+    carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_offset);
 
-  // Perform non SIMD leftover operations
-  number = sixteenth_points * 16;
-  for (; number < num_points; number++) {
-    returnValue += (*aPtr++) * (*bPtr++);
+    // Store values in output buffer
+    _mm256_storeu_si256((__m256i *)sig_nco, _mm512_cvtsepi32_epi16(sig));
+    sig_nco += 16;
   }
-  return returnValue;
-}
-
-/*!
- *  \brief Multiply point to point two vectors together as a fl32 type
- * \param[out] cvector Product of point to point multiplication
- * \param[in] avector First vector to multiply
- * \param[in] bvector Second vector to multiply
- * \param[in] num_points Number of points in each
- * vector
- */
-static inline void avx512_fl32_x2_mul_si32(int32_t *cvector,
-                                           const int32_t *avector,
-                                           const int32_t *bvector,
-                                           uint32_t num_points) {
-
-  uint32_t number = 0;
-  const uint32_t sixteenth_points = num_points / 16;
-
-  int32_t *cPtr = cvector;
-  const int32_t *aPtr = avector;
-  const int32_t *bPtr = bvector;
 
-  __m512i aVal, bVal, cVal;
-
-  for (; number < sixteenth_points; number++) {
-
-    // Load 256-bits of integer data from memory into dst. mem_addr does not
-    // need to be aligned on any particular boundary.
-    aVal = _mm512_loadu_si512((__m512i *)aPtr);
-    bVal = _mm512_loadu_si512((__m512i *)bPtr);
-
-    // Multiply packed 16-bit integers in a and b, producing intermediate
-    // signed 32-bit integers. Truncate each intermediate integer to the 18
-    // most significant bits, round by adding 1, and store bits [16:1] to dst.
-    cVal = _mm512_mullo_epi32(aVal, bVal);
-
-    // Store 256-bits of integer data from a into memory. mem_addr does
-    // not need to be aligned on any particular boundary.
-    _mm512_storeu_si512((__m512i *)cPtr, cVal);
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base =
+      (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(carr_phase_base));
 
-    // Increment pointers
-    aPtr += 16;
-    bPtr += 16;
-    cPtr += 16;
+  for (inda = sixteenth_points * 16; inda < blk_size; ++inda) {
+    *sig_nco++ = (int16_t)lut[nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT];
+    nom_carr_phase_base += nom_carr_step;
   }
 }
 
 /*!
- *  \brief Generates a NCO based on the direct lookup table approach with SIMD
- * intrinsic and generates the carrier as fl32 type.
- *  \param[out] sig_nco Sinusoidal wave generated byt the NCO
- *  \param[in] lut Lookup table to be use for the code
+ *  \brief Generates a NCO based on the Parallel Lookup Table (PLUT) method as
+ * si8 type
+ *  \details Gathers 16 si32 table entries per step and narrows them with
+ * saturation into int8_t lanes with vpmovsdb.
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table of GNSS_NCO_LUT_SIZE entries
  *  \param[in] blk_size Total number of elements in the sig_nco vector
  *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
  *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
  *  \param[in] samp_freq Sampling frequency of the signal to be generated
  */
-void avx512_nco_fl32(float *sig_nco, const float *lut, const int32_t blk_size,
-                     const double rem_carr_phase, const double carr_freq,
-                     const double samp_freq) {
+void avx512_nco_si8(int8_t *sig_nco, const int32_t *lut, const int32_t blk_size,
+                    const double rem_carr_phase, const double carr_freq,
+                    const double samp_freq) {
   int32_t inda;
   const uint32_t sixteenth_points = blk_size / 16;
   const uint32_t nom_carr_step =
       (uint32_t)(carr_freq * (4294967296.0 / samp_freq) + 0.5);
-
-  // Declarations for serial implementation
   uint32_t nom_carr_phase_base =
       (uint32_t)(rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
-  uint32_t nom_carr_idx = 0;
 
-  // Important variable declarations
-  __m512i carr_phase_base = _mm512_set1_epi32(nom_carr_phase_base);
-  __m512i carr_step_base = _mm512_set_epi32(
-      15 * nom_carr_step, 14 * nom_carr_step, 13 * nom_carr_step,
-      12 * nom_carr_step, 11 * nom_carr_step, 10 * nom_carr_step,
-      9 * nom_carr_step, 8 * nom_carr_step, 7 * nom_carr_step,
-      6 * nom_carr_step, 5 * nom_carr_step, 4 * nom_carr_step,
-      3 * nom_carr_step, 2 * nom_carr_step, 1 * nom_carr_step,
-      0 * nom_carr_step);
-  __m512i carr_idx = _mm512_set1_epi32(0);
-  __m512i hex_ff = _mm512_set1_epi32(0xFF);
-  __m512 nco;
+  // Lane k starts k samples ahead of the accumulator
+  __m512i carr_phase_base = _mm512_add_epi32(
+      _mm512_set1_epi32(nom_carr_phase_base),
+      _mm512_mullo_epi32(_mm512_set1_epi32(nom_carr_step),
+                         _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6,
+                                          5, 4, 3, 2, 1, 0)));
   __m512i carr_step_offset = _mm512_set1_epi32(16 * nom_carr_step);
-  __m256i phase_base;
-
-  // First iteration happens outside the loop
-  carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_base);
+  __m512i sig;
 
   for (inda = 0; inda < sixteenth_points; inda++) {
-    // Obtain integer index in 8:24 number
-    carr_idx = _mm512_srli_epi32(carr_phase_base, 24);
-    carr_idx = _mm512_and_si512(carr_idx, hex_ff);
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    sig = _mm512_i32gather_epi32(
+        _mm512_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT), lut, 4);
 
-    // Look in lut
+    // Delta step
+    carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_offset);
+
+    // Store values in output buffer
+    _mm_storeu_si128((__m128i *)sig_nco, _mm512_cvtsepi32_epi8(sig));
+    sig_nco += 16;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base =
+      (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(carr_phase_base));
+
+  for (inda = sixteenth_points * 16; inda < blk_size; ++inda) {
+    *sig_nco++ = (int8_t)lut[nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT];
+    nom_carr_phase_base += nom_carr_step;
+  }
+}
+
+/*!
+ *  \brief Generates an Early, Late and Prompt code using SIMD instructions as
+ * si16 type
+ *  \details Same code phases as avx512_code_si32(), each gather narrowed with
+ * saturation into 16 int16_t lanes with vpmovsdw.
+ *  \param[out] ecode Early replica of the ranging code
+ *  \param[out] pcode Prompt replica of the ranging code
+ *  \param[out] lcode Late replica of the ranging code
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of elements in the code vectors
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void avx512_code_si16(int16_t *ecode, int16_t *pcode, int16_t *lcode,
+                      const int32_t *cacode, const int32_t blk_size,
+                      const float rem_code_phase, const float code_freq,
+                      const float samp_freq) {
+
+  int32_t inda;
+  const uint32_t sixteenth_points = blk_size / 16;
+  const __mmask16 tail = (1u << (blk_size - sixteenth_points * 16)) - 1;
+  float earlyLateSpc = 0.5;
+  float codePhaseStep = code_freq / samp_freq;
+
+  // Important variable declarations
+  __m512i sample_idx =
+      _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+  __m512i sample_offset = _mm512_set1_epi32(16);
+  __m512 code_step = _mm512_set1_ps(codePhaseStep);
+  __m512 code_phase_base = _mm512_set1_ps(rem_code_phase);
+  __m512 code_spacing = _mm512_set1_ps(earlyLateSpc);
+  __m512i code_idx[3];
+  __m512i chips;
+  int16_t *code[3] = {ecode, pcode, lcode};
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // Chips of the replicas for the next 16 samples
+    avx512_code_idx(code_idx, sample_idx, code_step, code_phase_base,
+                    code_spacing);
+    sample_idx = _mm512_add_epi32(sample_idx, sample_offset);
+
+    for (int r = 0; r < 3; r++) {
+      // Look in lut
+      chips = _mm512_i32gather_epi32(code_idx[r], cacode, 4);
+
+      // Store values in output buffer
+      _mm256_storeu_si256((__m256i *)code[r], _mm512_cvtsepi32_epi16(chips));
+      code[r] += 16;
+    }
+  }
+
+  // Remaining samples through one masked step of the same float path
+  if (tail) {
+    avx512_code_idx(code_idx, sample_idx, code_step, code_phase_base,
+                    code_spacing);
+    for (int r = 0; r < 3; r++) {
+      chips = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), tail,
+                                          code_idx[r], cacode, 4);
+      _mm512_mask_cvtsepi32_storeu_epi16(code[r], tail, chips);
+    }
+  }
+}
+
+/*!
+ *  \brief Generates an Early, Late and Prompt code using SIMD instructions as
+ * si8 type
+ *  \details Same code phases as avx512_code_si32(), each gather narrowed with
+ * saturation into 16 int8_t lanes with vpmovsdb.
+ *  \param[out] ecode Early replica of the ranging code
+ *  \param[out] pcode Prompt replica of the ranging code
+ *  \param[out] lcode Late replica of the ranging code
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of elements in the code vectors
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void avx512_code_si8(int8_t *ecode, int8_t *pcode, int8_t *lcode,
+                     const int32_t *cacode, const int32_t blk_size,
+                     const float rem_code_phase, const float code_freq,
+                     const float samp_freq) {
+
+  int32_t inda;
+  const uint32_t sixteenth_points = blk_size / 16;
+  const __mmask16 tail = (1u << (blk_size - sixteenth_points * 16)) - 1;
+  float earlyLateSpc = 0.5;
+  float codePhaseStep = code_freq / samp_freq;
+
+  // Important variable declarations
+  __m512i sample_idx =
+      _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+  __m512i sample_offset = _mm512_set1_epi32(16);
+  __m512 code_step = _mm512_set1_ps(codePhaseStep);
+  __m512 code_phase_base = _mm512_set1_ps(rem_code_phase);
+  __m512 code_spacing = _mm512_set1_ps(earlyLateSpc);
+  __m512i code_idx[3];
+  __m512i chips;
+  int8_t *code[3] = {ecode, pcode, lcode};
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // Chips of the replicas for the next 16 samples
+    avx512_code_idx(code_idx, sample_idx, code_step, code_phase_base,
+                    code_spacing);
+    sample_idx = _mm512_add_epi32(sample_idx, sample_offset);
+
+    for (int r = 0; r < 3; r++) {
+      // Look in lut
+      chips = _mm512_i32gather_epi32(code_idx[r], cacode, 4);
+
+      // Store values in output buffer
+      _mm_storeu_si128((__m128i *)code[r], _mm512_cvtsepi32_epi8(chips));
+      code[r] += 16;
+    }
+  }
+
+  // Remaining samples through one masked step of the same float path
+  if (tail) {
+    avx512_code_idx(code_idx, sample_idx, code_step, code_phase_base,
+                    code_spacing);
+    for (int r = 0; r < 3; r++) {
+      chips = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), tail,
+                                          code_idx[r], cacode, 4);
+      _mm512_mask_cvtsepi32_storeu_epi8(code[r], tail, chips);
+    }
+  }
+}
+
+/*!
+ *  \brief Generates an Early, Late and Prompt code from a fixed point code NCO
+ *  \details Each lane keeps the 32.32 code phase as a chip count and a
+ * fraction. The chip indices of gnss_code_nco_idx() and the carry of the
+ * fraction into the chip count come from unsigned compares into masks and
+ * masked adds, so the replicas do not drift and no float conversion sits on
+ * the index path.
+ *  \param[out] ecode Early replica of the ranging code
+ *  \param[out] pcode Prompt replica of the ranging code
+ *  \param[out] lcode Late replica of the ranging code
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of elements in the code vectors
+ *  \param[in,out] nco Code NCO state, advanced to the sample that follows the
+ * block
+ */
+void avx512_code_state_si32(int32_t *ecode, int32_t *pcode, int32_t *lcode,
+                            const int32_t *cacode, const int32_t blk_size,
+                            gnss_code_nco_t *nco) {
+  int32_t inda;
+  const uint32_t sixteenth_points = blk_size / 16;
+  const uint64_t code_step = nco->step;
+  uint64_t code_phase = nco->phase;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+  uint32_t lane_chips[16], lane_frac[16];
+
+  // Lane k starts k samples ahead of the accumulator
+  for (int k = 0; k < 16; k++) {
+    lane_chips[k] = (uint32_t)((code_phase + k * code_step) >> 32);
+    lane_frac[k] = (uint32_t)(code_phase + k * code_step);
+  }
+  __m512i code_chips = _mm512_loadu_si512(lane_chips);
+  __m512i code_frac = _mm512_loadu_si512(lane_frac);
+  const __m512i chip_step =
+      _mm512_set1_epi32((int32_t)((16 * code_step) >> 32));
+  const __m512i frac_step = _mm512_set1_epi32((int32_t)(16 * code_step));
+  const __m512i half = _mm512_set1_epi32(INT32_MIN);
+  const __m512i one = _mm512_set1_epi32(1);
+  __mmask16 above_half, off_chip, carry;
+  __m512i next_frac;
+  __m512i ecode_idx, pcode_idx, lcode_idx;
+  __m512i elut, plut, llut;
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // Round up to the next chip, half a chip early and late
+    above_half = _mm512_cmpgt_epu32_mask(code_frac, half);
+    off_chip = _mm512_test_epi32_mask(code_frac, code_frac);
+    ecode_idx = _mm512_mask_add_epi32(code_chips, above_half, code_chips, one);
+    lcode_idx = _mm512_add_epi32(ecode_idx, one);
+    pcode_idx = _mm512_mask_add_epi32(code_chips, off_chip, code_chips, one);
+
+    // Look in lut
+    elut = _mm512_i32gather_epi32(ecode_idx, cacode, 4);
+    plut = _mm512_i32gather_epi32(pcode_idx, cacode, 4);
+    llut = _mm512_i32gather_epi32(lcode_idx, cacode, 4);
+
+    // Delta step, carrying the fraction into the chip count
+    next_frac = _mm512_add_epi32(code_frac, frac_step);
+    carry = _mm512_cmplt_epu32_mask(next_frac, code_frac);
+    code_chips = _mm512_add_epi32(code_chips, chip_step);
+    code_chips = _mm512_mask_add_epi32(code_chips, carry, code_chips, one);
+    code_frac = next_frac;
+
+    // Store values in output buffer
+    _mm512_storeu_si512(ecode, elut);
+    _mm512_storeu_si512(pcode, plut);
+    _mm512_storeu_si512(lcode, llut);
+    ecode += 16;
+    pcode += 16;
+    lcode += 16;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  code_phase =
+      ((uint64_t)(uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(code_chips))
+       << 32) |
+      (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(code_frac));
+
+  for (inda = sixteenth_points * 16; inda < blk_size; ++inda) {
+    gnss_code_nco_idx(code_phase, &eCodeIdx, &pCodeIdx, &lCodeIdx);
+    code_phase += code_step;
+
+    *ecode++ = cacode[eCodeIdx];
+    *pcode++ = cacode[pCodeIdx];
+    *lcode++ = cacode[lCodeIdx];
+  }
+  nco->phase = code_phase;
+}
+
+/*!
+ *  \brief Generates an Early, Late and Prompt code from a fixed point code NCO
+ * as fl32 type
+ *  \details Same code phases as avx512_code_state_si32().
+ *  \param[out] ecode Early replica of the ranging code
+ *  \param[out] pcode Prompt replica of the ranging code
+ *  \param[out] lcode Late replica of the ranging code
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of elements in the code vectors
+ *  \param[in,out] nco Code NCO state, advanced to the sample that follows the
+ * block
+ */
+void avx512_code_state_fl32(float *ecode, float *pcode, float *lcode,
+                            const float *cacode, const int32_t blk_size,
+                            gnss_code_nco_t *nco) {
+  int32_t inda;
+  const uint32_t sixteenth_points = blk_size / 16;
+  const uint64_t code_step = nco->step;
+  uint64_t code_phase = nco->phase;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+  uint32_t lane_chips[16], lane_frac[16];
+
+  // Lane k starts k samples ahead of the accumulator
+  for (int k = 0; k < 16; k++) {
+    lane_chips[k] = (uint32_t)((code_phase + k * code_step) >> 32);
+    lane_frac[k] = (uint32_t)(code_phase + k * code_step);
+  }
+  __m512i code_chips = _mm512_loadu_si512(lane_chips);
+  __m512i code_frac = _mm512_loadu_si512(lane_frac);
+  const __m512i chip_step =
+      _mm512_set1_epi32((int32_t)((16 * code_step) >> 32));
+  const __m512i frac_step = _mm512_set1_epi32((int32_t)(16 * code_step));
+  const __m512i half = _mm512_set1_epi32(INT32_MIN);
+  const __m512i one = _mm512_set1_epi32(1);
+  __mmask16 above_half, off_chip, carry;
+  __m512i next_frac;
+  __m512i ecode_idx, pcode_idx, lcode_idx;
+  __m512 elut, plut, llut;
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // Round up to the next chip, half a chip early and late
+    above_half = _mm512_cmpgt_epu32_mask(code_frac, half);
+    off_chip = _mm512_test_epi32_mask(code_frac, code_frac);
+    ecode_idx = _mm512_mask_add_epi32(code_chips, above_half, code_chips, one);
+    lcode_idx = _mm512_add_epi32(ecode_idx, one);
+    pcode_idx = _mm512_mask_add_epi32(code_chips, off_chip, code_chips, one);
+
+    // Look in lut
+    elut = _mm512_i32gather_ps(ecode_idx, cacode, 4);
+    plut = _mm512_i32gather_ps(pcode_idx, cacode, 4);
+    llut = _mm512_i32gather_ps(lcode_idx, cacode, 4);
+
+    // Delta step, carrying the fraction into the chip count
+    next_frac = _mm512_add_epi32(code_frac, frac_step);
+    carry = _mm512_cmplt_epu32_mask(next_frac, code_frac);
+    code_chips = _mm512_add_epi32(code_chips, chip_step);
+    code_chips = _mm512_mask_add_epi32(code_chips, carry, code_chips, one);
+    code_frac = next_frac;
+
+    // Store values in output buffer
+    _mm512_storeu_ps(ecode, elut);
+    _mm512_storeu_ps(pcode, plut);
+    _mm512_storeu_ps(lcode, llut);
+    ecode += 16;
+    pcode += 16;
+    lcode += 16;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  code_phase =
+      ((uint64_t)(uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(code_chips))
+       << 32) |
+      (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(code_frac));
+
+  for (inda = sixteenth_points * 16; inda < blk_size; ++inda) {
+    gnss_code_nco_idx(code_phase, &eCodeIdx, &pCodeIdx, &lCodeIdx);
+    code_phase += code_step;
+
+    *ecode++ = cacode[eCodeIdx];
+    *pcode++ = cacode[pCodeIdx];
+    *lcode++ = cacode[lCodeIdx];
+  }
+  nco->phase = code_phase;
+}
+
+/*!
+ *  \brief Generates a single Prompt replica of a fixed point code NCO spanning
+ * the Early and Late replicas
+ *  \details The window starts spacing samples before the NCO phase and holds
+ * blk_size + 2 * spacing samples, so the Early, Prompt and Late replicas are
+ * code, code + spacing and code + 2 * spacing. Only the Prompt chip is
+ * gathered, with the lanes stepped as in avx512_code_state_si32(), which cuts
+ * the gathers and stores to a third. The replicas match the code_state
+ * kernels when spacing samples span exactly half a chip.
+ *  \param[out] code Prompt replica, blk_size + 2 * spacing elements
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Number of samples in each of the E/P/L replicas
+ *  \param[in] spacing Early-Prompt spacing in samples, under one chip
+ *  \param[in,out] nco Code NCO state, advanced to the sample that follows the
+ * block
+ */
+void avx512_code_window_si32(int32_t *code, const int32_t *cacode,
+                             const int32_t blk_size, const int32_t spacing,
+                             gnss_code_nco_t *nco) {
+  int32_t inda;
+  const int32_t num_points = blk_size + 2 * spacing;
+  const uint32_t sixteenth_points = num_points / 16;
+  const uint64_t code_step = nco->step;
+  uint64_t code_phase = nco->phase - (uint64_t)spacing * code_step;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+  uint32_t lane_chips[16], lane_frac[16];
+
+  // Lane k starts k samples ahead of the accumulator
+  for (int k = 0; k < 16; k++) {
+    lane_chips[k] = (uint32_t)((code_phase + k * code_step) >> 32);
+    lane_frac[k] = (uint32_t)(code_phase + k * code_step);
+  }
+  __m512i code_chips = _mm512_loadu_si512(lane_chips);
+  __m512i code_frac = _mm512_loadu_si512(lane_frac);
+  const __m512i chip_step =
+      _mm512_set1_epi32((int32_t)((16 * code_step) >> 32));
+  const __m512i frac_step = _mm512_set1_epi32((int32_t)(16 * code_step));
+  const __m512i one = _mm512_set1_epi32(1);
+  __mmask16 off_chip, carry;
+  __m512i next_frac, pcode_idx;
+  __m512i plut;
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // Round up to the next chip
+    off_chip = _mm512_test_epi32_mask(code_frac, code_frac);
+    pcode_idx = _mm512_mask_add_epi32(code_chips, off_chip, code_chips, one);
+
+    // Look in lut
+    plut = _mm512_i32gather_epi32(pcode_idx, cacode, 4);
+
+    // Delta step, carrying the fraction into the chip count
+    next_frac = _mm512_add_epi32(code_frac, frac_step);
+    carry = _mm512_cmplt_epu32_mask(next_frac, code_frac);
+    code_chips = _mm512_add_epi32(code_chips, chip_step);
+    code_chips = _mm512_mask_add_epi32(code_chips, carry, code_chips, one);
+    code_frac = next_frac;
+
+    // Store values in output buffer
+    _mm512_storeu_si512(code, plut);
+    code += 16;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  code_phase =
+      ((uint64_t)(uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(code_chips))
+       << 32) |
+      (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(code_frac));
+
+  for (inda = sixteenth_points * 16; inda < num_points; ++inda) {
+    gnss_code_nco_idx(code_phase, &eCodeIdx, &pCodeIdx, &lCodeIdx);
+    code_phase += code_step;
+
+    *code++ = cacode[pCodeIdx];
+  }
+  nco->phase += (uint64_t)blk_size * code_step;
+}
+
+/*!
+ *  \brief Generates a single Prompt replica of a fixed point code NCO spanning
+ * the Early and Late replicas as fl32 type
+ *  \details Same window as avx512_code_window_si32().
+ *  \param[out] code Prompt replica, blk_size + 2 * spacing elements
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Number of samples in each of the E/P/L replicas
+ *  \param[in] spacing Early-Prompt spacing in samples, under one chip
+ *  \param[in,out] nco Code NCO state, advanced to the sample that follows the
+ * block
+ */
+void avx512_code_window_fl32(float *code, const float *cacode,
+                             const int32_t blk_size, const int32_t spacing,
+                             gnss_code_nco_t *nco) {
+  int32_t inda;
+  const int32_t num_points = blk_size + 2 * spacing;
+  const uint32_t sixteenth_points = num_points / 16;
+  const uint64_t code_step = nco->step;
+  uint64_t code_phase = nco->phase - (uint64_t)spacing * code_step;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+  uint32_t lane_chips[16], lane_frac[16];
+
+  // Lane k starts k samples ahead of the accumulator
+  for (int k = 0; k < 16; k++) {
+    lane_chips[k] = (uint32_t)((code_phase + k * code_step) >> 32);
+    lane_frac[k] = (uint32_t)(code_phase + k * code_step);
+  }
+  __m512i code_chips = _mm512_loadu_si512(lane_chips);
+  __m512i code_frac = _mm512_loadu_si512(lane_frac);
+  const __m512i chip_step =
+      _mm512_set1_epi32((int32_t)((16 * code_step) >> 32));
+  const __m512i frac_step = _mm512_set1_epi32((int32_t)(16 * code_step));
+  const __m512i one = _mm512_set1_epi32(1);
+  __mmask16 off_chip, carry;
+  __m512i next_frac, pcode_idx;
+  __m512 plut;
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // Round up to the next chip
+    off_chip = _mm512_test_epi32_mask(code_frac, code_frac);
+    pcode_idx = _mm512_mask_add_epi32(code_chips, off_chip, code_chips, one);
+
+    // Look in lut
+    plut = _mm512_i32gather_ps(pcode_idx, cacode, 4);
+
+    // Delta step, carrying the fraction into the chip count
+    next_frac = _mm512_add_epi32(code_frac, frac_step);
+    carry = _mm512_cmplt_epu32_mask(next_frac, code_frac);
+    code_chips = _mm512_add_epi32(code_chips, chip_step);
+    code_chips = _mm512_mask_add_epi32(code_chips, carry, code_chips, one);
+    code_frac = next_frac;
+
+    // Store values in output buffer
+    _mm512_storeu_ps(code, plut);
+    code += 16;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  code_phase =
+      ((uint64_t)(uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(code_chips))
+       << 32) |
+      (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(code_frac));
+
+  for (inda = sixteenth_points * 16; inda < num_points; ++inda) {
+    gnss_code_nco_idx(code_phase, &eCodeIdx, &pCodeIdx, &lCodeIdx);
+    code_phase += code_step;
+
+    *code++ = cacode[pCodeIdx];
+  }
+  nco->phase += (uint64_t)blk_size * code_step;
+}
+
+/*!
+ *  \brief Generates a NCO with a frequency rate based on the Parallel Lookup
+ * Table (PLUT) method
+ *  \details Every lane carries its own 32.32 phase and step in 64-bit lanes
+ * and moves them sixteen samples at a time, the phase by sixteen steps and
+ * 120 rates, the step by sixteen rates, so the second order phase model holds
+ * exactly in every lane. The table is read with 64-bit index gathers.
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table of GNSS_NCO_LUT_SIZE entries
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void avx512_nco_rate_si32(int32_t *sig_nco, const int32_t *lut,
+                          const int32_t blk_size, gnss_nco_rate_t *nco) {
+  int32_t inda;
+  const uint32_t sixteenth_points = blk_size / 16;
+  const uint64_t carr_rate = nco->rate;
+  uint64_t carr_phase = nco->phase;
+  uint64_t carr_step = nco->step;
+  uint64_t lane_phase[16], lane_step[16];
+
+  // Lane k starts k samples ahead of the accumulator
+  for (int k = 0; k < 16; k++) {
+    lane_phase[k] = carr_phase + k * carr_step + (k * (k - 1) / 2) * carr_rate;
+    lane_step[k] = carr_step + k * carr_rate;
+  }
+  __m512i phase_lo = _mm512_loadu_si512(lane_phase);
+  __m512i phase_hi = _mm512_loadu_si512(lane_phase + 8);
+  __m512i step_lo = _mm512_loadu_si512(lane_step);
+  __m512i step_hi = _mm512_loadu_si512(lane_step + 8);
+  const __m512i rate_16 = _mm512_set1_epi64(16 * carr_rate);
+  const __m512i rate_120 = _mm512_set1_epi64(120 * carr_rate);
+  __m256i sig_lo, sig_hi;
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // Look in lut with the GNSS_NCO_LUT_BITS upper bits of each phase
+    sig_lo = _mm512_i64gather_epi32(
+        _mm512_srli_epi64(phase_lo, 32 + GNSS_NCO_LUT_SHIFT), lut, 4);
+    sig_hi = _mm512_i64gather_epi32(
+        _mm512_srli_epi64(phase_hi, 32 + GNSS_NCO_LUT_SHIFT), lut, 4);
+
+    // Delta step, then the step itself moves by the rate
+    phase_lo = _mm512_add_epi64(
+        phase_lo, _mm512_add_epi64(_mm512_slli_epi64(step_lo, 4), rate_120));
+    phase_hi = _mm512_add_epi64(
+        phase_hi, _mm512_add_epi64(_mm512_slli_epi64(step_hi, 4), rate_120));
+    step_lo = _mm512_add_epi64(step_lo, rate_16);
+    step_hi = _mm512_add_epi64(step_hi, rate_16);
+
+    // Store values in output buffer
+    _mm512_storeu_si512(
+        sig_nco,
+        _mm512_inserti64x4(_mm512_castsi256_si512(sig_lo), sig_hi, 1));
+    sig_nco += 16;
+  }
+
+  // Lane 0 holds the phase and step of the first sample not generated yet
+  carr_phase = (uint64_t)_mm_cvtsi128_si64(_mm512_castsi512_si128(phase_lo));
+  carr_step = (uint64_t)_mm_cvtsi128_si64(_mm512_castsi512_si128(step_lo));
+
+  for (inda = sixteenth_points * 16; inda < blk_size; ++inda) {
+    *sig_nco++ = lut[carr_phase >> (32 + GNSS_NCO_LUT_SHIFT)];
+    carr_phase += carr_step;
+    carr_step += carr_rate;
+  }
+  nco->phase = carr_phase;
+  nco->step = carr_step;
+}
+
+/*!
+ *  \brief Generates an Early, Late and Prompt code with a code frequency rate
+ *  \details The code phase and step of every lane are carried in double
+ * precision, since the rate is far below the resolution of the 32.32 step,
+ * and move sixteen samples at a time as in avx512_nco_rate_si32(). The chip
+ * indices come from conversions rounding towards positive infinity.
+ *  \param[out] ecode Early replica of the ranging code
+ *  \param[out] pcode Prompt replica of the ranging code
+ *  \param[out] lcode Late replica of the ranging code
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of elements in the code vectors
+ *  \param[in,out] nco Code NCO state, advanced to the sample that follows the
+ * block
+ *  \param[in] code_rate Code step increment per sample, see
+ * gnss_code_nco_rate()
+ */
+void avx512_code_rate_si32(int32_t *ecode, int32_t *pcode, int32_t *lcode,
+                           const int32_t *cacode, const int32_t blk_size,
+                           gnss_code_nco_t *nco, const double code_rate) {
+  int32_t inda;
+  const uint32_t sixteenth_points = blk_size / 16;
+  double code_phase = gnss_code_nco_phase(nco);
+  double code_step = nco->step * (1.0 / 4294967296.0);
+  double lane_phase[16], lane_step[16];
+  const __m512d phase_offset[3] = {_mm512_set1_pd(-0.5), _mm512_setzero_pd(),
+                                   _mm512_set1_pd(0.5)};
+
+  // Lane k starts k samples ahead of the accumulator
+  for (int k = 0; k < 16; k++) {
+    lane_phase[k] = code_phase + k * code_step + 0.5 * k * (k - 1) * code_rate;
+    lane_step[k] = code_step + k * code_rate;
+  }
+  __m512d phase_lo = _mm512_loadu_pd(lane_phase);
+  __m512d phase_hi = _mm512_loadu_pd(lane_phase + 8);
+  __m512d step_lo = _mm512_loadu_pd(lane_step);
+  __m512d step_hi = _mm512_loadu_pd(lane_step + 8);
+  const __m512d sixteen = _mm512_set1_pd(16.0);
+  const __m512d rate_16 = _mm512_set1_pd(16.0 * code_rate);
+  const __m512d rate_120 = _mm512_set1_pd(120.0 * code_rate);
+  int32_t *code[3] = {ecode, pcode, lcode};
+  __m256i idx_lo, idx_hi;
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    for (int r = 0; r < 3; r++) {
+      // Round up to the next chip, half a chip early and late
+      idx_lo = _mm512_cvt_roundpd_epi32(
+          _mm512_add_pd(phase_lo, phase_offset[r]),
+          _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+      idx_hi = _mm512_cvt_roundpd_epi32(
+          _mm512_add_pd(phase_hi, phase_offset[r]),
+          _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+
+      // Look in lut and store values in output buffer
+      _mm512_storeu_si512(
+          code[r],
+          _mm512_i32gather_epi32(
+              _mm512_inserti64x4(_mm512_castsi256_si512(idx_lo), idx_hi, 1),
+              cacode, 4));
+      code[r] += 16;
+    }
+
+    // Delta step, then the step itself moves by the rate
+    phase_lo = _mm512_add_pd(
+        phase_lo, _mm512_add_pd(_mm512_mul_pd(step_lo, sixteen), rate_120));
+    phase_hi = _mm512_add_pd(
+        phase_hi, _mm512_add_pd(_mm512_mul_pd(step_hi, sixteen), rate_120));
+    step_lo = _mm512_add_pd(step_lo, rate_16);
+    step_hi = _mm512_add_pd(step_hi, rate_16);
+  }
+
+  // Lane 0 holds the phase and step of the first sample not generated yet
+  code_phase = _mm512_cvtsd_f64(phase_lo);
+  code_step = _mm512_cvtsd_f64(step_lo);
+
+  for (inda = sixteenth_points * 16; inda < blk_size; ++inda) {
+    *code[0]++ = cacode[(int32_t)ceil(code_phase - 0.5)];
+    *code[1]++ = cacode[(int32_t)ceil(code_phase)];
+    *code[2]++ = cacode[(int32_t)ceil(code_phase + 0.5)];
+    code_phase += code_step;
+    code_step += code_rate;
+  }
+  nco->phase = (uint64_t)(int64_t)floor(code_phase * 4294967296.0 + 0.5);
+  nco->step = (uint64_t)(code_step * 4294967296.0 + 0.5);
+}
+
+/*!
+ *  \brief Wipes off the carrier, generates the Early, Prompt and Late codes and
+ * correlates them against the raw signal in a single pass as si32 types
+ *  \details Fuses avx512_nco_si32(), avx512_code_si32(), the carrier mixing and
+ * avx512_correlate_epl_si32(). Carrier and code replicas only live in
+ * registers, so no intermediate blk_size buffers are written or read back.
+ *  \param[out] i_e Early in-phase correlation
+ *  \param[out] i_p Prompt in-phase correlation
+ *  \param[out] i_l Late in-phase correlation
+ *  \param[out] q_e Early quadrature correlation
+ *  \param[out] q_p Prompt quadrature correlation
+ *  \param[out] q_l Late quadrature correlation
+ *  \param[in] signal Raw real signal samples
+ *  \param[in] sin_lut Sine lookup table of 256 entries
+ *  \param[in] cos_lut Cosine lookup table of 256 entries
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of samples to correlate
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void avx512_fused_epl_si32(double *i_e, double *i_p, double *i_l, double *q_e,
+                           double *q_p, double *q_l, const int8_t *signal,
+                           const int32_t *sin_lut, const int32_t *cos_lut,
+                           const int32_t *cacode, const int32_t blk_size,
+                           const double rem_carr_phase, const double carr_freq,
+                           const double rem_code_phase, const double code_freq,
+                           const double samp_freq) {
+
+  int32_t inda, k;
+  const uint32_t sixteenth_points = blk_size / 16;
+  int32_t tempBuffer[6][16];
+  int32_t returnValue[6] = {0, 0, 0, 0, 0, 0};
+  int32_t sinMix, cosMix;
+
+  // Carrier NCO declarations
+  const uint32_t nom_carr_step =
+      (uint32_t)(carr_freq * (4294967296.0 / samp_freq) + 0.5);
+  uint32_t nom_carr_phase_base =
+      (uint32_t)(rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+  uint32_t nom_carr_idx = 0;
+
+  __m512i carr_phase_base = _mm512_set1_epi32(nom_carr_phase_base);
+  __m512i carr_step_base =
+      _mm512_set_epi32(
+      15 * nom_carr_step, 14 * nom_carr_step, 13 * nom_carr_step,
+      12 * nom_carr_step, 11 * nom_carr_step, 10 * nom_carr_step,
+      9 * nom_carr_step, 8 * nom_carr_step, 7 * nom_carr_step,
+      6 * nom_carr_step, 5 * nom_carr_step, 4 * nom_carr_step,
+      3 * nom_carr_step, 2 * nom_carr_step, 1 * nom_carr_step,
+      0 * nom_carr_step);
+  __m512i carr_step_offset = _mm512_set1_epi32(16 * nom_carr_step);
+  __m512i carr_idx;
+
+  // Code NCO declarations, kept in fl32 to match avx512_code_si32()
+  const float earlyLateSpc = 0.5;
+  const float remCodePhase = (float)rem_code_phase;
+  const float codePhaseStep = (float)code_freq / (float)samp_freq;
+  float baseCode;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  __m512 ecode_phase_base = _mm512_set1_ps(remCodePhase - earlyLateSpc + 0.5);
+  __m512 pcode_phase_base = _mm512_set1_ps(remCodePhase + 0.5);
+  __m512 lcode_phase_base = _mm512_set1_ps(remCodePhase + earlyLateSpc + 0.5);
+  __m512 code_step_base =
+      _mm512_set_ps(15 * codePhaseStep, 14 * codePhaseStep, 13 * codePhaseStep,
+                    12 * codePhaseStep, 11 * codePhaseStep, 10 * codePhaseStep,
+                    9 * codePhaseStep, 8 * codePhaseStep, 7 * codePhaseStep,
+                    6 * codePhaseStep, 5 * codePhaseStep, 4 * codePhaseStep,
+                    3 * codePhaseStep, 2 * codePhaseStep, 1 * codePhaseStep,
+                    0 * codePhaseStep);
+  __m512 code_step_offset = _mm512_set1_ps(16 * codePhaseStep);
+  __m512i ecode_idx, pcode_idx, lcode_idx;
+
+  __m512i sig, sinVal, cosVal, eVal, pVal, lVal;
+  __m512i acc_ie = _mm512_setzero_si512();
+  __m512i acc_ip = _mm512_setzero_si512();
+  __m512i acc_il = _mm512_setzero_si512();
+  __m512i acc_qe = _mm512_setzero_si512();
+  __m512i acc_qp = _mm512_setzero_si512();
+  __m512i acc_ql = _mm512_setzero_si512();
+
+  // First iteration happens outside the loop
+  carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_base);
+  ecode_phase_base = _mm512_add_ps(ecode_phase_base, code_step_base);
+  pcode_phase_base = _mm512_add_ps(pcode_phase_base, code_step_base);
+  lcode_phase_base = _mm512_add_ps(lcode_phase_base, code_step_base);
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // 1- Sign extend sixteen int8 samples into si32 lanes
+    sig = _mm512_cvtepi8_epi32(_mm_loadu_si128((__m128i *)signal));
+
+    // 2- Carrier generation and wipeoff
+    carr_idx = _mm512_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT);
+    sinVal = _mm512_i32gather_epi32(carr_idx, sin_lut, 4);
+    cosVal = _mm512_i32gather_epi32(carr_idx, cos_lut, 4);
+    sinVal = _mm512_mullo_epi32(sinVal, sig);
+    cosVal = _mm512_mullo_epi32(cosVal, sig);
+
+    // 3- Early, Prompt and Late code generation
+    ecode_idx = _mm512_cvtps_epi32(ecode_phase_base);
+    pcode_idx = _mm512_cvtps_epi32(pcode_phase_base);
+    lcode_idx = _mm512_cvtps_epi32(lcode_phase_base);
+    eVal = _mm512_i32gather_epi32(ecode_idx, cacode, 4);
+    pVal = _mm512_i32gather_epi32(pcode_idx, cacode, 4);
+    lVal = _mm512_i32gather_epi32(lcode_idx, cacode, 4);
+
+    // 4- Correlation
+    acc_ie = _mm512_add_epi32(acc_ie, _mm512_mullo_epi32(eVal, sinVal));
+    acc_ip = _mm512_add_epi32(acc_ip, _mm512_mullo_epi32(pVal, sinVal));
+    acc_il = _mm512_add_epi32(acc_il, _mm512_mullo_epi32(lVal, sinVal));
+    acc_qe = _mm512_add_epi32(acc_qe, _mm512_mullo_epi32(eVal, cosVal));
+    acc_qp = _mm512_add_epi32(acc_qp, _mm512_mullo_epi32(pVal, cosVal));
+    acc_ql = _mm512_add_epi32(acc_ql, _mm512_mullo_epi32(lVal, cosVal));
+
+    // 5- Delta step
+    carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_offset);
+    ecode_phase_base = _mm512_add_ps(ecode_phase_base, code_step_offset);
+    pcode_phase_base = _mm512_add_ps(pcode_phase_base, code_step_offset);
+    lcode_phase_base = _mm512_add_ps(lcode_phase_base, code_step_offset);
+
+    // 6- Update pointers
+    signal += 16;
+  }
+
+  _mm512_storeu_si512((__m512i *)tempBuffer[0], acc_ie);
+  _mm512_storeu_si512((__m512i *)tempBuffer[1], acc_ip);
+  _mm512_storeu_si512((__m512i *)tempBuffer[2], acc_il);
+  _mm512_storeu_si512((__m512i *)tempBuffer[3], acc_qe);
+  _mm512_storeu_si512((__m512i *)tempBuffer[4], acc_qp);
+  _mm512_storeu_si512((__m512i *)tempBuffer[5], acc_ql);
+
+  for (k = 0; k < 6; k++) {
+    returnValue[k] = tempBuffer[k][0];
+    returnValue[k] += tempBuffer[k][1];
+    returnValue[k] += tempBuffer[k][2];
+    returnValue[k] += tempBuffer[k][3];
+    returnValue[k] += tempBuffer[k][4];
+    returnValue[k] += tempBuffer[k][5];
+    returnValue[k] += tempBuffer[k][6];
+    returnValue[k] += tempBuffer[k][7];
+    returnValue[k] += tempBuffer[k][8];
+    returnValue[k] += tempBuffer[k][9];
+    returnValue[k] += tempBuffer[k][10];
+    returnValue[k] += tempBuffer[k][11];
+    returnValue[k] += tempBuffer[k][12];
+    returnValue[k] += tempBuffer[k][13];
+    returnValue[k] += tempBuffer[k][14];
+    returnValue[k] += tempBuffer[k][15];
+  }
+
+  inda = sixteenth_points * 16;
+  nom_carr_phase_base += inda * nom_carr_step;
+
+  // Perform non SIMD leftover operations
+  for (; inda < blk_size; ++inda) {
+    nom_carr_idx =
+        (nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT) & GNSS_NCO_LUT_MASK;
+    sinMix = sin_lut[nom_carr_idx] * (*signal);
+    cosMix = cos_lut[nom_carr_idx] * (*signal++);
+    nom_carr_phase_base += nom_carr_step;
+
+    baseCode = (inda * codePhaseStep + remCodePhase);
+    pCodeIdx = (int32_t)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
+    eCodeIdx = (int32_t)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
+                   ? (baseCode - earlyLateSpc + 1)
+                   : (baseCode - earlyLateSpc);
+    lCodeIdx = (int32_t)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
+                   ? (baseCode + earlyLateSpc + 1)
+                   : (baseCode + earlyLateSpc);
+
+    returnValue[0] += cacode[eCodeIdx] * sinMix;
+    returnValue[1] += cacode[pCodeIdx] * sinMix;
+    returnValue[2] += cacode[lCodeIdx] * sinMix;
+    returnValue[3] += cacode[eCodeIdx] * cosMix;
+    returnValue[4] += cacode[pCodeIdx] * cosMix;
+    returnValue[5] += cacode[lCodeIdx] * cosMix;
+  }
+
+  *i_e = returnValue[0];
+  *i_p = returnValue[1];
+  *i_l = returnValue[2];
+  *q_e = returnValue[3];
+  *q_p = returnValue[4];
+  *q_l = returnValue[5];
+}
+
+/*!
+ *  \brief Wipes off the carrier of interleaved I/Q int8 samples as si32 types
+ *  \details Performs the full complex multiply of the baseband samples with the
+ * carrier replica, sig_sin = I * sin + Q * cos and sig_cos = I * cos - Q * sin,
+ * matching the real data convention where the in-phase arm is correlated
+ * against the sine. Carrier values are packed next to each other as int16 pairs
+ * so that a single madd_epi16 wipes off 16 samples per arm.
+ *  \pre Carrier replica values must fit in int16_t.
+ *  \param[out] sig_sin Baseband signal mixed with the sine carrier
+ *  \param[out] sig_cos Baseband signal mixed with the cosine carrier
+ *  \param[in] signal Interleaved I/Q samples, 2 * blk_size elements
+ *  \param[in] sin_nco Sine carrier replica
+ *  \param[in] cos_nco Cosine carrier replica
+ *  \param[in] blk_size Total number of complex samples
+ */
+void avx512_mix_iq8_si32(int32_t *sig_sin, int32_t *sig_cos,
+                         const int8_t *signal, const int32_t *sin_nco,
+                         const int32_t *cos_nco, const int32_t blk_size) {
+
+  int32_t inda;
+  const uint32_t sixteenth_points = blk_size / 16;
+
+  // Important variable declarations
+  const __m512i zero = _mm512_setzero_si512();
+  __m512i iq, sinVal, cosVal, sinCos, cosNegSin;
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+
+    // Sign extend sixteen I/Q pairs into si16 lanes
+    iq = _mm512_cvtepi8_epi16(_mm256_loadu_si256((__m256i *)signal));
+
+    // Pack the carrier as (sin, cos) and (cos, -sin) si16 pairs
+    sinVal = _mm512_loadu_si512((__m512i *)sin_nco);
+    cosVal = _mm512_loadu_si512((__m512i *)cos_nco);
+    sinCos = _mm512_mask_blend_epi16(0xAAAAAAAA, sinVal,
+                                     _mm512_slli_epi32(cosVal, 16));
+    cosNegSin = _mm512_mask_blend_epi16(
+        0xAAAAAAAA, cosVal,
+        _mm512_slli_epi32(_mm512_sub_epi32(zero, sinVal), 16));
+
+    // I * sin + Q * cos and I * cos - Q * sin
+    _mm512_storeu_si512((__m512i *)sig_sin, _mm512_madd_epi16(iq, sinCos));
+    _mm512_storeu_si512((__m512i *)sig_cos, _mm512_madd_epi16(iq, cosNegSin));
+
+    // Increment pointers
+    signal += 32;
+    sin_nco += 16;
+    cos_nco += 16;
+    sig_sin += 16;
+    sig_cos += 16;
+  }
+
+  // Perform non SIMD leftover operations
+  for (inda = sixteenth_points * 16; inda < blk_size; inda++) {
+    *sig_sin++ = signal[0] * (*sin_nco) + signal[1] * (*cos_nco);
+    *sig_cos++ = signal[0] * (*cos_nco++) - signal[1] * (*sin_nco++);
+    signal += 2;
+  }
+}
+
+/*!
+ *  \brief Wipes off the carrier of interleaved I/Q int16 samples as si32 types
+ *  \details Performs the full complex multiply of the baseband samples with the
+ * carrier replica, sig_sin = I * sin + Q * cos and sig_cos = I * cos - Q * sin,
+ * matching the real data convention where the in-phase arm is correlated
+ * against the sine. Carrier values are packed next to each other as int16 pairs
+ * so that a single madd_epi16 wipes off 16 samples per arm.
+ *  \pre Carrier replica values must fit in int16_t.
+ *  \param[out] sig_sin Baseband signal mixed with the sine carrier
+ *  \param[out] sig_cos Baseband signal mixed with the cosine carrier
+ *  \param[in] signal Interleaved I/Q samples, 2 * blk_size elements
+ *  \param[in] sin_nco Sine carrier replica
+ *  \param[in] cos_nco Cosine carrier replica
+ *  \param[in] blk_size Total number of complex samples
+ */
+void avx512_mix_iq16_si32(int32_t *sig_sin, int32_t *sig_cos,
+                          const int16_t *signal, const int32_t *sin_nco,
+                          const int32_t *cos_nco, const int32_t blk_size) {
+
+  int32_t inda;
+  const uint32_t sixteenth_points = blk_size / 16;
+
+  // Important variable declarations
+  const __m512i zero = _mm512_setzero_si512();
+  __m512i iq, sinVal, cosVal, sinCos, cosNegSin;
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+
+    // Load sixteen I/Q pairs as si16 lanes
+    iq = _mm512_loadu_si512((__m512i *)signal);
+
+    // Pack the carrier as (sin, cos) and (cos, -sin) si16 pairs
+    sinVal = _mm512_loadu_si512((__m512i *)sin_nco);
+    cosVal = _mm512_loadu_si512((__m512i *)cos_nco);
+    sinCos = _mm512_mask_blend_epi16(0xAAAAAAAA, sinVal,
+                                     _mm512_slli_epi32(cosVal, 16));
+    cosNegSin = _mm512_mask_blend_epi16(
+        0xAAAAAAAA, cosVal,
+        _mm512_slli_epi32(_mm512_sub_epi32(zero, sinVal), 16));
+
+    // I * sin + Q * cos and I * cos - Q * sin
+    _mm512_storeu_si512((__m512i *)sig_sin, _mm512_madd_epi16(iq, sinCos));
+    _mm512_storeu_si512((__m512i *)sig_cos, _mm512_madd_epi16(iq, cosNegSin));
+
+    // Increment pointers
+    signal += 32;
+    sin_nco += 16;
+    cos_nco += 16;
+    sig_sin += 16;
+    sig_cos += 16;
+  }
+
+  // Perform non SIMD leftover operations
+  for (inda = sixteenth_points * 16; inda < blk_size; inda++) {
+    *sig_sin++ = signal[0] * (*sin_nco) + signal[1] * (*cos_nco);
+    *sig_cos++ = signal[0] * (*cos_nco++) - signal[1] * (*sin_nco++);
+    signal += 2;
+  }
+}
+
+/*!
+ *  \brief Wipes off the carrier, generates the Early, Prompt and Late codes and
+ * correlates them against interleaved I/Q int8 samples in a single pass as si32
+ * types
+ *  \details Complex input counterpart of avx512_fused_epl_si32(). The carrier
+ * is wiped off with the full complex multiply of avx512_mix_iq8_si32(), a
+ * single madd_epi16 per arm on (sin, cos) and (cos, -sin) si16 pairs.
+ *  \pre Carrier lookup table values must fit in int16_t.
+ *  \param[out] i_e Early in-phase correlation
+ *  \param[out] i_p Prompt in-phase correlation
+ *  \param[out] i_l Late in-phase correlation
+ *  \param[out] q_e Early quadrature correlation
+ *  \param[out] q_p Prompt quadrature correlation
+ *  \param[out] q_l Late quadrature correlation
+ *  \param[in] signal Interleaved I/Q samples, 2 * blk_size elements
+ *  \param[in] sin_lut Sine lookup table of 256 entries
+ *  \param[in] cos_lut Cosine lookup table of 256 entries
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of complex samples to correlate
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void avx512_fused_epl_iq8_si32(double *i_e, double *i_p, double *i_l,
+                               double *q_e, double *q_p, double *q_l,
+                               const int8_t *signal, const int32_t *sin_lut,
+                               const int32_t *cos_lut, const int32_t *cacode,
+                               const int32_t blk_size,
+                               const double rem_carr_phase,
+                               const double carr_freq,
+                               const double rem_code_phase,
+                               const double code_freq, const double samp_freq) {
+
+  int32_t inda, k;
+  const uint32_t sixteenth_points = blk_size / 16;
+  int32_t tempBuffer[6][16];
+  int32_t returnValue[6] = {0, 0, 0, 0, 0, 0};
+  int32_t sinMix, cosMix;
+
+  // Carrier NCO declarations
+  const uint32_t nom_carr_step =
+      (uint32_t)(carr_freq * (4294967296.0 / samp_freq) + 0.5);
+  uint32_t nom_carr_phase_base =
+      (uint32_t)(rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+  uint32_t nom_carr_idx = 0;
+
+  __m512i carr_phase_base = _mm512_set1_epi32(nom_carr_phase_base);
+  __m512i carr_step_base =
+      _mm512_set_epi32(
+      15 * nom_carr_step, 14 * nom_carr_step, 13 * nom_carr_step,
+      12 * nom_carr_step, 11 * nom_carr_step, 10 * nom_carr_step,
+      9 * nom_carr_step, 8 * nom_carr_step, 7 * nom_carr_step,
+      6 * nom_carr_step, 5 * nom_carr_step, 4 * nom_carr_step,
+      3 * nom_carr_step, 2 * nom_carr_step, 1 * nom_carr_step,
+      0 * nom_carr_step);
+  __m512i carr_step_offset = _mm512_set1_epi32(16 * nom_carr_step);
+  __m512i carr_idx;
+
+  // Code NCO declarations, kept in fl32 to match avx512_code_si32()
+  const float earlyLateSpc = 0.5;
+  const float remCodePhase = (float)rem_code_phase;
+  const float codePhaseStep = (float)code_freq / (float)samp_freq;
+  float baseCode;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  __m512 ecode_phase_base = _mm512_set1_ps(remCodePhase - earlyLateSpc + 0.5);
+  __m512 pcode_phase_base = _mm512_set1_ps(remCodePhase + 0.5);
+  __m512 lcode_phase_base = _mm512_set1_ps(remCodePhase + earlyLateSpc + 0.5);
+  __m512 code_step_base =
+      _mm512_set_ps(15 * codePhaseStep, 14 * codePhaseStep, 13 * codePhaseStep,
+                    12 * codePhaseStep, 11 * codePhaseStep, 10 * codePhaseStep,
+                    9 * codePhaseStep, 8 * codePhaseStep, 7 * codePhaseStep,
+                    6 * codePhaseStep, 5 * codePhaseStep, 4 * codePhaseStep,
+                    3 * codePhaseStep, 2 * codePhaseStep, 1 * codePhaseStep,
+                    0 * codePhaseStep);
+  __m512 code_step_offset = _mm512_set1_ps(16 * codePhaseStep);
+  __m512i ecode_idx, pcode_idx, lcode_idx;
+
+  const __m512i zero = _mm512_setzero_si512();
+  __m512i sig, sinVal, cosVal, sinCos, cosNegSin, eVal, pVal, lVal;
+  __m512i acc_ie = _mm512_setzero_si512();
+  __m512i acc_ip = _mm512_setzero_si512();
+  __m512i acc_il = _mm512_setzero_si512();
+  __m512i acc_qe = _mm512_setzero_si512();
+  __m512i acc_qp = _mm512_setzero_si512();
+  __m512i acc_ql = _mm512_setzero_si512();
+
+  // First iteration happens outside the loop
+  carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_base);
+  ecode_phase_base = _mm512_add_ps(ecode_phase_base, code_step_base);
+  pcode_phase_base = _mm512_add_ps(pcode_phase_base, code_step_base);
+  lcode_phase_base = _mm512_add_ps(lcode_phase_base, code_step_base);
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // 1- Sign extend sixteen I/Q pairs into si16 lanes
+    sig = _mm512_cvtepi8_epi16(_mm256_loadu_si256((__m256i *)signal));
+
+    // 2- Carrier generation and complex wipeoff
+    carr_idx = _mm512_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT);
+    sinVal = _mm512_i32gather_epi32(carr_idx, sin_lut, 4);
+    cosVal = _mm512_i32gather_epi32(carr_idx, cos_lut, 4);
+    sinCos = _mm512_mask_blend_epi16(0xAAAAAAAA, sinVal,
+                                     _mm512_slli_epi32(cosVal, 16));
+    cosNegSin = _mm512_mask_blend_epi16(
+        0xAAAAAAAA, cosVal,
+        _mm512_slli_epi32(_mm512_sub_epi32(zero, sinVal), 16));
+    sinVal = _mm512_madd_epi16(sig, sinCos);
+    cosVal = _mm512_madd_epi16(sig, cosNegSin);
+
+    // 3- Early, Prompt and Late code generation
+    ecode_idx = _mm512_cvtps_epi32(ecode_phase_base);
+    pcode_idx = _mm512_cvtps_epi32(pcode_phase_base);
+    lcode_idx = _mm512_cvtps_epi32(lcode_phase_base);
+    eVal = _mm512_i32gather_epi32(ecode_idx, cacode, 4);
+    pVal = _mm512_i32gather_epi32(pcode_idx, cacode, 4);
+    lVal = _mm512_i32gather_epi32(lcode_idx, cacode, 4);
+
+    // 4- Correlation
+    acc_ie = _mm512_add_epi32(acc_ie, _mm512_mullo_epi32(eVal, sinVal));
+    acc_ip = _mm512_add_epi32(acc_ip, _mm512_mullo_epi32(pVal, sinVal));
+    acc_il = _mm512_add_epi32(acc_il, _mm512_mullo_epi32(lVal, sinVal));
+    acc_qe = _mm512_add_epi32(acc_qe, _mm512_mullo_epi32(eVal, cosVal));
+    acc_qp = _mm512_add_epi32(acc_qp, _mm512_mullo_epi32(pVal, cosVal));
+    acc_ql = _mm512_add_epi32(acc_ql, _mm512_mullo_epi32(lVal, cosVal));
+
+    // 5- Delta step
+    carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_offset);
+    ecode_phase_base = _mm512_add_ps(ecode_phase_base, code_step_offset);
+    pcode_phase_base = _mm512_add_ps(pcode_phase_base, code_step_offset);
+    lcode_phase_base = _mm512_add_ps(lcode_phase_base, code_step_offset);
+
+    // 6- Update pointers
+    signal += 32;
+  }
+
+  _mm512_storeu_si512((__m512i *)tempBuffer[0], acc_ie);
+  _mm512_storeu_si512((__m512i *)tempBuffer[1], acc_ip);
+  _mm512_storeu_si512((__m512i *)tempBuffer[2], acc_il);
+  _mm512_storeu_si512((__m512i *)tempBuffer[3], acc_qe);
+  _mm512_storeu_si512((__m512i *)tempBuffer[4], acc_qp);
+  _mm512_storeu_si512((__m512i *)tempBuffer[5], acc_ql);
+
+  for (k = 0; k < 6; k++) {
+    returnValue[k] = tempBuffer[k][0];
+    returnValue[k] += tempBuffer[k][1];
+    returnValue[k] += tempBuffer[k][2];
+    returnValue[k] += tempBuffer[k][3];
+    returnValue[k] += tempBuffer[k][4];
+    returnValue[k] += tempBuffer[k][5];
+    returnValue[k] += tempBuffer[k][6];
+    returnValue[k] += tempBuffer[k][7];
+    returnValue[k] += tempBuffer[k][8];
+    returnValue[k] += tempBuffer[k][9];
+    returnValue[k] += tempBuffer[k][10];
+    returnValue[k] += tempBuffer[k][11];
+    returnValue[k] += tempBuffer[k][12];
+    returnValue[k] += tempBuffer[k][13];
+    returnValue[k] += tempBuffer[k][14];
+    returnValue[k] += tempBuffer[k][15];
+  }
+
+  inda = sixteenth_points * 16;
+  nom_carr_phase_base += inda * nom_carr_step;
+
+  // Perform non SIMD leftover operations
+  for (; inda < blk_size; ++inda) {
+    nom_carr_idx =
+        (nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT) & GNSS_NCO_LUT_MASK;
+    sinMix = signal[0] * sin_lut[nom_carr_idx] +
+             signal[1] * cos_lut[nom_carr_idx];
+    cosMix = signal[0] * cos_lut[nom_carr_idx] -
+             signal[1] * sin_lut[nom_carr_idx];
+    signal += 2;
+    nom_carr_phase_base += nom_carr_step;
+
+    baseCode = (inda * codePhaseStep + remCodePhase);
+    pCodeIdx = (int32_t)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
+    eCodeIdx = (int32_t)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
+                   ? (baseCode - earlyLateSpc + 1)
+                   : (baseCode - earlyLateSpc);
+    lCodeIdx = (int32_t)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
+                   ? (baseCode + earlyLateSpc + 1)
+                   : (baseCode + earlyLateSpc);
+
+    returnValue[0] += cacode[eCodeIdx] * sinMix;
+    returnValue[1] += cacode[pCodeIdx] * sinMix;
+    returnValue[2] += cacode[lCodeIdx] * sinMix;
+    returnValue[3] += cacode[eCodeIdx] * cosMix;
+    returnValue[4] += cacode[pCodeIdx] * cosMix;
+    returnValue[5] += cacode[lCodeIdx] * cosMix;
+  }
+
+  *i_e = returnValue[0];
+  *i_p = returnValue[1];
+  *i_l = returnValue[2];
+  *q_e = returnValue[3];
+  *q_p = returnValue[4];
+  *q_l = returnValue[5];
+}
+
+/*!
+ *  \brief Correlates the in-phase and quadrature baseband signals against an
+ * arbitrary number of code replicas in a single pass as si32 types
+ *  \details Generalizes avx512_code_si32() and avx512_correlate_epl_si32() to
+ * num_taps replicas, each one delayed by tap_offsets[t] chips from the prompt
+ * replica. Every sample of sig_sin and sig_cos is loaded once and correlated
+ * against all the taps before moving on, so no code buffers are written and
+ * the memory traffic does not grow with the number of taps up to
+ * GNSS_MAX_TAPS.
+ *  \pre cacode[ceil(rem_code_phase + tap_offsets[t] + k * code_freq /
+ * samp_freq)] must be readable for every tap t and sample k. The 1025 entries
+ * caCode.bin layout only pads one chip on each side, which covers offsets
+ * within +/-0.5 chips. Wider tap spacings need a code padded with at least
+ * ceil(max|tap_offsets|) chips on each side, and cacode pointing to the entry
+ * that holds the last chip of the code, so that negative indices stay inside
+ * the buffer.
+ *  \param[out] i_taps In-phase correlation of each tap
+ *  \param[out] q_taps Quadrature correlation of each tap
+ *  \param[in] sig_sin Baseband signal mixed with the sine carrier
+ *  \param[in] sig_cos Baseband signal mixed with the cosine carrier
+ *  \param[in] cacode Padded satellite ranging code
+ *  \param[in] tap_offsets Offset of each tap from the prompt replica in chips
+ *  \param[in] num_taps Number of taps, nothing is correlated below 1. Up to
+ * GNSS_MAX_TAPS taps are correlated per pass over the signal
+ *  \param[in] blk_size Total number of samples to correlate
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void avx512_correlate_ntap_si32(double *i_taps, double *q_taps,
+                                const int32_t *sig_sin, const int32_t *sig_cos,
+                                const int32_t *cacode, const float *tap_offsets,
+                                const int32_t num_taps, const int32_t blk_size,
+                                const float rem_code_phase,
+                                const float code_freq, const float samp_freq) {
+
+  int32_t inda, t, k;
+  const int32_t taps = (num_taps < GNSS_MAX_TAPS) ? num_taps : GNSS_MAX_TAPS;
+  const uint32_t sixteenth_points = blk_size / 16;
+  float codePhaseStep = code_freq / samp_freq;
+  float baseCode;
+  int32_t codeIdx;
+  int32_t tempBuffer[16];
+  int32_t returnValue[2];
+
+  if (num_taps < 1) {
+    return;
+  }
+
+  // Taps beyond the accumulators are correlated in further passes
+  if (num_taps > GNSS_MAX_TAPS) {
+    avx512_correlate_ntap_si32(
+        i_taps + GNSS_MAX_TAPS, q_taps + GNSS_MAX_TAPS, sig_sin, sig_cos,
+        cacode, tap_offsets + GNSS_MAX_TAPS, num_taps - GNSS_MAX_TAPS,
+        blk_size, rem_code_phase, code_freq, samp_freq);
+  }
+
+  // Accumulators of every tap are kept in L1 between iterations
+  __m512i acc_i[GNSS_MAX_TAPS], acc_q[GNSS_MAX_TAPS];
+
+  // Important variable declarations
+  __m512 code_phase_base = _mm512_set1_ps(rem_code_phase + 0.5);
+  __m512 code_step_base =
+      _mm512_set_ps(15 * codePhaseStep, 14 * codePhaseStep, 13 * codePhaseStep,
+                    12 * codePhaseStep, 11 * codePhaseStep, 10 * codePhaseStep,
+                    9 * codePhaseStep, 8 * codePhaseStep, 7 * codePhaseStep,
+                    6 * codePhaseStep, 5 * codePhaseStep, 4 * codePhaseStep,
+                    3 * codePhaseStep, 2 * codePhaseStep, 1 * codePhaseStep,
+                    0 * codePhaseStep);
+  __m512 code_step_offset = _mm512_set1_ps(16 * codePhaseStep);
+  __m512i code_idx;
+  __m512i codeVal, sinVal, cosVal;
+
+  for (t = 0; t < taps; t++) {
+    acc_i[t] = _mm512_setzero_si512();
+    acc_q[t] = _mm512_setzero_si512();
+  }
+
+  // First iteration happens outside the loop
+  code_phase_base = _mm512_add_ps(code_phase_base, code_step_base);
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+
+    // Load the baseband samples only once for all the taps
+    sinVal = _mm512_loadu_si512((__m512i *)sig_sin);
+    cosVal = _mm512_loadu_si512((__m512i *)sig_cos);
+
+    for (t = 0; t < taps; t++) {
+      // Obtain the code index of the tap and look in the code table
+      code_idx = _mm512_cvtps_epi32(
+          _mm512_add_ps(code_phase_base, _mm512_set1_ps(tap_offsets[t])));
+      codeVal = _mm512_i32gather_epi32(code_idx, cacode, 4);
+
+      // Multiply and accumulate both arms
+      acc_i[t] =
+          _mm512_add_epi32(acc_i[t], _mm512_mullo_epi32(codeVal, sinVal));
+      acc_q[t] =
+          _mm512_add_epi32(acc_q[t], _mm512_mullo_epi32(codeVal, cosVal));
+    }
+
+    // Delta step
+    code_phase_base = _mm512_add_ps(code_phase_base, code_step_offset);
+
+    // Increment pointers
+    sig_sin += 16;
+    sig_cos += 16;
+  }
+
+  for (t = 0; t < taps; t++) {
+    _mm512_storeu_si512((__m512i *)tempBuffer, acc_i[t]);
+    returnValue[0] = tempBuffer[0];
+    for (k = 1; k < 16; k++) {
+      returnValue[0] += tempBuffer[k];
+    }
+    _mm512_storeu_si512((__m512i *)tempBuffer, acc_q[t]);
+    returnValue[1] = tempBuffer[0];
+    for (k = 1; k < 16; k++) {
+      returnValue[1] += tempBuffer[k];
+    }
+
+    // Perform non SIMD leftover operations
+    for (inda = sixteenth_points * 16; inda < blk_size; inda++) {
+      baseCode = inda * codePhaseStep + rem_code_phase + tap_offsets[t];
+      codeIdx = (int32_t)baseCode < baseCode ? (int32_t)baseCode + 1
+                                             : (int32_t)baseCode;
+      returnValue[0] += cacode[codeIdx] * sig_sin[inda - sixteenth_points * 16];
+      returnValue[1] += cacode[codeIdx] * sig_cos[inda - sixteenth_points * 16];
+    }
+
+    i_taps[t] = returnValue[0];
+    q_taps[t] = returnValue[1];
+  }
+}
+
+/*!
+ *  \brief Multiply and accumulates product of two vectors storing the result in
+ * an fl32 type
+ * \param[in] avector First vector to multiply
+ * \param[in] bvector Second vector to multiply
+ * \param[in] num_points Number of points in each vector
+ */
+static inline double avx512_mul_and_acc_si32(const int32_t *avector,
+                                             const int32_t *bvector,
+                                             uint32_t num_points) {
+
+  int32_t returnValue = 0;
+  uint32_t number = 0;
+  const uint32_t sixteenth_points = num_points / 16;
+
+  const int32_t *aPtr = avector;
+  const int32_t *bPtr = bvector;
+  int32_t tempBuffer[16];
+
+  __m512i aVal, bVal, cVal;
+  __m512i accumulator = _mm512_setzero_si512();
+
+  for (; number < sixteenth_points; number++) {
+
+    // Load 256-bits of integer data from memory into dst. mem_addr does not
+    // need to be aligned on any particular boundary.
+    aVal = _mm512_loadu_si512((__m512i *)aPtr);
+    bVal = _mm512_loadu_si512((__m512i *)bPtr);
+
+    // TODO: More efficient way to exclude having this intermediate cVal
+    // variable??
+    cVal = _mm512_mullo_epi32(aVal, bVal);
+
+    // accumulator += _mm256_mullo_epi16(aVal, bVal);
+    accumulator = _mm512_add_epi32(accumulator, cVal);
+
+    // Increment pointers
+    aPtr += 16;
+    bPtr += 16;
+  }
+
+  _mm512_storeu_si512((__m512i *)tempBuffer, accumulator);
+
+  returnValue = tempBuffer[0];
+  returnValue += tempBuffer[1];
+  returnValue += tempBuffer[2];
+  returnValue += tempBuffer[3];
+  returnValue += tempBuffer[4];
+  returnValue += tempBuffer[5];
+  returnValue += tempBuffer[6];
+  returnValue += tempBuffer[7];
+  returnValue += tempBuffer[8];
+  returnValue += tempBuffer[9];
+  returnValue += tempBuffer[10];
+  returnValue += tempBuffer[11];
+  returnValue += tempBuffer[12];
+  returnValue += tempBuffer[13];
+  returnValue += tempBuffer[14];
+  returnValue += tempBuffer[15];
+
+  // Perform non SIMD leftover operations
+  number = sixteenth_points * 16;
+  for (; number < num_points; number++) {
+    returnValue += (*aPtr++) * (*bPtr++);
+  }
+  return returnValue;
+}
+
+/*!
+ *  \brief Correlates the Early, Prompt and Late codes against the in-phase and
+ * quadrature baseband signals in a single pass as si32 types
+ *  \details Equivalent to six avx512_mul_and_acc_si32() calls, but every input
+ * vector is streamed through the cache only once.
+ *  \param[out] i_e Early in-phase correlation
+ *  \param[out] i_p Prompt in-phase correlation
+ *  \param[out] i_l Late in-phase correlation
+ *  \param[out] q_e Early quadrature correlation
+ *  \param[out] q_p Prompt quadrature correlation
+ *  \param[out] q_l Late quadrature correlation
+ *  \param[in] ecode Early CA code
+ *  \param[in] pcode Prompt CA code
+ *  \param[in] lcode Late CA code
+ *  \param[in] sig_sin Baseband signal mixed with the sine carrier
+ *  \param[in] sig_cos Baseband signal mixed with the cosine carrier
+ *  \param[in] num_points Number of points in each vector
+ */
+static inline void
+avx512_correlate_epl_si32(double *i_e, double *i_p, double *i_l, double *q_e,
+                          double *q_p, double *q_l, const int32_t *ecode,
+                          const int32_t *pcode, const int32_t *lcode,
+                          const int32_t *sig_sin, const int32_t *sig_cos,
+                          uint32_t num_points) {
+
+  uint32_t number = 0;
+  const uint32_t sixteenth_points = num_points / 16;
+  int32_t tempBuffer[6][16];
+  int32_t returnValue[6] = {0, 0, 0, 0, 0, 0};
+  int32_t k;
+
+  __m512i eVal, pVal, lVal, sinVal, cosVal;
+  __m512i acc_ie = _mm512_setzero_si512();
+  __m512i acc_ip = _mm512_setzero_si512();
+  __m512i acc_il = _mm512_setzero_si512();
+  __m512i acc_qe = _mm512_setzero_si512();
+  __m512i acc_qp = _mm512_setzero_si512();
+  __m512i acc_ql = _mm512_setzero_si512();
+
+  for (; number < sixteenth_points; number++) {
+
+    // Load every input only once per iteration
+    eVal = _mm512_loadu_si512((__m512i *)ecode);
+    pVal = _mm512_loadu_si512((__m512i *)pcode);
+    lVal = _mm512_loadu_si512((__m512i *)lcode);
+    sinVal = _mm512_loadu_si512((__m512i *)sig_sin);
+    cosVal = _mm512_loadu_si512((__m512i *)sig_cos);
+
+    // In-phase arm
+    acc_ie = _mm512_add_epi32(acc_ie, _mm512_mullo_epi32(eVal, sinVal));
+    acc_ip = _mm512_add_epi32(acc_ip, _mm512_mullo_epi32(pVal, sinVal));
+    acc_il = _mm512_add_epi32(acc_il, _mm512_mullo_epi32(lVal, sinVal));
+
+    // Quadrature arm
+    acc_qe = _mm512_add_epi32(acc_qe, _mm512_mullo_epi32(eVal, cosVal));
+    acc_qp = _mm512_add_epi32(acc_qp, _mm512_mullo_epi32(pVal, cosVal));
+    acc_ql = _mm512_add_epi32(acc_ql, _mm512_mullo_epi32(lVal, cosVal));
+
+    // Increment pointers
+    ecode += 16;
+    pcode += 16;
+    lcode += 16;
+    sig_sin += 16;
+    sig_cos += 16;
+  }
+
+  _mm512_storeu_si512((__m512i *)tempBuffer[0], acc_ie);
+  _mm512_storeu_si512((__m512i *)tempBuffer[1], acc_ip);
+  _mm512_storeu_si512((__m512i *)tempBuffer[2], acc_il);
+  _mm512_storeu_si512((__m512i *)tempBuffer[3], acc_qe);
+  _mm512_storeu_si512((__m512i *)tempBuffer[4], acc_qp);
+  _mm512_storeu_si512((__m512i *)tempBuffer[5], acc_ql);
+
+  for (k = 0; k < 6; k++) {
+    returnValue[k] = tempBuffer[k][0];
+    returnValue[k] += tempBuffer[k][1];
+    returnValue[k] += tempBuffer[k][2];
+    returnValue[k] += tempBuffer[k][3];
+    returnValue[k] += tempBuffer[k][4];
+    returnValue[k] += tempBuffer[k][5];
+    returnValue[k] += tempBuffer[k][6];
+    returnValue[k] += tempBuffer[k][7];
+    returnValue[k] += tempBuffer[k][8];
+    returnValue[k] += tempBuffer[k][9];
+    returnValue[k] += tempBuffer[k][10];
+    returnValue[k] += tempBuffer[k][11];
+    returnValue[k] += tempBuffer[k][12];
+    returnValue[k] += tempBuffer[k][13];
+    returnValue[k] += tempBuffer[k][14];
+    returnValue[k] += tempBuffer[k][15];
+  }
+
+  // Perform non SIMD leftover operations
+  number = sixteenth_points * 16;
+  for (; number < num_points; number++) {
+    returnValue[0] += (*ecode) * (*sig_sin);
+    returnValue[1] += (*pcode) * (*sig_sin);
+    returnValue[2] += (*lcode) * (*sig_sin);
+    returnValue[3] += (*ecode++) * (*sig_cos);
+    returnValue[4] += (*pcode++) * (*sig_cos);
+    returnValue[5] += (*lcode++) * (*sig_cos);
+    sig_sin++;
+    sig_cos++;
+  }
+
+  *i_e = returnValue[0];
+  *i_p = returnValue[1];
+  *i_l = returnValue[2];
+  *q_e = returnValue[3];
+  *q_p = returnValue[4];
+  *q_l = returnValue[5];
+}
+
+/*!
+ *  \brief Multiply point to point two vectors together as a fl32 type
+ * \param[out] cvector Product of point to point multiplication
+ * \param[in] avector First vector to multiply
+ * \param[in] bvector Second vector to multiply
+ * \param[in] num_points Number of points in each
+ * vector
+ */
+static inline void avx512_fl32_x2_mul_si32(int32_t *cvector,
+                                           const int32_t *avector,
+                                           const int32_t *bvector,
+                                           uint32_t num_points) {
+
+  uint32_t number = 0;
+  const uint32_t sixteenth_points = num_points / 16;
+
+  int32_t *cPtr = cvector;
+  const int32_t *aPtr = avector;
+  const int32_t *bPtr = bvector;
+
+  __m512i aVal, bVal, cVal;
+
+  for (; number < sixteenth_points; number++) {
+
+    // Load 256-bits of integer data from memory into dst. mem_addr does not
+    // need to be aligned on any particular boundary.
+    aVal = _mm512_loadu_si512((__m512i *)aPtr);
+    bVal = _mm512_loadu_si512((__m512i *)bPtr);
+
+    // Multiply packed 16-bit integers in a and b, producing intermediate
+    // signed 32-bit integers. Truncate each intermediate integer to the 18
+    // most significant bits, round by adding 1, and store bits [16:1] to dst.
+    cVal = _mm512_mullo_epi32(aVal, bVal);
+
+    // Store 256-bits of integer data from a into memory. mem_addr does
+    // not need to be aligned on any particular boundary.
+    _mm512_storeu_si512((__m512i *)cPtr, cVal);
+
+    // Increment pointers
+    aPtr += 16;
+    bPtr += 16;
+    cPtr += 16;
+  }
+}
+
+/*!
+ *  \brief Generates a NCO based on the direct lookup table approach with SIMD
+ * intrinsic and generates the carrier as fl32 type.
+ *  \param[out] sig_nco Sinusoidal wave generated byt the NCO
+ *  \param[in] lut Lookup table to be use for the code
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] samp_freq Sampling frequency of the signal to be generated
+ */
+void avx512_nco_fl32(float *sig_nco, const float *lut, const int32_t blk_size,
+                     const double rem_carr_phase, const double carr_freq,
+                     const double samp_freq) {
+  int32_t inda;
+  const uint32_t sixteenth_points = blk_size / 16;
+  const uint32_t nom_carr_step =
+      (uint32_t)(carr_freq * (4294967296.0 / samp_freq) + 0.5);
+
+  // Declarations for serial implementation
+  uint32_t nom_carr_phase_base =
+      (uint32_t)(rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+  uint32_t nom_carr_idx = 0;
+
+  // Important variable declarations
+  __m512i carr_phase_base = _mm512_set1_epi32(nom_carr_phase_base);
+  __m512i carr_step_base = _mm512_set_epi32(
+      15 * nom_carr_step, 14 * nom_carr_step, 13 * nom_carr_step,
+      12 * nom_carr_step, 11 * nom_carr_step, 10 * nom_carr_step,
+      9 * nom_carr_step, 8 * nom_carr_step, 7 * nom_carr_step,
+      6 * nom_carr_step, 5 * nom_carr_step, 4 * nom_carr_step,
+      3 * nom_carr_step, 2 * nom_carr_step, 1 * nom_carr_step,
+      0 * nom_carr_step);
+  __m512i carr_idx = _mm512_set1_epi32(0);
+  __m512i hex_ff = _mm512_set1_epi32(GNSS_NCO_LUT_MASK);
+  __m512 nco;
+  __m512i carr_step_offset = _mm512_set1_epi32(16 * nom_carr_step);
+
+  // First iteration happens outside the loop
+  carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_base);
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    carr_idx = _mm512_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT);
+    carr_idx = _mm512_and_si512(carr_idx, hex_ff);
+
+    // Look in lut
     nco = _mm512_i32gather_ps(carr_idx, lut, 4);
 
-    // Delta step
-    // carr_step_base = _mm256_add_epi32(carr_step_base, carr_step_offset);
-    carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_offset);
+    // Delta step
+    // carr_step_base = _mm256_add_epi32(carr_step_base, carr_step_offset);
+    carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_offset);
+
+    // 5- Store values in output buffer
+    _mm512_storeu_ps((float *)sig_nco, nco);
+
+    // 6- Update pointers
+    sig_nco += 16;
+  }
+
+  inda = sixteenth_points * 16;
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base =
+      (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(carr_phase_base));
+
+  // generate buffer of output
+  for (; inda < blk_size; ++inda) {
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    nom_carr_idx =
+        (nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT) & GNSS_NCO_LUT_MASK;
+    // Look in lut
+    *sig_nco++ = lut[nom_carr_idx]; // get sample value from lut
+    // Delta step
+    nom_carr_phase_base += nom_carr_step;
+  }
+}
+
+/*!
+ *  \brief Generates a phase-continuous NCO based on the Paralelized Lookup
+ * Table (PLUT) approach
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table to be use for the code
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void avx512_nco_state_fl32(float *sig_nco, const float *lut,
+                           const int32_t blk_size, gnss_nco_t *nco) {
+  int32_t inda;
+  const uint32_t sixteenth_points = blk_size / 16;
+  const uint32_t nom_carr_step = nco->step;
+  uint32_t nom_carr_phase_base = nco->phase;
+
+  // Lane k starts k samples ahead of the accumulator
+  __m512i carr_phase_base = _mm512_add_epi32(
+      _mm512_set1_epi32(nom_carr_phase_base),
+      _mm512_mullo_epi32(_mm512_set1_epi32(nom_carr_step),
+                         _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6,
+                                          5, 4, 3, 2, 1, 0)));
+  __m512i carr_step_offset = _mm512_set1_epi32(16 * nom_carr_step);
+  __m512i carr_idx;
+  __m512 sig;
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    carr_idx = _mm512_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT);
+
+    // Look in lut
+    sig = _mm512_i32gather_ps(carr_idx, lut, 4);
+
+    // Delta step
+    carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_offset);
+
+    // Store values in output buffer
+    _mm512_storeu_ps(sig_nco, sig);
+    sig_nco += 16;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base =
+      (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(carr_phase_base));
+
+  for (inda = sixteenth_points * 16; inda < blk_size; ++inda) {
+    *sig_nco++ = lut[nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT];
+    nom_carr_phase_base += nom_carr_step;
+  }
+  nco->phase = nom_carr_phase_base;
+}
+
+/*!
+ *  \brief Generates the sine and cosine carriers of a quadrature NCO
+ *  \details Both carriers come from one phase ramp and one gather of the
+ * interleaved table built by gnss_nco_sincos_lut_fl32().
+ *  \param[out] sig_sin Sine wave generated by the NCO
+ *  \param[out] sig_cos Cosine wave generated by the NCO
+ *  \param[in] sincos_lut Interleaved sine and cosine lookup table
+ *  \param[in] blk_size Total number of elements in the output vectors
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void avx512_nco_iq_fl32(float *sig_sin, float *sig_cos,
+                        const float *sincos_lut, const int32_t blk_size,
+                        gnss_nco_t *nco) {
+  int32_t inda;
+  const uint32_t sixteenth_points = blk_size / 16;
+  const uint32_t nom_carr_step = nco->step;
+  uint32_t nom_carr_phase_base = nco->phase;
+
+  // Lane k starts k samples ahead of the accumulator
+  __m512i carr_phase_base = _mm512_add_epi32(
+      _mm512_set1_epi32(nom_carr_phase_base),
+      _mm512_mullo_epi32(_mm512_set1_epi32(nom_carr_step),
+                         _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6,
+                                          5, 4, 3, 2, 1, 0)));
+  __m512i carr_step_offset = _mm512_set1_epi32(16 * nom_carr_step);
+  __m512i carr_idx;
+  __m512i even = _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10,
+                                  8, 6, 4, 2, 0);
+  __m512i odd = _mm512_set_epi32(31, 29, 27, 25, 23, 21, 19, 17, 15, 13, 11,
+                                 9, 7, 5, 3, 1);
+  __m512 lo, hi, sin_val, cos_val;
+  uint32_t nom_carr_idx;
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    carr_idx = _mm512_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT);
+
+    // Each 64-bit lookup brings a sine and cosine pair, lo holds the pairs
+    // of samples 0 to 7 and hi those of samples 8 to 15
+    lo = _mm512_castsi512_ps(_mm512_i32gather_epi64(
+        _mm512_castsi512_si256(carr_idx), sincos_lut, 8));
+    hi = _mm512_castsi512_ps(_mm512_i32gather_epi64(
+        _mm512_extracti32x8_epi32(carr_idx, 1), sincos_lut, 8));
+
+    // Deinterleave the pairs
+    sin_val = _mm512_permutex2var_ps(lo, even, hi);
+    cos_val = _mm512_permutex2var_ps(lo, odd, hi);
+
+    // Delta step
+    carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_offset);
+
+    // Store values in output buffers
+    _mm512_storeu_ps(sig_sin, sin_val);
+    _mm512_storeu_ps(sig_cos, cos_val);
+    sig_sin += 16;
+    sig_cos += 16;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base =
+      (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(carr_phase_base));
+
+  for (inda = sixteenth_points * 16; inda < blk_size; ++inda) {
+    nom_carr_idx = nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT;
+    *sig_sin++ = sincos_lut[2 * nom_carr_idx];
+    *sig_cos++ = sincos_lut[2 * nom_carr_idx + 1];
+    nom_carr_phase_base += nom_carr_step;
+  }
+  nco->phase = nom_carr_phase_base;
+}
+
+/*!
+ *  \brief Generates a NCO from a small lookup table held in registers
+ *  \details Replaces the gather of the PLUT method with a single
+ * vpermi2d/vpermi2ps over two registers holding up to 32 table entries.
+ * Larger tables do not fit and fall back to the scalar lookup.
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table of 1 << lut_bits entries
+ *  \param[in] lut_bits Phase bits indexing the table, 1 to 5
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void avx512_nco_perm_fl32(float *sig_nco, const float *lut,
+                          const int32_t lut_bits, const int32_t blk_size,
+                          gnss_nco_t *nco) {
+  int32_t inda;
+  const uint32_t sixteenth_points = (lut_bits <= 5) ? blk_size / 16 : 0;
+  const int32_t shift = 32 - lut_bits;
+  const int32_t lut_size = 1 << lut_bits;
+  const uint32_t nom_carr_step = nco->step;
+  uint32_t nom_carr_phase_base = nco->phase;
+
+  // Lane k starts k samples ahead of the accumulator
+  __m512i carr_phase_base = _mm512_add_epi32(
+      _mm512_set1_epi32(nom_carr_phase_base),
+      _mm512_mullo_epi32(_mm512_set1_epi32(nom_carr_step),
+                         _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6,
+                                          5, 4, 3, 2, 1, 0)));
+  __m512i carr_step_offset = _mm512_set1_epi32(16 * nom_carr_step);
+  __m512i carr_idx;
+  __m512 sig;
+
+  // Keep the whole table in registers, masking off the missing entries
+  const __m512 lut_lo = _mm512_maskz_loadu_ps(
+      (__mmask16)((lut_size < 16) ? (1 << lut_size) - 1 : 0xFFFF), lut);
+  const __m512 lut_hi = _mm512_maskz_loadu_ps(
+      (__mmask16)((lut_size > 16) ? 0xFFFF : 0), lut + 16);
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // Obtain integer index in lut_bits:(32 - lut_bits) number
+    carr_idx = _mm512_srli_epi32(carr_phase_base, shift);
+
+    // Look in the table registers
+    sig = _mm512_permutex2var_ps(lut_lo, carr_idx, lut_hi);
+
+    // Delta step
+    carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_offset);
+
+    // Store values in output buffer
+    _mm512_storeu_ps(sig_nco, sig);
+    sig_nco += 16;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base =
+      (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(carr_phase_base));
+
+  for (inda = sixteenth_points * 16; inda < blk_size; ++inda) {
+    *sig_nco++ = lut[nom_carr_phase_base >> shift];
+    nom_carr_phase_base += nom_carr_step;
+  }
+  nco->phase = nom_carr_phase_base;
+}
+
+#pragma GCC push_options
+#pragma GCC target("fma")
+/*!
+ *  \brief Generates the sine and cosine carriers of a polynomial NCO
+ *  \details Computes both carriers with the range reduction and minimax
+ * polynomials of gnss_nco_sincos_poly(), evaluated with FMA, so no gathers or
+ * tables are involved. The quadrant fix-up runs on mask registers.
+ *  \param[out] sig_sin Sine wave generated by the NCO
+ *  \param[out] sig_cos Cosine wave generated by the NCO
+ *  \param[in] amplitude Peak amplitude of the carriers
+ *  \param[in] blk_size Total number of elements in the output vectors
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void avx512_nco_poly_fl32(float *sig_sin, float *sig_cos,
+                          const float amplitude, const int32_t blk_size,
+                          gnss_nco_t *nco) {
+  int32_t inda;
+  const uint32_t sixteenth_points = blk_size / 16;
+  const uint32_t nom_carr_step = nco->step;
+  uint32_t nom_carr_phase_base = nco->phase;
+
+  // Lane k starts k samples ahead of the accumulator
+  __m512i carr_phase_base = _mm512_add_epi32(
+      _mm512_set1_epi32(nom_carr_phase_base),
+      _mm512_mullo_epi32(_mm512_set1_epi32(nom_carr_step),
+                         _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6,
+                                          5, 4, 3, 2, 1, 0)));
+  __m512i carr_step_offset = _mm512_set1_epi32(16 * nom_carr_step);
+  __m512i half_quadrant = _mm512_set1_epi32(0x20000000);
+  __m512i one_epi32 = _mm512_set1_epi32(1);
+  __m512i two_epi32 = _mm512_set1_epi32(2);
+  __m512 rad_per_lsb = _mm512_set1_ps(GNSS_NCO_POLY_RAD_PER_LSB);
+  __m512 s1 = _mm512_set1_ps(GNSS_NCO_POLY_S1);
+  __m512 s2 = _mm512_set1_ps(GNSS_NCO_POLY_S2);
+  __m512 s3 = _mm512_set1_ps(GNSS_NCO_POLY_S3);
+  __m512 c0 = _mm512_set1_ps(GNSS_NCO_POLY_C0);
+  __m512 c1 = _mm512_set1_ps(GNSS_NCO_POLY_C1);
+  __m512 c2 = _mm512_set1_ps(GNSS_NCO_POLY_C2);
+  __m512 minus_half = _mm512_set1_ps(-0.5f);
+  __m512 one = _mm512_set1_ps(1.0f);
+  __m512 amp = _mm512_set1_ps(amplitude);
+  __m512 minus_amp = _mm512_set1_ps(-amplitude);
+  __m512i quadrant;
+  __m512 x, z, s, c, sin_val, cos_val, sin_amp, cos_amp;
+  __mmask16 swap;
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // Round the phase to the nearest quadrant, keep the remainder in radians
+    quadrant = _mm512_srli_epi32(
+        _mm512_add_epi32(carr_phase_base, half_quadrant), 30);
+    x = _mm512_mul_ps(
+        _mm512_cvtepi32_ps(_mm512_sub_epi32(carr_phase_base,
+                                            _mm512_slli_epi32(quadrant, 30))),
+        rad_per_lsb);
+    z = _mm512_mul_ps(x, x);
+
+    // sin(x) = x + x^3 * (s1 + z * (s2 + z * s3))
+    s = _mm512_fmadd_ps(_mm512_fmadd_ps(s3, z, s2), z, s1);
+    s = _mm512_fmadd_ps(_mm512_mul_ps(s, z), x, x);
+
+    // cos(x) = 1 - z / 2 + z^2 * (c0 + z * (c1 + z * c2))
+    c = _mm512_fmadd_ps(_mm512_fmadd_ps(c2, z, c1), z, c0);
+    c = _mm512_fmadd_ps(c, z, minus_half);
+    c = _mm512_fmadd_ps(c, z, one);
+
+    // Odd quadrants swap the outputs, quadrants 2 and 3 negate the sine and
+    // quadrants 1 and 2 the cosine
+    swap = _mm512_test_epi32_mask(quadrant, one_epi32);
+    sin_val = _mm512_mask_blend_ps(swap, s, c);
+    cos_val = _mm512_mask_blend_ps(swap, c, s);
+    sin_amp = _mm512_mask_blend_ps(_mm512_test_epi32_mask(quadrant, two_epi32),
+                                   amp, minus_amp);
+    cos_amp = _mm512_mask_blend_ps(
+        _mm512_test_epi32_mask(_mm512_add_epi32(quadrant, one_epi32),
+                               two_epi32),
+        amp, minus_amp);
+
+    // Delta step
+    carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_offset);
+
+    // Store values in output buffers
+    _mm512_storeu_ps(sig_sin, _mm512_mul_ps(sin_val, sin_amp));
+    _mm512_storeu_ps(sig_cos, _mm512_mul_ps(cos_val, cos_amp));
+    sig_sin += 16;
+    sig_cos += 16;
+  }
+
+  // Lane 0 holds the phase of the first sample not generated yet
+  nom_carr_phase_base =
+      (uint32_t)_mm_cvtsi128_si32(_mm512_castsi512_si128(carr_phase_base));
+
+  for (inda = sixteenth_points * 16; inda < blk_size; ++inda) {
+    gnss_nco_sincos_poly(nom_carr_phase_base, amplitude, sig_sin++, sig_cos++);
+    nom_carr_phase_base += nom_carr_step;
+  }
+  nco->phase = nom_carr_phase_base;
+}
+
+/*!
+ *  \brief Generates a NCO with a complex phase rotator
+ *  \details Four vectors hold the phasors exp(j * (rem_carr_phase + k * dphi))
+ * of 64 consecutive samples. Each step stores them and multiplies them by
+ * exp(j * 64 * dphi) with FMA, the four independent chains hiding the
+ * latency of the complex multiply, and every GNSS_NCO_ROT_RENORM samples they
+ * are pulled back to unit magnitude. The carrier then costs no gathers or
+ * tables. Takes the signature of avx512_nco_fl32(), the table only giving the
+ * amplitude through its quarter cycle entry.
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Sine lookup table of GNSS_NCO_LUT_SIZE entries
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] samp_freq Sampling frequency of the signal to be generated
+ */
+void avx512_nco_rot_fl32(float *sig_nco, const float *lut,
+                         const int32_t blk_size, const double rem_carr_phase,
+                         const double carr_freq, const double samp_freq) {
+  int32_t inda;
+  const uint32_t span_points = blk_size / 64;
+  const double carr_step = 2.0 * M_PI * carr_freq / samp_freq;
+  const float amplitude = lut[GNSS_NCO_LUT_SIZE / 4];
+  const double step_re = cos(carr_step), step_im = sin(carr_step);
+  const float nom_rot_re = (float)step_re;
+  const float nom_rot_im = (float)step_im;
+  double seed_re = cos(rem_carr_phase), seed_im = sin(rem_carr_phase), seed;
+  float lane_re[16], lane_im[16];
+  float nom_phasor_re, nom_phasor_im, tmp;
+
+  __m512 phasor_re[4], phasor_im[4], tmp_re, gain;
+  __m512 lane_rot_re = _mm512_set1_ps((float)cos(16 * carr_step));
+  __m512 lane_rot_im = _mm512_set1_ps((float)sin(16 * carr_step));
+  __m512 rot_re = _mm512_set1_ps((float)cos(64 * carr_step));
+  __m512 rot_im = _mm512_set1_ps((float)sin(64 * carr_step));
+  __m512 amp = _mm512_set1_ps(amplitude);
+  __m512 half = _mm512_set1_ps(0.5f);
+  __m512 three_halves = _mm512_set1_ps(1.5f);
+
+  // Lane k of vector v starts 16 * v + k samples ahead of the remainder,
+  // the first vector rotated in double precision from one lane to the next
+  for (int k = 0; k < 16; k++) {
+    lane_re[k] = (float)seed_re;
+    lane_im[k] = (float)seed_im;
+    seed = seed_re * step_re - seed_im * step_im;
+    seed_im = seed_re * step_im + seed_im * step_re;
+    seed_re = seed;
+  }
+  phasor_re[0] = _mm512_loadu_ps(lane_re);
+  phasor_im[0] = _mm512_loadu_ps(lane_im);
+  for (int v = 1; v < 4; v++) {
+    tmp_re = _mm512_mul_ps(phasor_im[v - 1], lane_rot_im);
+    phasor_re[v] = _mm512_fmsub_ps(phasor_re[v - 1], lane_rot_re, tmp_re);
+    phasor_im[v] = _mm512_mul_ps(phasor_im[v - 1], lane_rot_re);
+    phasor_im[v] =
+        _mm512_fmadd_ps(phasor_re[v - 1], lane_rot_im, phasor_im[v]);
+  }
+
+  for (inda = 0; inda < span_points; inda++) {
+    for (int v = 0; v < 4; v++) {
+      // Store values in output buffer
+      _mm512_storeu_ps(sig_nco + 16 * v, _mm512_mul_ps(phasor_im[v], amp));
+
+      // Rotate every lane by 64 samples
+      tmp_re = _mm512_mul_ps(phasor_im[v], rot_im);
+      tmp_re = _mm512_fmsub_ps(phasor_re[v], rot_re, tmp_re);
+      phasor_im[v] = _mm512_mul_ps(phasor_im[v], rot_re);
+      phasor_im[v] = _mm512_fmadd_ps(phasor_re[v], rot_im, phasor_im[v]);
+      phasor_re[v] = tmp_re;
+    }
+    sig_nco += 64;
+
+    // One Newton step of 1 / sqrt(|phasor|^2) keeps the magnitude at one
+    if ((inda + 1) % (GNSS_NCO_ROT_RENORM / 64) == 0) {
+      for (int v = 0; v < 4; v++) {
+        gain = _mm512_mul_ps(phasor_im[v], phasor_im[v]);
+        gain = _mm512_fmadd_ps(phasor_re[v], phasor_re[v], gain);
+        gain = _mm512_fnmadd_ps(half, gain, three_halves);
+        phasor_re[v] = _mm512_mul_ps(phasor_re[v], gain);
+        phasor_im[v] = _mm512_mul_ps(phasor_im[v], gain);
+      }
+    }
+  }
+
+  // Lane 0 of the first vector holds the phasor of the next sample
+  nom_phasor_re = _mm512_cvtss_f32(phasor_re[0]);
+  nom_phasor_im = _mm512_cvtss_f32(phasor_im[0]);
+
+  for (inda = span_points * 64; inda < blk_size; ++inda) {
+    *sig_nco++ = amplitude * nom_phasor_im;
+    tmp = nom_phasor_re * nom_rot_re - nom_phasor_im * nom_rot_im;
+    nom_phasor_im = nom_phasor_re * nom_rot_im + nom_phasor_im * nom_rot_re;
+    nom_phasor_re = tmp;
+  }
+}
+#pragma GCC pop_options
+
+/*!
+ *  \brief Generates a nominal NCO based on the direct lookup table approach as
+ * fl32 type
+ *  \param[out] sig_nco Sinusoidal wave generated byt the NCO
+ *  \param[in] lut Lookup table to be use for the code
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] samp_freq Sampling frequency of the signal to be generated
+ */
+void avx512_nom_nco_fl32(float *sig_nco, const float *lut,
+                         const int32_t blk_size, const double rem_carr_phase,
+                         const double carr_freq, const double samp_freq) {
+
+  uint32_t carrPhaseBase =
+      (rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+  uint32_t carrStep = (carr_freq * (4294967296.0 / samp_freq) + 0.5);
+  uint32_t carrIndex = 0;
+  int32_t inda;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    carrIndex = (carrPhaseBase >> GNSS_NCO_LUT_SHIFT) & GNSS_NCO_LUT_MASK;
+
+    // Look in lut
+    sig_nco[inda] = lut[carrIndex];
+
+    // Delta step
+    carrPhaseBase += carrStep;
+  }
+}
+
+/*!
+ *  \brief Generates an Early, Late and Propmt CA code based on the direct
+ * lookup table approach
+ * \param[out] ecode Early CA code
+ * \param[out] pcode Prompt CA code
+ * \param[out] lcode Late CA code
+ * \param[in] cacode Nominal satellite ranging code
+ * \param[in] blk_size Total number of elements in the sig_nco vector
+ * \param[in] rem_code_phase Carrier phase remainder of the sinusoidal wave
+ * \param[in] code_freq Carrier frequency of the sinusoidal wave
+ * \param[in] samp_freq Sampling frequency of the signal to be generated
+ */
+void avx512_nom_code_fl32(float *ecode, float *pcode, float *lcode,
+                          const float *cacode, const int32_t blk_size,
+                          const double rem_code_phase, const double code_freq,
+                          const double samp_freq) {
+
+  int32_t inda;
+  double earlyLateSpc = 0.5;
+  double codePhaseStep = code_freq / samp_freq;
+  double baseCode;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    baseCode = (inda * codePhaseStep + rem_code_phase);
+    pCodeIdx = (float)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
+    eCodeIdx = (float)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
+                   ? (baseCode - earlyLateSpc + 1)
+                   : (baseCode - earlyLateSpc);
+    lCodeIdx = (float)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
+                   ? (baseCode + earlyLateSpc + 1)
+                   : (baseCode + earlyLateSpc);
+
+    ecode[inda] = *(cacode + eCodeIdx);
+    pcode[inda] = *(cacode + pCodeIdx);
+    lcode[inda] = *(cacode + lCodeIdx);
+  }
+}
+
+/*!
+ *  \brief Generates an Early, Late and Propmt CA code based on the direct
+ * lookup table approach with SIMD instructions
+ *  \param[out] ecode Early CA code
+ *  \param[out] pcode Prompt CA code
+ *  \param[out] lcode Late CA code
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in] rem_code_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] code_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] samp_freq Sampling frequency of the signal to be generated
+ */
+void avx512_code_fl32(float *ecode, float *pcode, float *lcode,
+                      const float *cacode, const int32_t blk_size,
+                      const float rem_code_phase, const float code_freq,
+                      const float samp_freq) {
+
+  int32_t inda;
+  const uint32_t sixteenth_points = blk_size / 16;
+  const __mmask16 tail = (1u << (blk_size - sixteenth_points * 16)) - 1;
+  float earlyLateSpc = 0.5;
+  float codePhaseStep = code_freq / samp_freq;
+
+  // Important variable declarations
+  __m512i sample_idx =
+      _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+  __m512i sample_offset = _mm512_set1_epi32(16);
+  __m512 code_step = _mm512_set1_ps(codePhaseStep);
+  __m512 code_phase_base = _mm512_set1_ps(rem_code_phase);
+  __m512 code_spacing = _mm512_set1_ps(earlyLateSpc);
+  __m512i code_idx[3];
+  __m512 elut, plut, llut;
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // Chips of the replicas for the next 16 samples
+    avx512_code_idx(code_idx, sample_idx, code_step, code_phase_base,
+                    code_spacing);
+    sample_idx = _mm512_add_epi32(sample_idx, sample_offset);
+
+    // Look in lut
+    elut = _mm512_i32gather_ps(code_idx[0], cacode, 4);
+    plut = _mm512_i32gather_ps(code_idx[1], cacode, 4);
+    llut = _mm512_i32gather_ps(code_idx[2], cacode, 4);
+
+    // 5- Store values in output buffer
+    _mm512_storeu_ps(ecode, elut);
+    _mm512_storeu_ps(pcode, plut);
+    _mm512_storeu_ps(lcode, llut);
+
+    // 6- Update pointers
+    ecode += 16;
+    pcode += 16;
+    lcode += 16;
+  }
+
+  // Remaining samples through one masked step of the same float path
+  if (tail) {
+    avx512_code_idx(code_idx, sample_idx, code_step, code_phase_base,
+                    code_spacing);
+    elut = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail,
+                                    code_idx[0], cacode, 4);
+    plut = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail,
+                                    code_idx[1], cacode, 4);
+    llut = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail,
+                                    code_idx[2], cacode, 4);
+    _mm512_mask_storeu_ps(ecode, tail, elut);
+    _mm512_mask_storeu_ps(pcode, tail, plut);
+    _mm512_mask_storeu_ps(lcode, tail, llut);
+  }
+}
+
+/*!
+ *  \brief Wipes off the carrier, generates the Early, Prompt and Late codes and
+ * correlates them against the raw signal in a single pass as fl32 types
+ *  \details Fuses avx512_nco_fl32(), avx512_code_fl32(), the carrier mixing and
+ * avx512_correlate_epl_fl32(). Carrier and code replicas only live in
+ * registers, so no intermediate blk_size buffers are written or read back.
+ *  \param[out] i_e Early in-phase correlation
+ *  \param[out] i_p Prompt in-phase correlation
+ *  \param[out] i_l Late in-phase correlation
+ *  \param[out] q_e Early quadrature correlation
+ *  \param[out] q_p Prompt quadrature correlation
+ *  \param[out] q_l Late quadrature correlation
+ *  \param[in] signal Raw real signal samples
+ *  \param[in] sin_lut Sine lookup table of 256 entries
+ *  \param[in] cos_lut Cosine lookup table of 256 entries
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of samples to correlate
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void avx512_fused_epl_fl32(double *i_e, double *i_p, double *i_l, double *q_e,
+                           double *q_p, double *q_l, const int8_t *signal,
+                           const float *sin_lut, const float *cos_lut,
+                           const float *cacode, const int32_t blk_size,
+                           const double rem_carr_phase, const double carr_freq,
+                           const double rem_code_phase, const double code_freq,
+                           const double samp_freq) {
+
+  int32_t inda, k;
+  const uint32_t sixteenth_points = blk_size / 16;
+  float tempBuffer[6][16];
+  float returnValue[6] = {0, 0, 0, 0, 0, 0};
+  float sinMix, cosMix;
+
+  // Carrier NCO declarations
+  const uint32_t nom_carr_step =
+      (uint32_t)(carr_freq * (4294967296.0 / samp_freq) + 0.5);
+  uint32_t nom_carr_phase_base =
+      (uint32_t)(rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+  uint32_t nom_carr_idx = 0;
+
+  __m512i carr_phase_base = _mm512_set1_epi32(nom_carr_phase_base);
+  __m512i carr_step_base =
+      _mm512_set_epi32(
+      15 * nom_carr_step, 14 * nom_carr_step, 13 * nom_carr_step,
+      12 * nom_carr_step, 11 * nom_carr_step, 10 * nom_carr_step,
+      9 * nom_carr_step, 8 * nom_carr_step, 7 * nom_carr_step,
+      6 * nom_carr_step, 5 * nom_carr_step, 4 * nom_carr_step,
+      3 * nom_carr_step, 2 * nom_carr_step, 1 * nom_carr_step,
+      0 * nom_carr_step);
+  __m512i carr_step_offset = _mm512_set1_epi32(16 * nom_carr_step);
+  __m512i carr_idx;
+
+  // Code NCO declarations, kept in fl32 to match avx512_code_fl32()
+  const float earlyLateSpc = 0.5;
+  const float remCodePhase = (float)rem_code_phase;
+  const float codePhaseStep = (float)code_freq / (float)samp_freq;
+  float baseCode;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  __m512 ecode_phase_base = _mm512_set1_ps(remCodePhase - earlyLateSpc + 0.5);
+  __m512 pcode_phase_base = _mm512_set1_ps(remCodePhase + 0.5);
+  __m512 lcode_phase_base = _mm512_set1_ps(remCodePhase + earlyLateSpc + 0.5);
+  __m512 code_step_base =
+      _mm512_set_ps(15 * codePhaseStep, 14 * codePhaseStep, 13 * codePhaseStep,
+                    12 * codePhaseStep, 11 * codePhaseStep, 10 * codePhaseStep,
+                    9 * codePhaseStep, 8 * codePhaseStep, 7 * codePhaseStep,
+                    6 * codePhaseStep, 5 * codePhaseStep, 4 * codePhaseStep,
+                    3 * codePhaseStep, 2 * codePhaseStep, 1 * codePhaseStep,
+                    0 * codePhaseStep);
+  __m512 code_step_offset = _mm512_set1_ps(16 * codePhaseStep);
+  __m512i ecode_idx, pcode_idx, lcode_idx;
+
+  __m512 sig, sinVal, cosVal, eVal, pVal, lVal;
+  __m512 acc_ie = _mm512_setzero_ps();
+  __m512 acc_ip = _mm512_setzero_ps();
+  __m512 acc_il = _mm512_setzero_ps();
+  __m512 acc_qe = _mm512_setzero_ps();
+  __m512 acc_qp = _mm512_setzero_ps();
+  __m512 acc_ql = _mm512_setzero_ps();
+
+  // First iteration happens outside the loop
+  carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_base);
+  ecode_phase_base = _mm512_add_ps(ecode_phase_base, code_step_base);
+  pcode_phase_base = _mm512_add_ps(pcode_phase_base, code_step_base);
+  lcode_phase_base = _mm512_add_ps(lcode_phase_base, code_step_base);
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+    // 1- Convert sixteen int8 samples into fl32 lanes
+    sig = _mm512_cvtepi32_ps(
+        _mm512_cvtepi8_epi32(_mm_loadu_si128((__m128i *)signal)));
+
+    // 2- Carrier generation and wipeoff
+    carr_idx = _mm512_srli_epi32(carr_phase_base, GNSS_NCO_LUT_SHIFT);
+    sinVal = _mm512_i32gather_ps(carr_idx, sin_lut, 4);
+    cosVal = _mm512_i32gather_ps(carr_idx, cos_lut, 4);
+    sinVal = _mm512_mul_ps(sinVal, sig);
+    cosVal = _mm512_mul_ps(cosVal, sig);
+
+    // 3- Early, Prompt and Late code generation
+    ecode_idx = _mm512_cvtps_epi32(ecode_phase_base);
+    pcode_idx = _mm512_cvtps_epi32(pcode_phase_base);
+    lcode_idx = _mm512_cvtps_epi32(lcode_phase_base);
+    eVal = _mm512_i32gather_ps(ecode_idx, cacode, 4);
+    pVal = _mm512_i32gather_ps(pcode_idx, cacode, 4);
+    lVal = _mm512_i32gather_ps(lcode_idx, cacode, 4);
+
+    // 4- Correlation
+    acc_ie = _mm512_add_ps(acc_ie, _mm512_mul_ps(eVal, sinVal));
+    acc_ip = _mm512_add_ps(acc_ip, _mm512_mul_ps(pVal, sinVal));
+    acc_il = _mm512_add_ps(acc_il, _mm512_mul_ps(lVal, sinVal));
+    acc_qe = _mm512_add_ps(acc_qe, _mm512_mul_ps(eVal, cosVal));
+    acc_qp = _mm512_add_ps(acc_qp, _mm512_mul_ps(pVal, cosVal));
+    acc_ql = _mm512_add_ps(acc_ql, _mm512_mul_ps(lVal, cosVal));
+
+    // 5- Delta step
+    carr_phase_base = _mm512_add_epi32(carr_phase_base, carr_step_offset);
+    ecode_phase_base = _mm512_add_ps(ecode_phase_base, code_step_offset);
+    pcode_phase_base = _mm512_add_ps(pcode_phase_base, code_step_offset);
+    lcode_phase_base = _mm512_add_ps(lcode_phase_base, code_step_offset);
+
+    // 6- Update pointers
+    signal += 16;
+  }
+
+  _mm512_storeu_ps(tempBuffer[0], acc_ie);
+  _mm512_storeu_ps(tempBuffer[1], acc_ip);
+  _mm512_storeu_ps(tempBuffer[2], acc_il);
+  _mm512_storeu_ps(tempBuffer[3], acc_qe);
+  _mm512_storeu_ps(tempBuffer[4], acc_qp);
+  _mm512_storeu_ps(tempBuffer[5], acc_ql);
+
+  for (k = 0; k < 6; k++) {
+    returnValue[k] = tempBuffer[k][0];
+    returnValue[k] += tempBuffer[k][1];
+    returnValue[k] += tempBuffer[k][2];
+    returnValue[k] += tempBuffer[k][3];
+    returnValue[k] += tempBuffer[k][4];
+    returnValue[k] += tempBuffer[k][5];
+    returnValue[k] += tempBuffer[k][6];
+    returnValue[k] += tempBuffer[k][7];
+    returnValue[k] += tempBuffer[k][8];
+    returnValue[k] += tempBuffer[k][9];
+    returnValue[k] += tempBuffer[k][10];
+    returnValue[k] += tempBuffer[k][11];
+    returnValue[k] += tempBuffer[k][12];
+    returnValue[k] += tempBuffer[k][13];
+    returnValue[k] += tempBuffer[k][14];
+    returnValue[k] += tempBuffer[k][15];
+  }
+
+  inda = sixteenth_points * 16;
+  nom_carr_phase_base += inda * nom_carr_step;
+
+  // Perform non SIMD leftover operations
+  for (; inda < blk_size; ++inda) {
+    nom_carr_idx =
+        (nom_carr_phase_base >> GNSS_NCO_LUT_SHIFT) & GNSS_NCO_LUT_MASK;
+    sinMix = sin_lut[nom_carr_idx] * (*signal);
+    cosMix = cos_lut[nom_carr_idx] * (*signal++);
+    nom_carr_phase_base += nom_carr_step;
+
+    baseCode = (inda * codePhaseStep + remCodePhase);
+    pCodeIdx = (int32_t)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
+    eCodeIdx = (int32_t)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
+                   ? (baseCode - earlyLateSpc + 1)
+                   : (baseCode - earlyLateSpc);
+    lCodeIdx = (int32_t)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
+                   ? (baseCode + earlyLateSpc + 1)
+                   : (baseCode + earlyLateSpc);
+
+    returnValue[0] += cacode[eCodeIdx] * sinMix;
+    returnValue[1] += cacode[pCodeIdx] * sinMix;
+    returnValue[2] += cacode[lCodeIdx] * sinMix;
+    returnValue[3] += cacode[eCodeIdx] * cosMix;
+    returnValue[4] += cacode[pCodeIdx] * cosMix;
+    returnValue[5] += cacode[lCodeIdx] * cosMix;
+  }
+
+  *i_e = returnValue[0];
+  *i_p = returnValue[1];
+  *i_l = returnValue[2];
+  *q_e = returnValue[3];
+  *q_p = returnValue[4];
+  *q_l = returnValue[5];
+}
+
+/*!
+ *  \brief Correlates the in-phase and quadrature baseband signals against an
+ * arbitrary number of code replicas in a single pass as fl32 types
+ *  \details Generalizes avx512_code_fl32() and avx512_correlate_epl_fl32() to
+ * num_taps replicas, each one delayed by tap_offsets[t] chips from the prompt
+ * replica. Every sample of sig_sin and sig_cos is loaded once and correlated
+ * against all the taps before moving on, so no code buffers are written and
+ * the memory traffic does not grow with the number of taps up to
+ * GNSS_MAX_TAPS.
+ *  \pre cacode[ceil(rem_code_phase + tap_offsets[t] + k * code_freq /
+ * samp_freq)] must be readable for every tap t and sample k. The 1025 entries
+ * caCode.bin layout only pads one chip on each side, which covers offsets
+ * within +/-0.5 chips. Wider tap spacings need a code padded with at least
+ * ceil(max|tap_offsets|) chips on each side, and cacode pointing to the entry
+ * that holds the last chip of the code, so that negative indices stay inside
+ * the buffer.
+ *  \param[out] i_taps In-phase correlation of each tap
+ *  \param[out] q_taps Quadrature correlation of each tap
+ *  \param[in] sig_sin Baseband signal mixed with the sine carrier
+ *  \param[in] sig_cos Baseband signal mixed with the cosine carrier
+ *  \param[in] cacode Padded satellite ranging code
+ *  \param[in] tap_offsets Offset of each tap from the prompt replica in chips
+ *  \param[in] num_taps Number of taps, nothing is correlated below 1. Up to
+ * GNSS_MAX_TAPS taps are correlated per pass over the signal
+ *  \param[in] blk_size Total number of samples to correlate
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void avx512_correlate_ntap_fl32(double *i_taps, double *q_taps,
+                                const float *sig_sin, const float *sig_cos,
+                                const float *cacode, const float *tap_offsets,
+                                const int32_t num_taps, const int32_t blk_size,
+                                const float rem_code_phase,
+                                const float code_freq, const float samp_freq) {
+
+  int32_t inda, t, k;
+  const int32_t taps = (num_taps < GNSS_MAX_TAPS) ? num_taps : GNSS_MAX_TAPS;
+  const uint32_t sixteenth_points = blk_size / 16;
+  float codePhaseStep = code_freq / samp_freq;
+  float baseCode;
+  int32_t codeIdx;
+  float tempBuffer[16];
+  float returnValue[2];
+
+  if (num_taps < 1) {
+    return;
+  }
+
+  // Taps beyond the accumulators are correlated in further passes
+  if (num_taps > GNSS_MAX_TAPS) {
+    avx512_correlate_ntap_fl32(
+        i_taps + GNSS_MAX_TAPS, q_taps + GNSS_MAX_TAPS, sig_sin, sig_cos,
+        cacode, tap_offsets + GNSS_MAX_TAPS, num_taps - GNSS_MAX_TAPS,
+        blk_size, rem_code_phase, code_freq, samp_freq);
+  }
+
+  // Accumulators of every tap are kept in L1 between iterations
+  __m512 acc_i[GNSS_MAX_TAPS], acc_q[GNSS_MAX_TAPS];
+
+  // Important variable declarations
+  __m512 code_phase_base = _mm512_set1_ps(rem_code_phase + 0.5);
+  __m512 code_step_base =
+      _mm512_set_ps(15 * codePhaseStep, 14 * codePhaseStep, 13 * codePhaseStep,
+                    12 * codePhaseStep, 11 * codePhaseStep, 10 * codePhaseStep,
+                    9 * codePhaseStep, 8 * codePhaseStep, 7 * codePhaseStep,
+                    6 * codePhaseStep, 5 * codePhaseStep, 4 * codePhaseStep,
+                    3 * codePhaseStep, 2 * codePhaseStep, 1 * codePhaseStep,
+                    0 * codePhaseStep);
+  __m512 code_step_offset = _mm512_set1_ps(16 * codePhaseStep);
+  __m512i code_idx;
+  __m512 codeVal, sinVal, cosVal;
+
+  for (t = 0; t < taps; t++) {
+    acc_i[t] = _mm512_setzero_ps();
+    acc_q[t] = _mm512_setzero_ps();
+  }
+
+  // First iteration happens outside the loop
+  code_phase_base = _mm512_add_ps(code_phase_base, code_step_base);
+
+  for (inda = 0; inda < sixteenth_points; inda++) {
+
+    // Load the baseband samples only once for all the taps
+    sinVal = _mm512_loadu_ps(sig_sin);
+    cosVal = _mm512_loadu_ps(sig_cos);
+
+    for (t = 0; t < taps; t++) {
+      // Obtain the code index of the tap and look in the code table
+      code_idx = _mm512_cvtps_epi32(
+          _mm512_add_ps(code_phase_base, _mm512_set1_ps(tap_offsets[t])));
+      codeVal = _mm512_i32gather_ps(code_idx, cacode, 4);
+
+      // Multiply and accumulate both arms
+      acc_i[t] = _mm512_add_ps(acc_i[t], _mm512_mul_ps(codeVal, sinVal));
+      acc_q[t] = _mm512_add_ps(acc_q[t], _mm512_mul_ps(codeVal, cosVal));
+    }
+
+    // Delta step
+    code_phase_base = _mm512_add_ps(code_phase_base, code_step_offset);
+
+    // Increment pointers
+    sig_sin += 16;
+    sig_cos += 16;
+  }
+
+  for (t = 0; t < taps; t++) {
+    _mm512_storeu_ps(tempBuffer, acc_i[t]);
+    returnValue[0] = tempBuffer[0];
+    for (k = 1; k < 16; k++) {
+      returnValue[0] += tempBuffer[k];
+    }
+    _mm512_storeu_ps(tempBuffer, acc_q[t]);
+    returnValue[1] = tempBuffer[0];
+    for (k = 1; k < 16; k++) {
+      returnValue[1] += tempBuffer[k];
+    }
+
+    // Perform non SIMD leftover operations
+    for (inda = sixteenth_points * 16; inda < blk_size; inda++) {
+      baseCode = inda * codePhaseStep + rem_code_phase + tap_offsets[t];
+      codeIdx = (int32_t)baseCode < baseCode ? (int32_t)baseCode + 1
+                                             : (int32_t)baseCode;
+      returnValue[0] += cacode[codeIdx] * sig_sin[inda - sixteenth_points * 16];
+      returnValue[1] += cacode[codeIdx] * sig_cos[inda - sixteenth_points * 16];
+    }
+
+    i_taps[t] = returnValue[0];
+    q_taps[t] = returnValue[1];
+  }
+}
+
+/*!
+ *  \brief Unpacks 2-bit sign/magnitude samples into one int8_t per sample
+ *  \details Each byte holds four samples, the first one in the two least
+ * significant bits. Within a sample the high bit is the sign and the low bit
+ * the magnitude, mapped to the usual front-end levels -3, -1, +1 and +3. The
+ * levels are looked up with a byte shuffle and interleaved back into sample
+ * order, producing 256 samples per 64 packed bytes.
+ *  \param[out] samples Unpacked samples, 4 * num_bytes elements
+ *  \param[in] packed Packed samples
+ *  \param[in] num_bytes Number of packed bytes
+ */
+void avx512_unpack_2bit_si8(int8_t *samples, const uint8_t *packed,
+                            const int32_t num_bytes) {
+
+  int32_t inda;
+  const uint32_t sixtyfourth_points = num_bytes / 64;
+  const int8_t levels[4] = {1, 3, -1, -3};
+
+  // Important variable declarations
+  const __m512i lut = _mm512_broadcast_i32x4(
+      _mm_setr_epi8(1, 3, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0));
+  const __m512i mask = _mm512_set1_epi8(0x03);
+  __m512i packedVal, s0, s1, s2, s3;
+  __m512i pairLo, pairHi, quadLo, quadHi;
+  __m512i q0, q1, q2, q3, t0, t1, t2, t3;
+
+  for (inda = 0; inda < sixtyfourth_points; inda++) {
+
+    packedVal = _mm512_loadu_si512((__m512i *)packed);
+
+    // Look up the level of each of the four samples of every byte
+    s0 = _mm512_shuffle_epi8(lut, _mm512_and_si512(packedVal, mask));
+    s1 = _mm512_shuffle_epi8(
+        lut, _mm512_and_si512(_mm512_srli_epi16(packedVal, 2), mask));
+    s2 = _mm512_shuffle_epi8(
+        lut, _mm512_and_si512(_mm512_srli_epi16(packedVal, 4), mask));
+    s3 = _mm512_shuffle_epi8(
+        lut, _mm512_and_si512(_mm512_srli_epi16(packedVal, 6), mask));
+
+    // Interleave back into sample order, one 128-bit lane at a time
+    pairLo = _mm512_unpacklo_epi8(s0, s1);
+    pairHi = _mm512_unpackhi_epi8(s0, s1);
+    quadLo = _mm512_unpacklo_epi8(s2, s3);
+    quadHi = _mm512_unpackhi_epi8(s2, s3);
+    q0 = _mm512_unpacklo_epi16(pairLo, quadLo);
+    q1 = _mm512_unpackhi_epi16(pairLo, quadLo);
+    q2 = _mm512_unpacklo_epi16(pairHi, quadHi);
+    q3 = _mm512_unpackhi_epi16(pairHi, quadHi);
+
+    // Transpose the 4x4 grid of 128-bit lanes to undo the lane split
+    t0 = _mm512_shuffle_i64x2(q0, q1, 0x44);
+    t1 = _mm512_shuffle_i64x2(q2, q3, 0x44);
+    t2 = _mm512_shuffle_i64x2(q0, q1, 0xEE);
+    t3 = _mm512_shuffle_i64x2(q2, q3, 0xEE);
+    _mm512_storeu_si512((__m512i *)samples, _mm512_shuffle_i64x2(t0, t1, 0x88));
+    _mm512_storeu_si512((__m512i *)(samples + 64),
+                        _mm512_shuffle_i64x2(t0, t1, 0xDD));
+    _mm512_storeu_si512((__m512i *)(samples + 128),
+                        _mm512_shuffle_i64x2(t2, t3, 0x88));
+    _mm512_storeu_si512((__m512i *)(samples + 192),
+                        _mm512_shuffle_i64x2(t2, t3, 0xDD));
+
+    // Increment pointers
+    packed += 64;
+    samples += 256;
+  }
+
+  // Perform non SIMD leftover operations
+  for (inda = sixtyfourth_points * 64; inda < num_bytes; inda++) {
+    samples[0] = levels[*packed & 0x03];
+    samples[1] = levels[(*packed >> 2) & 0x03];
+    samples[2] = levels[(*packed >> 4) & 0x03];
+    samples[3] = levels[(*packed >> 6) & 0x03];
+    packed++;
+    samples += 4;
+  }
+}
+
+/*!
+ *  \brief Unpacks 4-bit sign/magnitude samples into one int8_t per sample
+ *  \details Each byte holds two samples, the first one in the low nibble.
+ * Within a sample bit 3 is the sign and bits 0-2 the magnitude, giving levels
+ * from -7 to +7. The levels are looked up with a byte shuffle and interleaved
+ * back into sample order, producing 128 samples per 64 packed bytes.
+ *  \param[out] samples Unpacked samples, 2 * num_bytes elements
+ *  \param[in] packed Packed samples
+ *  \param[in] num_bytes Number of packed bytes
+ */
+void avx512_unpack_4bit_si8(int8_t *samples, const uint8_t *packed,
+                            const int32_t num_bytes) {
+
+  int32_t inda;
+  const uint32_t sixtyfourth_points = num_bytes / 64;
+  const int8_t levels[16] = {0, 1,  2,  3,  4,  5,  6,  7,
+                             0, -1, -2, -3, -4, -5, -6, -7};
 
-    // 5- Store values in output buffer
-    _mm512_storeu_ps((float *)sig_nco, nco);
+  // Important variable declarations
+  const __m512i lut = _mm512_broadcast_i32x4(_mm_setr_epi8(
+      0, 1, 2, 3, 4, 5, 6, 7, 0, -1, -2, -3, -4, -5, -6, -7));
+  const __m512i mask = _mm512_set1_epi8(0x0F);
+  const __m512i first_half = _mm512_setr_epi64(0, 1, 8, 9, 2, 3, 10, 11);
+  const __m512i second_half = _mm512_setr_epi64(4, 5, 12, 13, 6, 7, 14, 15);
+  __m512i packedVal, s0, s1, pairLo, pairHi;
+
+  for (inda = 0; inda < sixtyfourth_points; inda++) {
+
+    packedVal = _mm512_loadu_si512((__m512i *)packed);
+
+    // Look up the level of both samples of every byte
+    s0 = _mm512_shuffle_epi8(lut, _mm512_and_si512(packedVal, mask));
+    s1 = _mm512_shuffle_epi8(
+        lut, _mm512_and_si512(_mm512_srli_epi16(packedVal, 4), mask));
+
+    // Interleave back into sample order and undo the lane split
+    pairLo = _mm512_unpacklo_epi8(s0, s1);
+    pairHi = _mm512_unpackhi_epi8(s0, s1);
+    _mm512_storeu_si512((__m512i *)samples,
+                        _mm512_permutex2var_epi64(pairLo, first_half, pairHi));
+    _mm512_storeu_si512((__m512i *)(samples + 64),
+                        _mm512_permutex2var_epi64(pairLo, second_half, pairHi));
 
-    // 6- Update pointers
-    sig_nco += 16;
+    // Increment pointers
+    packed += 64;
+    samples += 128;
   }
 
-  inda = sixteenth_points * 16;
-  phase_base = _mm512_extracti32x8_epi32(carr_phase_base, 1);
-  nom_carr_phase_base = (uint32_t)_mm256_extract_epi32(phase_base, 7);
-
-  // generate buffer of output
-  for (; inda < blk_size; ++inda) {
-    // Obtain integer index in 8:24 number
-    nom_carr_idx = (nom_carr_phase_base >> 24) & 0xFF;
-    // Look in lut
-    *sig_nco++ = lut[nom_carr_idx]; // get sample value from lut
-    // Delta step
-    nom_carr_phase_base += nom_carr_step;
+  // Perform non SIMD leftover operations
+  for (inda = sixtyfourth_points * 64; inda < num_bytes; inda++) {
+    samples[0] = levels[*packed & 0x0F];
+    samples[1] = levels[*packed >> 4];
+    packed++;
+    samples += 2;
   }
 }
 
 /*!
- *  \brief Generates a nominal NCO based on the direct lookup table approach as
- * fl32 type
- *  \param[out] sig_nco Sinusoidal wave generated byt the NCO
- *  \param[in] lut Lookup table to be use for the code
- *  \param[in] blk_size Total number of elements in the sig_nco vector
- *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
- *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
- *  \param[in] samp_freq Sampling frequency of the signal to be generated
+ *  \brief Packs the signs of int8_t samples into 64-bit words
+ *  \details Same layout as nom_pack_sign_si8(). The sign bits of 64 samples
+ * are moved into a mask register, which is one word.
+ *  \param[out] bits Packed signs, (num_points + 63) / 64 words
+ *  \param[in] samples Samples to pack
+ *  \param[in] num_points Number of samples
  */
-void avx512_nom_nco_fl32(float *sig_nco, const float *lut,
-                         const int32_t blk_size, const double rem_carr_phase,
-                         const double carr_freq, const double samp_freq) {
+void avx512_pack_sign_si8(uint64_t *bits, const int8_t *samples,
+                          const int32_t num_points) {
 
-  uint32_t carrPhaseBase =
-      (rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
-  uint32_t carrStep = (carr_freq * (4294967296.0 / samp_freq) + 0.5);
-  uint32_t carrIndex = 0;
   int32_t inda;
+  const uint32_t sixtyfourth_points = num_points / 64;
 
-  // for each sample
-  for (inda = 0; inda < blk_size; ++inda) {
-    // Obtain integer index in 8:24 number
-    carrIndex = (carrPhaseBase >> 24) & 0xFF;
-
-    // Look in lut
-    sig_nco[inda] = lut[carrIndex];
+  for (inda = 0; inda < sixtyfourth_points; inda++) {
+    *bits++ = _mm512_movepi8_mask(_mm512_loadu_si512(samples));
+    samples += 64;
+  }
 
-    // Delta step
-    carrPhaseBase += carrStep;
+  // Perform non SIMD leftover operations
+  if (num_points % 64) {
+    *bits = 0;
+    for (inda = 0; inda < num_points % 64; inda++) {
+      *bits |= (uint64_t)(samples[inda] < 0) << inda;
+    }
   }
 }
 
 /*!
- *  \brief Generates an Early, Late and Propmt CA code based on the direct
- * lookup table approach
- * \param[out] ecode Early CA code
- * \param[out] pcode Prompt CA code
- * \param[out] lcode Late CA code
- * \param[in] cacode Nominal satellite ranging code
- * \param[in] blk_size Total number of elements in the sig_nco vector
- * \param[in] rem_code_phase Carrier phase remainder of the sinusoidal wave
- * \param[in] code_freq Carrier frequency of the sinusoidal wave
- * \param[in] samp_freq Sampling frequency of the signal to be generated
+ *  \brief Packs the signs of int32_t samples into 64-bit words
+ *  \details Same layout as nom_pack_sign_si8(). The sign bits of 16 samples
+ * are moved into a mask register, four of them filling a word.
+ *  \param[out] bits Packed signs, (num_points + 63) / 64 words
+ *  \param[in] samples Samples to pack
+ *  \param[in] num_points Number of samples
  */
-void avx512_nom_code_fl32(float *ecode, float *pcode, float *lcode,
-                          const float *cacode, const int32_t blk_size,
-                          const double rem_code_phase, const double code_freq,
-                          const double samp_freq) {
+void avx512_pack_sign_si32(uint64_t *bits, const int32_t *samples,
+                           const int32_t num_points) {
 
   int32_t inda;
-  double earlyLateSpc = 0.5;
-  double codePhaseStep = code_freq / samp_freq;
-  double baseCode;
-  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
-
-  // for each sample
-  for (inda = 0; inda < blk_size; ++inda) {
-    baseCode = (inda * codePhaseStep + rem_code_phase);
-    pCodeIdx = (float)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
-    eCodeIdx = (float)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
-                   ? (baseCode - earlyLateSpc + 1)
-                   : (baseCode - earlyLateSpc);
-    lCodeIdx = (float)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
-                   ? (baseCode + earlyLateSpc + 1)
-                   : (baseCode + earlyLateSpc);
+  const uint32_t sixtyfourth_points = num_points / 64;
+  uint64_t word;
+
+  for (inda = 0; inda < sixtyfourth_points; inda++) {
+    word = 0;
+    for (int k = 0; k < 4; k++) {
+      word |= (uint64_t)_mm512_movepi32_mask(
+                  _mm512_loadu_si512(samples + 16 * k))
+              << (16 * k);
+    }
+    *bits++ = word;
+    samples += 64;
+  }
 
-    ecode[inda] = *(cacode + eCodeIdx);
-    pcode[inda] = *(cacode + pCodeIdx);
-    lcode[inda] = *(cacode + lCodeIdx);
+  // Perform non SIMD leftover operations
+  if (num_points % 64) {
+    *bits = 0;
+    for (inda = 0; inda < num_points % 64; inda++) {
+      *bits |= (uint64_t)(samples[inda] < 0) << inda;
+    }
   }
 }
 
 /*!
- *  \brief Generates an Early, Late and Propmt CA code based on the direct
- * lookup table approach with SIMD instructions
- *  \param[out] ecode Early CA code
- *  \param[out] pcode Prompt CA code
- *  \param[out] lcode Late CA code
- *  \param[in] cacode Nominal satellite ranging code
- *  \param[in] blk_size Total number of elements in the sig_nco vector
- *  \param[in] rem_code_phase Carrier phase remainder of the sinusoidal wave
- *  \param[in] code_freq Carrier frequency of the sinusoidal wave
- *  \param[in] samp_freq Sampling frequency of the signal to be generated
+ *  \brief Correlates two vectors of packed signs
+ *  \details Same result as nom_xor_and_acc_b1(). The bits set in a XOR b are
+ * counted per nibble with a byte shuffle and summed into 64-bit lanes with a
+ * sum of absolute differences, 512 samples per iteration. CPUs with
+ * AVX512-VPOPCNTDQ use avx512_xor_and_acc_b1_vpopcnt() instead.
+ *  \param[in] a_bits First vector of packed signs
+ *  \param[in] b_bits Second vector of packed signs
+ *  \param[in] num_points Number of points in each vector
+ *  \return Correlation of the +1/-1 values
  */
-void avx512_code_fl32(float *ecode, float *pcode, float *lcode,
-                      const float *cacode, const int32_t blk_size,
-                      const float rem_code_phase, const float code_freq,
-                      const float samp_freq) {
+int32_t avx512_xor_and_acc_b1(const uint64_t *a_bits, const uint64_t *b_bits,
+                              const int32_t num_points) {
 
   int32_t inda;
-  const uint32_t sixteenth_points = blk_size / 16;
-  float earlyLateSpc = 0.5;
-  float codePhaseStep = code_freq / samp_freq;
-  float baseCode;
-  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+  const int32_t num_words = num_points / 64;
+  const uint32_t eighth_words = num_words / 8;
+  int64_t flips;
+  uint64_t diff;
+
+  const __m512i lut = _mm512_broadcast_i32x4(
+      _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4));
+  const __m512i mask = _mm512_set1_epi8(0x0F);
+  const __m512i zero = _mm512_setzero_si512();
+  __m512i diffVal, count;
+  __m512i accumulator = _mm512_setzero_si512();
 
-  // Important variable declarations
-  __m512 ecode_phase_base = _mm512_set1_ps(rem_code_phase - earlyLateSpc + 0.5);
-  __m512 pcode_phase_base = _mm512_set1_ps(rem_code_phase + 0.5);
-  __m512 lcode_phase_base = _mm512_set1_ps(rem_code_phase + earlyLateSpc + 0.5);
+  for (inda = 0; inda < eighth_words; inda++) {
+    diffVal = _mm512_xor_si512(_mm512_loadu_si512(a_bits),
+                               _mm512_loadu_si512(b_bits));
 
-  __m512 code_step_base =
-      _mm512_set_ps(15 * codePhaseStep, 14 * codePhaseStep, 12 * codePhaseStep,
-                    12 * codePhaseStep, 11 * codePhaseStep, 10 * codePhaseStep,
-                    9 * codePhaseStep, 8 * codePhaseStep, 7 * codePhaseStep,
-                    6 * codePhaseStep, 5 * codePhaseStep, 4 * codePhaseStep,
-                    3 * codePhaseStep, 2 * codePhaseStep, 1 * codePhaseStep,
-                    0 * codePhaseStep);
-  __m512i ecode_idx = _mm512_set1_epi32(0);
-  __m512i pcode_idx = _mm512_set1_epi32(0);
-  __m512i lcode_idx = _mm512_set1_epi32(0);
+    // Bits set in the low and high nibble of every byte
+    count = _mm512_add_epi8(
+        _mm512_shuffle_epi8(lut, _mm512_and_si512(diffVal, mask)),
+        _mm512_shuffle_epi8(
+            lut, _mm512_and_si512(_mm512_srli_epi16(diffVal, 4), mask)));
+    accumulator = _mm512_add_epi64(accumulator, _mm512_sad_epu8(count, zero));
 
-  __m512 elut, plut, llut;
-  __m512 code_step_offset = _mm512_set1_ps(16 * codePhaseStep);
+    // Increment pointers
+    a_bits += 8;
+    b_bits += 8;
+  }
 
-  // First iteration happens outside the loop
-  ecode_phase_base = _mm512_add_ps(ecode_phase_base, code_step_base);
-  pcode_phase_base = _mm512_add_ps(pcode_phase_base, code_step_base);
-  lcode_phase_base = _mm512_add_ps(lcode_phase_base, code_step_base);
+  flips = _mm512_reduce_add_epi64(accumulator);
 
-  for (inda = 0; inda < sixteenth_points; inda++) {
-    // Obtain integer index in 8:24 number
-    ecode_idx = _mm512_cvtps_epi32(ecode_phase_base);
-    pcode_idx = _mm512_cvtps_epi32(pcode_phase_base);
-    lcode_idx = _mm512_cvtps_epi32(lcode_phase_base);
+  // Perform non SIMD leftover operations
+  for (inda = eighth_words * 8; inda < num_words; inda++) {
+    flips += __builtin_popcountll(*a_bits++ ^ *b_bits++);
+  }
+  if (num_points % 64) {
+    diff = (*a_bits ^ *b_bits) & ((1ull << (num_points % 64)) - 1);
+    flips += __builtin_popcountll(diff);
+  }
+  return num_points - 2 * (int32_t)flips;
+}
 
-    // Look in lut
-    elut = _mm512_i32gather_ps(ecode_idx, cacode, 4);
-    plut = _mm512_i32gather_ps(pcode_idx, cacode, 4);
-    llut = _mm512_i32gather_ps(lcode_idx, cacode, 4);
+#pragma GCC push_options
+#pragma GCC target("avx512vpopcntdq")
 
-    // Delta step
-    ecode_phase_base = _mm512_add_ps(ecode_phase_base, code_step_offset);
-    pcode_phase_base = _mm512_add_ps(pcode_phase_base, code_step_offset);
-    lcode_phase_base = _mm512_add_ps(lcode_phase_base, code_step_offset);
+/*!
+ *  \brief Correlates two vectors of packed signs with a vector popcount
+ *  \details Same result as nom_xor_and_acc_b1(), with the bits set in a XOR
+ * b counted by vpopcntq, 512 samples per instruction. Requires
+ * AVX512-VPOPCNTDQ, which gnss_dispatch_init() checks before binding it.
+ *  \param[in] a_bits First vector of packed signs
+ *  \param[in] b_bits Second vector of packed signs
+ *  \param[in] num_points Number of points in each vector
+ *  \return Correlation of the +1/-1 values
+ */
+int32_t avx512_xor_and_acc_b1_vpopcnt(const uint64_t *a_bits,
+                                      const uint64_t *b_bits,
+                                      const int32_t num_points) {
 
-    // 5- Store values in output buffer
-    _mm512_storeu_ps((float *)ecode, elut);
-    _mm512_storeu_ps((float *)pcode, plut);
-    _mm512_storeu_ps((float *)lcode, llut);
+  int32_t inda;
+  const int32_t num_words = num_points / 64;
+  const uint32_t eighth_words = num_words / 8;
+  int64_t flips;
+  uint64_t diff;
+  __m512i diffVal;
+  __m512i accumulator = _mm512_setzero_si512();
 
-    // 6- Update pointers
-    ecode += 16;
-    pcode += 16;
-    lcode += 16;
-  }
+  for (inda = 0; inda < eighth_words; inda++) {
+    diffVal = _mm512_xor_si512(_mm512_loadu_si512(a_bits),
+                               _mm512_loadu_si512(b_bits));
+    accumulator = _mm512_add_epi64(accumulator, _mm512_popcnt_epi64(diffVal));
 
-  inda = sixteenth_points * 16;
+    // Increment pointers
+    a_bits += 8;
+    b_bits += 8;
+  }
 
-  // generate buffer of output
-  for (; inda < blk_size; ++inda) {
-    baseCode = (inda * codePhaseStep + rem_code_phase);
-    pCodeIdx = (float)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
-    eCodeIdx = (float)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
-                   ? (baseCode - earlyLateSpc + 1)
-                   : (baseCode - earlyLateSpc);
-    lCodeIdx = (float)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
-                   ? (baseCode + earlyLateSpc + 1)
-                   : (baseCode + earlyLateSpc);
+  flips = _mm512_reduce_add_epi64(accumulator);
 
-    ecode[inda] = *(cacode + eCodeIdx);
-    pcode[inda] = *(cacode + pCodeIdx);
-    lcode[inda] = *(cacode + lCodeIdx);
+  // Perform non SIMD leftover operations
+  for (inda = eighth_words * 8; inda < num_words; inda++) {
+    flips += __builtin_popcountll(*a_bits++ ^ *b_bits++);
+  }
+  if (num_points % 64) {
+    diff = (*a_bits ^ *b_bits) & ((1ull << (num_points % 64)) - 1);
+    flips += __builtin_popcountll(diff);
   }
+  return num_points - 2 * (int32_t)flips;
 }
 
+#pragma GCC pop_options
+
 /*!
  *  \brief Multiply and accumulates product of two vectors storing the result in
  * an fl32 type
@@ -680,6 +3325,119 @@ static inline float avx512_mul_and_acc_fl32(const float *avector,
   return returnValue;
 }
 
+/*!
+ *  \brief Correlates the Early, Prompt and Late codes against the in-phase and
+ * quadrature baseband signals in a single pass as fl32 types
+ *  \details Equivalent to six avx512_mul_and_acc_fl32() calls, but every input
+ * vector is streamed through the cache only once.
+ *  \param[out] i_e Early in-phase correlation
+ *  \param[out] i_p Prompt in-phase correlation
+ *  \param[out] i_l Late in-phase correlation
+ *  \param[out] q_e Early quadrature correlation
+ *  \param[out] q_p Prompt quadrature correlation
+ *  \param[out] q_l Late quadrature correlation
+ *  \param[in] ecode Early CA code
+ *  \param[in] pcode Prompt CA code
+ *  \param[in] lcode Late CA code
+ *  \param[in] sig_sin Baseband signal mixed with the sine carrier
+ *  \param[in] sig_cos Baseband signal mixed with the cosine carrier
+ *  \param[in] num_points Number of points in each vector
+ */
+static inline void
+avx512_correlate_epl_fl32(double *i_e, double *i_p, double *i_l, double *q_e,
+                          double *q_p, double *q_l, const float *ecode,
+                          const float *pcode, const float *lcode,
+                          const float *sig_sin, const float *sig_cos,
+                          uint32_t num_points) {
+
+  uint32_t number = 0;
+  const uint32_t sixteenth_points = num_points / 16;
+  float tempBuffer[6][16];
+  float returnValue[6] = {0, 0, 0, 0, 0, 0};
+  int32_t k;
+
+  __m512 eVal, pVal, lVal, sinVal, cosVal;
+  __m512 acc_ie = _mm512_setzero_ps();
+  __m512 acc_ip = _mm512_setzero_ps();
+  __m512 acc_il = _mm512_setzero_ps();
+  __m512 acc_qe = _mm512_setzero_ps();
+  __m512 acc_qp = _mm512_setzero_ps();
+  __m512 acc_ql = _mm512_setzero_ps();
+
+  for (; number < sixteenth_points; number++) {
+
+    // Load every input only once per iteration
+    eVal = _mm512_loadu_ps(ecode);
+    pVal = _mm512_loadu_ps(pcode);
+    lVal = _mm512_loadu_ps(lcode);
+    sinVal = _mm512_loadu_ps(sig_sin);
+    cosVal = _mm512_loadu_ps(sig_cos);
+
+    // In-phase arm
+    acc_ie = _mm512_add_ps(acc_ie, _mm512_mul_ps(eVal, sinVal));
+    acc_ip = _mm512_add_ps(acc_ip, _mm512_mul_ps(pVal, sinVal));
+    acc_il = _mm512_add_ps(acc_il, _mm512_mul_ps(lVal, sinVal));
+
+    // Quadrature arm
+    acc_qe = _mm512_add_ps(acc_qe, _mm512_mul_ps(eVal, cosVal));
+    acc_qp = _mm512_add_ps(acc_qp, _mm512_mul_ps(pVal, cosVal));
+    acc_ql = _mm512_add_ps(acc_ql, _mm512_mul_ps(lVal, cosVal));
+
+    // Increment pointers
+    ecode += 16;
+    pcode += 16;
+    lcode += 16;
+    sig_sin += 16;
+    sig_cos += 16;
+  }
+
+  _mm512_storeu_ps(tempBuffer[0], acc_ie);
+  _mm512_storeu_ps(tempBuffer[1], acc_ip);
+  _mm512_storeu_ps(tempBuffer[2], acc_il);
+  _mm512_storeu_ps(tempBuffer[3], acc_qe);
+  _mm512_storeu_ps(tempBuffer[4], acc_qp);
+  _mm512_storeu_ps(tempBuffer[5], acc_ql);
+
+  for (k = 0; k < 6; k++) {
+    returnValue[k] = tempBuffer[k][0];
+    returnValue[k] += tempBuffer[k][1];
+    returnValue[k] += tempBuffer[k][2];
+    returnValue[k] += tempBuffer[k][3];
+    returnValue[k] += tempBuffer[k][4];
+    returnValue[k] += tempBuffer[k][5];
+    returnValue[k] += tempBuffer[k][6];
+    returnValue[k] += tempBuffer[k][7];
+    returnValue[k] += tempBuffer[k][8];
+    returnValue[k] += tempBuffer[k][9];
+    returnValue[k] += tempBuffer[k][10];
+    returnValue[k] += tempBuffer[k][11];
+    returnValue[k] += tempBuffer[k][12];
+    returnValue[k] += tempBuffer[k][13];
+    returnValue[k] += tempBuffer[k][14];
+    returnValue[k] += tempBuffer[k][15];
+  }
+
+  // Perform non SIMD leftover operations
+  number = sixteenth_points * 16;
+  for (; number < num_points; number++) {
+    returnValue[0] += (*ecode) * (*sig_sin);
+    returnValue[1] += (*pcode) * (*sig_sin);
+    returnValue[2] += (*lcode) * (*sig_sin);
+    returnValue[3] += (*ecode++) * (*sig_cos);
+    returnValue[4] += (*pcode++) * (*sig_cos);
+    returnValue[5] += (*lcode++) * (*sig_cos);
+    sig_sin++;
+    sig_cos++;
+  }
+
+  *i_e = returnValue[0];
+  *i_p = returnValue[1];
+  *i_l = returnValue[2];
+  *q_e = returnValue[3];
+  *q_p = returnValue[4];
+  *q_l = returnValue[5];
+}
+
 /*!
  *  \brief Multiply point to point two vectors together as a fl32 type
  * \param[out] cvector Product of point to point multiplication
@@ -806,3 +3564,206 @@ static inline double avx512_mul_and_acc_16i(const short *avector,
   }
   return returnValue;
 }
+
+/*!
+ *  \brief Multiply and accumulates two vectors of si16 type into si32 lanes
+ *  \details vpmaddwd multiplies the 16-bit samples into 32-bit products and
+ * adds adjacent pairs in one instruction, so unlike avx512_mul_and_acc_16i()
+ * no product is truncated and the sum is not saturated. The lanes wrap modulo
+ * 2^32 like the nominal si32 sum.
+ *  \param[in] aVector First vector to multiply
+ *  \param[in] bVector Second vector to multiply
+ *  \param[in] num_points Number of points in each vector
+ *  \return Accumulation result as a double
+ */
+static inline double avx512_mul_and_acc_si16(const int16_t *aVector,
+                                             const int16_t *bVector,
+                                             uint32_t num_points) {
+
+  int32_t returnValue;
+  uint32_t number = 0;
+  const uint32_t thirtysecondthPoints = num_points / 32;
+  __m512i aVal, bVal;
+  __m512i accumulator = _mm512_setzero_si512();
+
+  for (; number < thirtysecondthPoints; number++) {
+    aVal = _mm512_loadu_si512(aVector);
+    bVal = _mm512_loadu_si512(bVector);
+    accumulator = _mm512_add_epi32(accumulator, _mm512_madd_epi16(aVal, bVal));
+
+    // Increment pointers
+    aVector += 32;
+    bVector += 32;
+  }
+
+  returnValue = _mm512_reduce_add_epi32(accumulator);
+
+  // Perform non SIMD leftover operations
+  for (number = thirtysecondthPoints * 32; number < num_points; number++) {
+    returnValue += (*aVector++) * (*bVector++);
+  }
+  return returnValue;
+}
+
+/*!
+ *  \brief Multiply and accumulates two vectors of si8 type into si32 lanes
+ *  \details Sign extends both vectors to 16 bits and accumulates them with
+ * vpmaddwd as avx512_mul_and_acc_si16() does, for CPUs without AVX512-VNNI.
+ *  \param[in] aVector First vector to multiply
+ *  \param[in] bVector Second vector to multiply
+ *  \param[in] num_points Number of points in each vector
+ *  \return Accumulation result as a double
+ */
+static inline double avx512_mul_and_acc_si8(const int8_t *aVector,
+                                            const int8_t *bVector,
+                                            uint32_t num_points) {
+
+  int32_t returnValue;
+  uint32_t number = 0;
+  const uint32_t thirtysecondthPoints = num_points / 32;
+  __m512i aVal, bVal;
+  __m512i accumulator = _mm512_setzero_si512();
+
+  for (; number < thirtysecondthPoints; number++) {
+    aVal = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)aVector));
+    bVal = _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i *)bVector));
+    accumulator = _mm512_add_epi32(accumulator, _mm512_madd_epi16(aVal, bVal));
+
+    // Increment pointers
+    aVector += 32;
+    bVector += 32;
+  }
+
+  returnValue = _mm512_reduce_add_epi32(accumulator);
+
+  // Perform non SIMD leftover operations
+  for (number = thirtysecondthPoints * 32; number < num_points; number++) {
+    returnValue += (*aVector++) * (*bVector++);
+  }
+  return returnValue;
+}
+
+#pragma GCC push_options
+#pragma GCC target("avx512vnni")
+
+/*!
+ *  \brief Multiply and accumulates two vectors of si16 type with AVX512-VNNI
+ *  \details vpdpwssd multiplies pairs of 16-bit samples and adds both
+ * products to a 32-bit lane in one instruction, so unlike
+ * avx512_mul_and_acc_16i() nothing is truncated or saturated. The lanes wrap
+ * modulo 2^32 like the nominal si32 sum. Four accumulators hide the latency
+ * of vpdpwssd, which a single dependency chain would expose.
+ *  \param[in] aVector First vector to multiply
+ *  \param[in] bVector Second vector to multiply
+ *  \param[in] num_points Number of points in each vector
+ *  \return Accumulation result as a double
+ */
+static inline double avx512_mul_and_acc_si16_vnni(const int16_t *aVector,
+                                                  const int16_t *bVector,
+                                                  uint32_t num_points) {
+
+  int32_t returnValue;
+  uint32_t number = 0;
+  const uint32_t thirtysecondthPoints = num_points / 32;
+  __m512i acc0 = _mm512_setzero_si512();
+  __m512i acc1 = _mm512_setzero_si512();
+  __m512i acc2 = _mm512_setzero_si512();
+  __m512i acc3 = _mm512_setzero_si512();
+
+  for (; number + 4 <= thirtysecondthPoints; number += 4) {
+    acc0 = _mm512_dpwssd_epi32(acc0, _mm512_loadu_si512(aVector),
+                               _mm512_loadu_si512(bVector));
+    acc1 = _mm512_dpwssd_epi32(acc1, _mm512_loadu_si512(aVector + 32),
+                               _mm512_loadu_si512(bVector + 32));
+    acc2 = _mm512_dpwssd_epi32(acc2, _mm512_loadu_si512(aVector + 64),
+                               _mm512_loadu_si512(bVector + 64));
+    acc3 = _mm512_dpwssd_epi32(acc3, _mm512_loadu_si512(aVector + 96),
+                               _mm512_loadu_si512(bVector + 96));
+
+    // Increment pointers
+    aVector += 128;
+    bVector += 128;
+  }
+  for (; number < thirtysecondthPoints; number++) {
+    acc0 = _mm512_dpwssd_epi32(acc0, _mm512_loadu_si512(aVector),
+                               _mm512_loadu_si512(bVector));
+    aVector += 32;
+    bVector += 32;
+  }
+
+  acc0 = _mm512_add_epi32(_mm512_add_epi32(acc0, acc1),
+                          _mm512_add_epi32(acc2, acc3));
+  returnValue = _mm512_reduce_add_epi32(acc0);
+
+  // Perform non SIMD leftover operations
+  for (number = thirtysecondthPoints * 32; number < num_points; number++) {
+    returnValue += (*aVector++) * (*bVector++);
+  }
+  return returnValue;
+}
+
+/*!
+ *  \brief Multiply and accumulates two vectors of si8 type with AVX512-VNNI
+ *  \details vpdpbusd multiplies unsigned by signed bytes and adds four
+ * products to a 32-bit lane. The first vector is biased to unsigned by
+ * flipping its sign bit, which adds 128 to every sample, and the bias is
+ * removed with a second vpdpbusd of 128 against the second vector:
+ * sum((a + 128) * b) - sum(128 * b). Both lanes wrap modulo 2^32, so the
+ * difference is exact whenever the result fits in 32 bits. Two pairs of
+ * accumulators hide the latency of vpdpbusd.
+ *  \param[in] aVector First vector to multiply
+ *  \param[in] bVector Second vector to multiply
+ *  \param[in] num_points Number of points in each vector
+ *  \return Accumulation result as a double
+ */
+static inline double avx512_mul_and_acc_si8_vnni(const int8_t *aVector,
+                                                 const int8_t *bVector,
+                                                 uint32_t num_points) {
+
+  int32_t returnValue;
+  uint32_t number = 0;
+  const uint32_t sixtyfourthPoints = num_points / 64;
+  const __m512i bias = _mm512_set1_epi8((char)0x80);
+  __m512i aVal, bVal, cVal, dVal;
+  __m512i acc0 = _mm512_setzero_si512();
+  __m512i acc1 = _mm512_setzero_si512();
+  __m512i biasSum0 = _mm512_setzero_si512();
+  __m512i biasSum1 = _mm512_setzero_si512();
+
+  for (; number + 2 <= sixtyfourthPoints; number += 2) {
+    aVal = _mm512_xor_si512(_mm512_loadu_si512(aVector), bias);
+    bVal = _mm512_loadu_si512(bVector);
+    cVal = _mm512_xor_si512(_mm512_loadu_si512(aVector + 64), bias);
+    dVal = _mm512_loadu_si512(bVector + 64);
+    acc0 = _mm512_dpbusd_epi32(acc0, aVal, bVal);
+    biasSum0 = _mm512_dpbusd_epi32(biasSum0, bias, bVal);
+    acc1 = _mm512_dpbusd_epi32(acc1, cVal, dVal);
+    biasSum1 = _mm512_dpbusd_epi32(biasSum1, bias, dVal);
+
+    // Increment pointers
+    aVector += 128;
+    bVector += 128;
+  }
+  for (; number < sixtyfourthPoints; number++) {
+    aVal = _mm512_xor_si512(_mm512_loadu_si512(aVector), bias);
+    bVal = _mm512_loadu_si512(bVector);
+    acc0 = _mm512_dpbusd_epi32(acc0, aVal, bVal);
+    biasSum0 = _mm512_dpbusd_epi32(biasSum0, bias, bVal);
+    aVector += 64;
+    bVector += 64;
+  }
+
+  acc0 = _mm512_add_epi32(acc0, acc1);
+  biasSum0 = _mm512_add_epi32(biasSum0, biasSum1);
+  returnValue = _mm512_reduce_add_epi32(_mm512_sub_epi32(acc0, biasSum0));
+
+  // Perform non SIMD leftover operations
+  for (number = sixtyfourthPoints * 64; number < num_points; number++) {
+    returnValue += (*aVector++) * (*bVector++);
+  }
+  return returnValue;
+}
+
+#pragma GCC pop_options
+
+#endif /* AVX512_INTRINSICS_H */
@@ -0,0 +1,112 @@
+/*!
+ *  \file carrier_lut.h
+ *  \brief      Static carrier lookup tables sized at compile time
+ *  \details    Provides the sine and cosine tables read by the carrier NCO
+ * kernels as static const, cache line aligned arrays of GNSS_NCO_LUT_SIZE
+ * entries, so receivers no longer build them with sinf()/cosf() at startup.
+ * The entries are expanded by the preprocessor and folded to constants by
+ * the compiler. Building with -DGNSS_NCO_LUT_BITS=N, with N from 2 to 12,
+ * trades carrier accuracy for L1 footprint. The si32 values match the tables
+ * the standalone drivers build at runtime for the same size, the fl32 ones
+ * are correctly rounded and may differ from glibc's sinf() by one ulp.
+ *  \author    Damian Miralles
+ *  \author    Jake Johnson
+ *  \version   4.1a
+ *  \date      Jan 23, 2018
+ *  \pre       GCC, which folds sinf() and cosf() of constants in static
+ * initializers.
+ */
+
+#ifndef CARRIER_LUT_H
+#define CARRIER_LUT_H
+
+#include "nco_state.h"
+#include <math.h>
+#include <stdint.h>
+
+//! Peak amplitude of the carrier tables
+#define GNSS_NCO_LUT_AMPLITUDE 10.0
+
+//! Value of pi used by the drivers to build their tables
+#define GNSS_NCO_LUT_PI 3.1415926535
+
+//! Alignment of the carrier tables in bytes
+#define GNSS_NCO_LUT_ALIGN 64
+
+//! Phase of entry i of the tables, in radians
+#define GNSS_NCO_LUT_ARG(i)                                                    \
+  ((float)(2.0 * GNSS_NCO_LUT_PI * (float)(i) / GNSS_NCO_LUT_SIZE))
+
+//! Entries of the si32 and fl32 tables
+#define GNSS_NCO_LUT_SIN_SI32(i)                                               \
+  (int32_t)(GNSS_NCO_LUT_AMPLITUDE * sinf(GNSS_NCO_LUT_ARG(i)))
+#define GNSS_NCO_LUT_COS_SI32(i)                                               \
+  (int32_t)(GNSS_NCO_LUT_AMPLITUDE * cosf(GNSS_NCO_LUT_ARG(i)))
+#define GNSS_NCO_LUT_SIN_FL32(i)                                               \
+  (float)(GNSS_NCO_LUT_AMPLITUDE * sinf(GNSS_NCO_LUT_ARG(i)))
+#define GNSS_NCO_LUT_COS_FL32(i)                                               \
+  (float)(GNSS_NCO_LUT_AMPLITUDE * cosf(GNSS_NCO_LUT_ARG(i)))
+
+//! Entries of the packed and interleaved quadrature tables
+#define GNSS_NCO_LUT_SINCOS_SI32(i)                                            \
+  (int32_t)(((uint32_t)GNSS_NCO_LUT_SIN_SI32(i) << 16) |                       \
+            (uint16_t)GNSS_NCO_LUT_COS_SI32(i))
+#define GNSS_NCO_LUT_SINCOS_FL32(i)                                            \
+  GNSS_NCO_LUT_SIN_FL32(i), GNSS_NCO_LUT_COS_FL32(i)
+
+// Expand F(0) to F((1 << bits) - 1) as a comma separated list
+#define GNSS_NCO_LUT_REP2(F, i) F(i), F(i + 1), F(i + 2), F(i + 3)
+#define GNSS_NCO_LUT_REP3(F, i)                                                \
+  GNSS_NCO_LUT_REP2(F, i), GNSS_NCO_LUT_REP2(F, i + 4)
+#define GNSS_NCO_LUT_REP4(F, i)                                                \
+  GNSS_NCO_LUT_REP3(F, i), GNSS_NCO_LUT_REP3(F, i + 8)
+#define GNSS_NCO_LUT_REP5(F, i)                                                \
+  GNSS_NCO_LUT_REP4(F, i), GNSS_NCO_LUT_REP4(F, i + 16)
+#define GNSS_NCO_LUT_REP6(F, i)                                                \
+  GNSS_NCO_LUT_REP5(F, i), GNSS_NCO_LUT_REP5(F, i + 32)
+#define GNSS_NCO_LUT_REP7(F, i)                                                \
+  GNSS_NCO_LUT_REP6(F, i), GNSS_NCO_LUT_REP6(F, i + 64)
+#define GNSS_NCO_LUT_REP8(F, i)                                                \
+  GNSS_NCO_LUT_REP7(F, i), GNSS_NCO_LUT_REP7(F, i + 128)
+#define GNSS_NCO_LUT_REP9(F, i)                                                \
+  GNSS_NCO_LUT_REP8(F, i), GNSS_NCO_LUT_REP8(F, i + 256)
+#define GNSS_NCO_LUT_REP10(F, i)                                               \
+  GNSS_NCO_LUT_REP9(F, i), GNSS_NCO_LUT_REP9(F, i + 512)
+#define GNSS_NCO_LUT_REP11(F, i)                                               \
+  GNSS_NCO_LUT_REP10(F, i), GNSS_NCO_LUT_REP10(F, i + 1024)
+#define GNSS_NCO_LUT_REP12(F, i)                                               \
+  GNSS_NCO_LUT_REP11(F, i), GNSS_NCO_LUT_REP11(F, i + 2048)
+#define GNSS_NCO_LUT_EXPAND_(bits, F) GNSS_NCO_LUT_REP##bits(F, 0)
+#define GNSS_NCO_LUT_EXPAND(bits, F) GNSS_NCO_LUT_EXPAND_(bits, F)
+
+//! si32 sine table
+static const int32_t gnss_sin_lut_si32[GNSS_NCO_LUT_SIZE]
+    __attribute__((aligned(GNSS_NCO_LUT_ALIGN))) = {
+        GNSS_NCO_LUT_EXPAND(GNSS_NCO_LUT_BITS, GNSS_NCO_LUT_SIN_SI32)};
+
+//! si32 cosine table
+static const int32_t gnss_cos_lut_si32[GNSS_NCO_LUT_SIZE]
+    __attribute__((aligned(GNSS_NCO_LUT_ALIGN))) = {
+        GNSS_NCO_LUT_EXPAND(GNSS_NCO_LUT_BITS, GNSS_NCO_LUT_COS_SI32)};
+
+//! fl32 sine table
+static const float gnss_sin_lut_fl32[GNSS_NCO_LUT_SIZE]
+    __attribute__((aligned(GNSS_NCO_LUT_ALIGN))) = {
+        GNSS_NCO_LUT_EXPAND(GNSS_NCO_LUT_BITS, GNSS_NCO_LUT_SIN_FL32)};
+
+//! fl32 cosine table
+static const float gnss_cos_lut_fl32[GNSS_NCO_LUT_SIZE]
+    __attribute__((aligned(GNSS_NCO_LUT_ALIGN))) = {
+        GNSS_NCO_LUT_EXPAND(GNSS_NCO_LUT_BITS, GNSS_NCO_LUT_COS_FL32)};
+
+//! Packed si32 table of the quadrature NCO, see gnss_nco_sincos_lut_si32()
+static const int32_t gnss_sincos_lut_si32[GNSS_NCO_LUT_SIZE]
+    __attribute__((aligned(GNSS_NCO_LUT_ALIGN))) = {
+        GNSS_NCO_LUT_EXPAND(GNSS_NCO_LUT_BITS, GNSS_NCO_LUT_SINCOS_SI32)};
+
+//! Interleaved fl32 table of the quadrature NCO, see gnss_nco_sincos_lut_fl32()
+static const float gnss_sincos_lut_fl32[2 * GNSS_NCO_LUT_SIZE]
+    __attribute__((aligned(GNSS_NCO_LUT_ALIGN))) = {
+        GNSS_NCO_LUT_EXPAND(GNSS_NCO_LUT_BITS, GNSS_NCO_LUT_SINCOS_FL32)};
+
+#endif /* CARRIER_LUT_H */
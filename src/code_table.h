@@ -0,0 +1,211 @@
+/*!
+ *  \file code_table.h
+ *  \brief      Built-in GPS L1 C/A code generator and per PRN code tables
+ *  \details    Generates the GPS L1 C/A Gold codes of PRN 1 to 32 from the
+ * G1 and G2 shift registers, so receivers no longer read the ranging code of
+ * each satellite from disk when channels start or reacquire. All codes are
+ * built once by gnss_code_table_init() into one cache line aligned table
+ * holding si8, si16, si32 and fl32 copies of every PRN. Each row uses the
+ * padded layout of data/caCode.bin expected by the code kernels, the last
+ * chip, the 1023 chips and then the first chip, and is padded up to
+ * GNSS_CA_CODE_STRIDE entries so every row starts on a cache line.
+ *  \author    Damian Miralles
+ *  \author    Jake Johnson
+ *  \version   4.1a
+ *  \date      Jan 23, 2018
+ */
+
+#ifndef CODE_TABLE_H
+#define CODE_TABLE_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+//! Number of chips of a GPS L1 C/A code period
+#define GNSS_CA_CODE_LENGTH 1023
+
+//! Number of GPS PRNs held by the code table
+#define GNSS_CA_NUM_PRN 32
+
+//! Entries of a padded code, one extra chip on each side
+#define GNSS_CA_CODE_PADDED (GNSS_CA_CODE_LENGTH + 2)
+
+//! Alignment of the code table rows in bytes
+#define GNSS_CODE_TABLE_ALIGN 64
+
+//! Entries between consecutive PRNs, a multiple of GNSS_CODE_TABLE_ALIGN
+#define GNSS_CA_CODE_STRIDE                                                    \
+  ((GNSS_CA_CODE_PADDED + GNSS_CODE_TABLE_ALIGN - 1) /                         \
+   GNSS_CODE_TABLE_ALIGN * GNSS_CODE_TABLE_ALIGN)
+
+/*!
+ *  \brief Padded ranging codes of every GPS PRN in each sample type
+ */
+typedef struct {
+  int8_t si8[GNSS_CA_NUM_PRN][GNSS_CA_CODE_STRIDE]
+      __attribute__((aligned(GNSS_CODE_TABLE_ALIGN)));
+  int16_t si16[GNSS_CA_NUM_PRN][GNSS_CA_CODE_STRIDE]
+      __attribute__((aligned(GNSS_CODE_TABLE_ALIGN)));
+  int32_t si32[GNSS_CA_NUM_PRN][GNSS_CA_CODE_STRIDE]
+      __attribute__((aligned(GNSS_CODE_TABLE_ALIGN)));
+  float fl32[GNSS_CA_NUM_PRN][GNSS_CA_CODE_STRIDE]
+      __attribute__((aligned(GNSS_CODE_TABLE_ALIGN)));
+} gnss_code_table_t;
+
+//! G2 delay in chips of PRN 1 to 32, IS-GPS-200 Table 3-Ia
+static const int16_t gnss_ca_g2_delay[GNSS_CA_NUM_PRN] = {
+    5,   6,   7,   8,   17,  18,  139, 140, 141, 251, 252,
+    254, 255, 256, 257, 258, 469, 470, 471, 472, 473, 474,
+    509, 512, 513, 514, 515, 516, 859, 860, 861, 862};
+
+/*!
+ *  \brief Generates the 1023 chips of a GPS L1 C/A code as +1/-1 values
+ *  \details Runs the G1 (x^10 + x^3 + 1) and G2 (x^10 + x^9 + x^8 + x^6 +
+ * x^3 + x^2 + 1) registers from the all ones state and combines G1 with G2
+ * delayed by the chips of the PRN. A one bit maps to +1, matching the codes
+ * stored in data/caCode.bin.
+ *  \param[out] chips Ranging code, GNSS_CA_CODE_LENGTH entries
+ *  \param[in] prn Satellite PRN, 1 to GNSS_CA_NUM_PRN
+ *  \returns EXIT_SUCCESS, or EXIT_FAILURE if the PRN is out of range
+ */
+static inline int gnss_ca_code_chips(int8_t *chips, const int prn) {
+  uint8_t g1[GNSS_CA_CODE_LENGTH], g2[GNSS_CA_CODE_LENGTH];
+  int r1[10], r2[10];
+
+  if (prn < 1 || prn > GNSS_CA_NUM_PRN) {
+    printf("PRN %d has no C/A code in the code table\n", prn);
+    return EXIT_FAILURE;
+  }
+
+  for (int s = 0; s < 10; s++) {
+    r1[s] = 1;
+    r2[s] = 1;
+  }
+
+  // Both registers output their last stage and shift towards it
+  for (int i = 0; i < GNSS_CA_CODE_LENGTH; i++) {
+    g1[i] = (uint8_t)r1[9];
+    g2[i] = (uint8_t)r2[9];
+    int f1 = r1[2] ^ r1[9];
+    int f2 = r2[1] ^ r2[2] ^ r2[5] ^ r2[7] ^ r2[8] ^ r2[9];
+    for (int s = 9; s > 0; s--) {
+      r1[s] = r1[s - 1];
+      r2[s] = r2[s - 1];
+    }
+    r1[0] = f1;
+    r2[0] = f2;
+  }
+
+  int delay = gnss_ca_g2_delay[prn - 1];
+  for (int i = 0; i < GNSS_CA_CODE_LENGTH; i++) {
+    int j = (i - delay + GNSS_CA_CODE_LENGTH) % GNSS_CA_CODE_LENGTH;
+    chips[i] = (g1[i] ^ g2[j]) ? 1 : -1;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+/*!
+ *  \brief Builds the padded codes of every GPS PRN
+ *  \details Called once at startup, the table is read only afterwards and
+ * may be shared by any number of channels and threads. The entries between
+ * GNSS_CA_CODE_PADDED and GNSS_CA_CODE_STRIDE are zero.
+ *  \param[out] table Code table to fill
+ */
+static inline void gnss_code_table_init(gnss_code_table_t *table) {
+  int8_t chips[GNSS_CA_CODE_LENGTH];
+
+  for (int p = 0; p < GNSS_CA_NUM_PRN; p++) {
+    gnss_ca_code_chips(chips, p + 1);
+    for (int i = 0; i < GNSS_CA_CODE_STRIDE; i++) {
+      int8_t c = 0;
+      if (i == 0) {
+        c = chips[GNSS_CA_CODE_LENGTH - 1];
+      } else if (i <= GNSS_CA_CODE_LENGTH) {
+        c = chips[i - 1];
+      } else if (i == GNSS_CA_CODE_LENGTH + 1) {
+        c = chips[0];
+      }
+      table->si8[p][i] = c;
+      table->si16[p][i] = c;
+      table->si32[p][i] = c;
+      table->fl32[p][i] = c;
+    }
+  }
+}
+
+/*!
+ *  \brief Checks that a PRN has a row in the code table
+ *  \param[in] prn Satellite PRN
+ *  \returns 1 if prn is 1 to GNSS_CA_NUM_PRN, 0 otherwise
+ */
+static inline int gnss_code_table_has_prn(const int prn) {
+  if (prn < 1 || prn > GNSS_CA_NUM_PRN) {
+    printf("PRN %d has no C/A code in the code table\n", prn);
+    return 0;
+  }
+  return 1;
+}
+
+/*!
+ *  \brief Padded si8 code of a PRN
+ *  \pre prn must be 1 to GNSS_CA_NUM_PRN
+ *  \param[in] table Code table built by gnss_code_table_init()
+ *  \param[in] prn Satellite PRN
+ *  \returns First entry of the padded code, or NULL if prn is out of range
+ */
+static inline const int8_t *gnss_code_table_si8(const gnss_code_table_t *table,
+                                                const int prn) {
+  if (!gnss_code_table_has_prn(prn)) {
+    return NULL;
+  }
+  return table->si8[prn - 1];
+}
+
+/*!
+ *  \brief Padded si16 code of a PRN
+ *  \pre prn must be 1 to GNSS_CA_NUM_PRN
+ *  \param[in] table Code table built by gnss_code_table_init()
+ *  \param[in] prn Satellite PRN
+ *  \returns First entry of the padded code, or NULL if prn is out of range
+ */
+static inline const int16_t *
+gnss_code_table_si16(const gnss_code_table_t *table, const int prn) {
+  if (!gnss_code_table_has_prn(prn)) {
+    return NULL;
+  }
+  return table->si16[prn - 1];
+}
+
+/*!
+ *  \brief Padded si32 code of a PRN
+ *  \pre prn must be 1 to GNSS_CA_NUM_PRN
+ *  \param[in] table Code table built by gnss_code_table_init()
+ *  \param[in] prn Satellite PRN
+ *  \returns First entry of the padded code, or NULL if prn is out of range
+ */
+static inline const int32_t *
+gnss_code_table_si32(const gnss_code_table_t *table, const int prn) {
+  if (!gnss_code_table_has_prn(prn)) {
+    return NULL;
+  }
+  return table->si32[prn - 1];
+}
+
+/*!
+ *  \brief Padded fl32 code of a PRN
+ *  \pre prn must be 1 to GNSS_CA_NUM_PRN
+ *  \param[in] table Code table built by gnss_code_table_init()
+ *  \param[in] prn Satellite PRN
+ *  \returns First entry of the padded code, or NULL if prn is out of range
+ */
+static inline const float *gnss_code_table_fl32(const gnss_code_table_t *table,
+                                                const int prn) {
+  if (!gnss_code_table_has_prn(prn)) {
+    return NULL;
+  }
+  return table->fl32[prn - 1];
+}
+
+#endif /* CODE_TABLE_H */
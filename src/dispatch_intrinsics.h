@@ -0,0 +1,489 @@
+/*!
+ *  \file dispatch_intrinsics.h
+ *  \brief      Selects the best kernel implementation for the running CPU
+ *  \details    Compiles the AVX2 and AVX512 kernels with per-function target
+ * options next to the portable nom_intrinsics.h versions, so a single binary
+ * built without any -m flags runs on every x86-64 machine. gnss_dispatch_init()
+ * queries cpuid once and binds the function pointers of gnss_kernels_t to the
+ * widest instruction set supported by both the CPU and the OS. Setting the
+ * GNSS_KERNELS environment variable to "nom", "avx2" or "avx512" forces a
+ * given implementation, provided the CPU supports it. Kernels that need an
+ * extension beyond the level of a table, such as the AVX512-VPOPCNTDQ packed
+ * sign correlator or the AVX512-VNNI and AVX-VNNI dot products, replace their
+ * entry of the selected table when the CPU has it.
+ *  \author    Damian Miralles
+ *  \author    Jake Johnson
+ *  \version   4.1a
+ *  \date      Jan 23, 2018
+ *  \pre       Make sure you have .bin files containing data and lookup tables
+ *  \pre       Link with -pthread.
+ */
+
+#ifndef DISPATCH_INTRINSICS_H
+#define DISPATCH_INTRINSICS_H
+
+#include "nom_intrinsics.h"
+#include <cpuid.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#include "avx2_intrinsics.h"
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx2,avx512f,avx512dq,avx512bw")
+#include "avx512_intrinsics.h"
+#pragma GCC pop_options
+
+/*!
+ *  \brief Instruction sets a kernel table can be bound to
+ */
+typedef enum {
+  GNSS_ISA_NOM = 0, /*!< Portable C */
+  GNSS_ISA_AVX2,    /*!< AVX2 */
+  GNSS_ISA_AVX512   /*!< AVX512F, AVX512DQ and AVX512BW */
+} gnss_isa_t;
+
+/*!
+ *  \brief Extensions whose kernels replace entries of a kernel table
+ */
+typedef enum {
+  GNSS_EXT_VPOPCNTDQ = 1 << 0,  /*!< AVX512-VPOPCNTDQ */
+  GNSS_EXT_AVX512VNNI = 1 << 1, /*!< AVX512-VNNI */
+  GNSS_EXT_AVXVNNI = 1 << 2     /*!< VEX encoded AVX-VNNI */
+} gnss_ext_t;
+
+/*!
+ *  \brief Function pointers to the kernels of a given instruction set
+ */
+typedef struct {
+  gnss_isa_t isa;   /*!< Instruction set of the bound kernels */
+  const char *name; /*!< Printable name of the instruction set */
+
+  void (*nco_si32)(int32_t *sig_nco, const int32_t *lut,
+                   const int32_t blk_size, const double rem_carr_phase,
+                   const double carr_freq, const double samp_freq);
+  void (*nco_fl32)(float *sig_nco, const float *lut, const int32_t blk_size,
+                   const double rem_carr_phase, const double carr_freq,
+                   const double samp_freq);
+  void (*nco_rot_fl32)(float *sig_nco, const float *lut, const int32_t blk_size,
+                       const double rem_carr_phase, const double carr_freq,
+                       const double samp_freq);
+  void (*nco_state_si32)(int32_t *sig_nco, const int32_t *lut,
+                         const int32_t blk_size, gnss_nco_t *nco);
+  void (*nco_state_fl32)(float *sig_nco, const float *lut,
+                         const int32_t blk_size, gnss_nco_t *nco);
+  void (*nco_iq_si32)(int32_t *sig_sin, int32_t *sig_cos,
+                      const int32_t *sincos_lut, const int32_t blk_size,
+                      gnss_nco_t *nco);
+  void (*nco_iq_fl32)(float *sig_sin, float *sig_cos, const float *sincos_lut,
+                      const int32_t blk_size, gnss_nco_t *nco);
+  void (*nco_perm_si32)(int32_t *sig_nco, const int32_t *lut,
+                        const int32_t lut_bits, const int32_t blk_size,
+                        gnss_nco_t *nco);
+  void (*nco_perm_fl32)(float *sig_nco, const float *lut,
+                        const int32_t lut_bits, const int32_t blk_size,
+                        gnss_nco_t *nco);
+  void (*nco_poly_fl32)(float *sig_sin, float *sig_cos, const float amplitude,
+                        const int32_t blk_size, gnss_nco_t *nco);
+  void (*nco_si16)(int16_t *sig_nco, const int32_t *lut,
+                   const int32_t blk_size, const double rem_carr_phase,
+                   const double carr_freq, const double samp_freq);
+  void (*nco_si8)(int8_t *sig_nco, const int32_t *lut, const int32_t blk_size,
+                  const double rem_carr_phase, const double carr_freq,
+                  const double samp_freq);
+  void (*nco_rate_si32)(int32_t *sig_nco, const int32_t *lut,
+                        const int32_t blk_size, gnss_nco_rate_t *nco);
+
+  void (*code_si32)(int32_t *ecode, int32_t *pcode, int32_t *lcode,
+                    const int32_t *cacode, const int32_t blk_size,
+                    const float rem_code_phase, const float code_freq,
+                    const float samp_freq);
+  void (*code_fl32)(float *ecode, float *pcode, float *lcode,
+                    const float *cacode, const int32_t blk_size,
+                    const float rem_code_phase, const float code_freq,
+                    const float samp_freq);
+  void (*code_si16)(int16_t *ecode, int16_t *pcode, int16_t *lcode,
+                    const int32_t *cacode, const int32_t blk_size,
+                    const float rem_code_phase, const float code_freq,
+                    const float samp_freq);
+  void (*code_si8)(int8_t *ecode, int8_t *pcode, int8_t *lcode,
+                   const int32_t *cacode, const int32_t blk_size,
+                   const float rem_code_phase, const float code_freq,
+                   const float samp_freq);
+  void (*code_state_si32)(int32_t *ecode, int32_t *pcode, int32_t *lcode,
+                          const int32_t *cacode, const int32_t blk_size,
+                          gnss_code_nco_t *nco);
+  void (*code_state_fl32)(float *ecode, float *pcode, float *lcode,
+                          const float *cacode, const int32_t blk_size,
+                          gnss_code_nco_t *nco);
+  void (*code_rate_si32)(int32_t *ecode, int32_t *pcode, int32_t *lcode,
+                         const int32_t *cacode, const int32_t blk_size,
+                         gnss_code_nco_t *nco, const double code_rate);
+  void (*code_window_si32)(int32_t *code, const int32_t *cacode,
+                           const int32_t blk_size, const int32_t spacing,
+                           gnss_code_nco_t *nco);
+  void (*code_window_fl32)(float *code, const float *cacode,
+                           const int32_t blk_size, const int32_t spacing,
+                           gnss_code_nco_t *nco);
+
+  double (*mul_and_acc_si32)(const int32_t *aVector, const int32_t *bVector,
+                             uint32_t num_points);
+  float (*mul_and_acc_fl32)(const float *aVector, const float *bVector,
+                            uint32_t num_points);
+  double (*mul_and_acc_si16)(const int16_t *aVector, const int16_t *bVector,
+                             uint32_t num_points);
+  double (*mul_and_acc_si8)(const int8_t *aVector, const int8_t *bVector,
+                            uint32_t num_points);
+
+  void (*correlate_epl_si32)(double *i_e, double *i_p, double *i_l,
+                             double *q_e, double *q_p, double *q_l,
+                             const int32_t *ecode, const int32_t *pcode,
+                             const int32_t *lcode, const int32_t *sig_sin,
+                             const int32_t *sig_cos, uint32_t num_points);
+  void (*correlate_epl_fl32)(double *i_e, double *i_p, double *i_l,
+                             double *q_e, double *q_p, double *q_l,
+                             const float *ecode, const float *pcode,
+                             const float *lcode, const float *sig_sin,
+                             const float *sig_cos, uint32_t num_points);
+
+  void (*correlate_ntap_si32)(double *i_taps, double *q_taps,
+                              const int32_t *sig_sin, const int32_t *sig_cos,
+                              const int32_t *cacode, const float *tap_offsets,
+                              const int32_t num_taps, const int32_t blk_size,
+                              const float rem_code_phase,
+                              const float code_freq, const float samp_freq);
+  void (*correlate_ntap_fl32)(double *i_taps, double *q_taps,
+                              const float *sig_sin, const float *sig_cos,
+                              const float *cacode, const float *tap_offsets,
+                              const int32_t num_taps, const int32_t blk_size,
+                              const float rem_code_phase,
+                              const float code_freq, const float samp_freq);
+
+  void (*fused_epl_si32)(double *i_e, double *i_p, double *i_l, double *q_e,
+                         double *q_p, double *q_l, const int8_t *signal,
+                         const int32_t *sin_lut, const int32_t *cos_lut,
+                         const int32_t *cacode, const int32_t blk_size,
+                         const double rem_carr_phase, const double carr_freq,
+                         const double rem_code_phase, const double code_freq,
+                         const double samp_freq);
+  void (*fused_epl_fl32)(double *i_e, double *i_p, double *i_l, double *q_e,
+                         double *q_p, double *q_l, const int8_t *signal,
+                         const float *sin_lut, const float *cos_lut,
+                         const float *cacode, const int32_t blk_size,
+                         const double rem_carr_phase, const double carr_freq,
+                         const double rem_code_phase, const double code_freq,
+                         const double samp_freq);
+
+  void (*mix_iq8_si32)(int32_t *sig_sin, int32_t *sig_cos, const int8_t *signal,
+                       const int32_t *sin_nco, const int32_t *cos_nco,
+                       const int32_t blk_size);
+  void (*mix_iq16_si32)(int32_t *sig_sin, int32_t *sig_cos,
+                        const int16_t *signal, const int32_t *sin_nco,
+                        const int32_t *cos_nco, const int32_t blk_size);
+  void (*fused_epl_iq8_si32)(double *i_e, double *i_p, double *i_l,
+                             double *q_e, double *q_p, double *q_l,
+                             const int8_t *signal, const int32_t *sin_lut,
+                             const int32_t *cos_lut, const int32_t *cacode,
+                             const int32_t blk_size,
+                             const double rem_carr_phase,
+                             const double carr_freq,
+                             const double rem_code_phase,
+                             const double code_freq, const double samp_freq);
+
+  void (*unpack_2bit_si8)(int8_t *samples, const uint8_t *packed,
+                          const int32_t num_bytes);
+  void (*unpack_4bit_si8)(int8_t *samples, const uint8_t *packed,
+                          const int32_t num_bytes);
+
+  void (*pack_sign_si8)(uint64_t *bits, const int8_t *samples,
+                        const int32_t num_points);
+  void (*pack_sign_si32)(uint64_t *bits, const int32_t *samples,
+                         const int32_t num_points);
+  int32_t (*xor_and_acc_b1)(const uint64_t *a_bits, const uint64_t *b_bits,
+                            const int32_t num_points);
+} gnss_kernels_t;
+
+//! Portable kernels, always available
+static const gnss_kernels_t gnss_kernels_nom = {
+    .isa = GNSS_ISA_NOM,
+    .name = "nom",
+    .nco_si32 = nom_nco_si32,
+    .nco_fl32 = nom_nco_fl32,
+    .nco_rot_fl32 = nom_nco_rot_fl32,
+    .nco_state_si32 = nom_nco_state_si32,
+    .nco_state_fl32 = nom_nco_state_fl32,
+    .nco_iq_si32 = nom_nco_iq_si32,
+    .nco_iq_fl32 = nom_nco_iq_fl32,
+    .nco_perm_si32 = nom_nco_perm_si32,
+    .nco_perm_fl32 = nom_nco_perm_fl32,
+    .nco_poly_fl32 = nom_nco_poly_fl32,
+    .nco_si16 = nom_nco_si16,
+    .nco_si8 = nom_nco_si8,
+    .nco_rate_si32 = nom_nco_rate_si32,
+    .code_si32 = nom_code_si32,
+    .code_fl32 = nom_code_fl32,
+    .code_si16 = nom_code_si16,
+    .code_si8 = nom_code_si8,
+    .code_state_si32 = nom_code_state_si32,
+    .code_state_fl32 = nom_code_state_fl32,
+    .code_rate_si32 = nom_code_rate_si32,
+    .code_window_si32 = nom_code_window_si32,
+    .code_window_fl32 = nom_code_window_fl32,
+    .mul_and_acc_si32 = nom_mul_and_acc_si32,
+    .mul_and_acc_fl32 = nom_mul_and_acc_fl32,
+    .mul_and_acc_si16 = nom_mul_and_acc_si16,
+    .mul_and_acc_si8 = nom_mul_and_acc_si8,
+    .correlate_epl_si32 = nom_correlate_epl_si32,
+    .correlate_epl_fl32 = nom_correlate_epl_fl32,
+    .correlate_ntap_si32 = nom_correlate_ntap_si32,
+    .correlate_ntap_fl32 = nom_correlate_ntap_fl32,
+    .fused_epl_si32 = nom_fused_epl_si32,
+    .fused_epl_fl32 = nom_fused_epl_fl32,
+    .mix_iq8_si32 = nom_mix_iq8_si32,
+    .mix_iq16_si32 = nom_mix_iq16_si32,
+    .fused_epl_iq8_si32 = nom_fused_epl_iq8_si32,
+    .unpack_2bit_si8 = nom_unpack_2bit_si8,
+    .unpack_4bit_si8 = nom_unpack_4bit_si8,
+    .pack_sign_si8 = nom_pack_sign_si8,
+    .pack_sign_si32 = nom_pack_sign_si32,
+    .xor_and_acc_b1 = nom_xor_and_acc_b1,
+};
+
+//! AVX2 kernels
+static const gnss_kernels_t gnss_kernels_avx2 = {
+    .isa = GNSS_ISA_AVX2,
+    .name = "avx2",
+    .nco_si32 = avx2_nco_si32,
+    .nco_fl32 = avx2_nco_fl32,
+    .nco_rot_fl32 = avx2_nco_rot_fl32,
+    .nco_state_si32 = avx2_nco_state_si32,
+    .nco_state_fl32 = avx2_nco_state_fl32,
+    .nco_iq_si32 = avx2_nco_iq_si32,
+    .nco_iq_fl32 = avx2_nco_iq_fl32,
+    .nco_perm_si32 = avx2_nco_perm_si32,
+    .nco_perm_fl32 = avx2_nco_perm_fl32,
+    .nco_poly_fl32 = avx2_nco_poly_fl32,
+    .nco_si16 = avx2_nco_si16,
+    .nco_si8 = avx2_nco_si8,
+    .nco_rate_si32 = avx2_nco_rate_si32,
+    .code_si32 = avx2_code_si32,
+    .code_fl32 = avx2_code_fl32,
+    .code_si16 = avx2_code_si16,
+    .code_si8 = avx2_code_si8,
+    .code_state_si32 = avx2_code_state_si32,
+    .code_state_fl32 = avx2_code_state_fl32,
+    .code_rate_si32 = avx2_code_rate_si32,
+    .code_window_si32 = avx2_code_window_si32,
+    .code_window_fl32 = avx2_code_window_fl32,
+    .mul_and_acc_si32 = avx2_mul_and_acc_si32,
+    .mul_and_acc_fl32 = avx2_mul_and_acc_fl32,
+    // Replaced by the VNNI kernels in gnss_dispatch_init() when available
+    .mul_and_acc_si16 = avx2_mul_and_acc_si16,
+    .mul_and_acc_si8 = avx2_mul_and_acc_si8,
+    .correlate_epl_si32 = avx2_correlate_epl_si32,
+    .correlate_epl_fl32 = avx2_correlate_epl_fl32,
+    .correlate_ntap_si32 = avx2_correlate_ntap_si32,
+    .correlate_ntap_fl32 = avx2_correlate_ntap_fl32,
+    .fused_epl_si32 = avx2_fused_epl_si32,
+    .fused_epl_fl32 = avx2_fused_epl_fl32,
+    .mix_iq8_si32 = avx2_mix_iq8_si32,
+    .mix_iq16_si32 = avx2_mix_iq16_si32,
+    .fused_epl_iq8_si32 = avx2_fused_epl_iq8_si32,
+    .unpack_2bit_si8 = avx2_unpack_2bit_si8,
+    .unpack_4bit_si8 = avx2_unpack_4bit_si8,
+    .pack_sign_si8 = avx2_pack_sign_si8,
+    .pack_sign_si32 = avx2_pack_sign_si32,
+    .xor_and_acc_b1 = avx2_xor_and_acc_b1,
+};
+
+//! AVX512 kernels
+static const gnss_kernels_t gnss_kernels_avx512 = {
+    .isa = GNSS_ISA_AVX512,
+    .name = "avx512",
+    .nco_si32 = avx512_nco_si32,
+    .nco_fl32 = avx512_nco_fl32,
+    .nco_rot_fl32 = avx512_nco_rot_fl32,
+    .nco_state_si32 = avx512_nco_state_si32,
+    .nco_state_fl32 = avx512_nco_state_fl32,
+    .nco_iq_si32 = avx512_nco_iq_si32,
+    .nco_iq_fl32 = avx512_nco_iq_fl32,
+    .nco_perm_si32 = avx512_nco_perm_si32,
+    .nco_perm_fl32 = avx512_nco_perm_fl32,
+    .nco_poly_fl32 = avx512_nco_poly_fl32,
+    .nco_si16 = avx512_nco_si16,
+    .nco_si8 = avx512_nco_si8,
+    .nco_rate_si32 = avx512_nco_rate_si32,
+    .code_si32 = avx512_code_si32,
+    .code_fl32 = avx512_code_fl32,
+    .code_si16 = avx512_code_si16,
+    .code_si8 = avx512_code_si8,
+    .code_state_si32 = avx512_code_state_si32,
+    .code_state_fl32 = avx512_code_state_fl32,
+    .code_rate_si32 = avx512_code_rate_si32,
+    .code_window_si32 = avx512_code_window_si32,
+    .code_window_fl32 = avx512_code_window_fl32,
+    .mul_and_acc_si32 = avx512_mul_and_acc_si32,
+    .mul_and_acc_fl32 = avx512_mul_and_acc_fl32,
+    // Replaced by the VNNI kernels in gnss_dispatch_init() when available
+    .mul_and_acc_si16 = avx512_mul_and_acc_si16,
+    .mul_and_acc_si8 = avx512_mul_and_acc_si8,
+    .correlate_epl_si32 = avx512_correlate_epl_si32,
+    .correlate_epl_fl32 = avx512_correlate_epl_fl32,
+    .correlate_ntap_si32 = avx512_correlate_ntap_si32,
+    .correlate_ntap_fl32 = avx512_correlate_ntap_fl32,
+    .fused_epl_si32 = avx512_fused_epl_si32,
+    .fused_epl_fl32 = avx512_fused_epl_fl32,
+    .mix_iq8_si32 = avx512_mix_iq8_si32,
+    .mix_iq16_si32 = avx512_mix_iq16_si32,
+    .fused_epl_iq8_si32 = avx512_fused_epl_iq8_si32,
+    .unpack_2bit_si8 = avx512_unpack_2bit_si8,
+    .unpack_4bit_si8 = avx512_unpack_4bit_si8,
+    .pack_sign_si8 = avx512_pack_sign_si8,
+    .pack_sign_si32 = avx512_pack_sign_si32,
+    .xor_and_acc_b1 = avx512_xor_and_acc_b1,
+};
+
+/*!
+ *  \brief Finds the widest instruction set supported by the CPU and the OS
+ *  \details AVX registers are only usable once the OS saves them on context
+ * switches, which is checked through OSXSAVE and XCR0 on top of the cpuid
+ * feature bits. The AVX2 level also requires FMA, used by the polynomial
+ * NCO and present on every AVX2 CPU.
+ *  \return Widest supported instruction set
+ */
+static inline gnss_isa_t gnss_cpu_isa(void) {
+
+  uint32_t eax, ebx, ecx, edx;
+  uint32_t xcr0_lo, xcr0_hi;
+  int os_avx, os_avx512;
+
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & bit_OSXSAVE) ||
+      !(ecx & bit_AVX) || !(ecx & bit_FMA)) {
+    return GNSS_ISA_NOM;
+  }
+
+  // Read XCR0 to find which register states the OS saves
+  __asm__ volatile("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+  os_avx = (xcr0_lo & 0x06) == 0x06;
+  os_avx512 = (xcr0_lo & 0xE6) == 0xE6;
+
+  if (!os_avx || !__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) ||
+      !(ebx & bit_AVX2)) {
+    return GNSS_ISA_NOM;
+  }
+  if (os_avx512 && (ebx & bit_AVX512F) && (ebx & bit_AVX512DQ) &&
+      (ebx & bit_AVX512BW)) {
+    return GNSS_ISA_AVX512;
+  }
+  return GNSS_ISA_AVX2;
+}
+
+/*!
+ *  \brief Finds the extensions beyond the base level of the kernel tables
+ *  \details Only meaningful on top of the level they extend, which
+ * gnss_cpu_isa() has already checked for OS support.
+ *  \return Bitwise OR of the supported gnss_ext_t
+ */
+static inline uint32_t gnss_cpu_ext(void) {
+
+  uint32_t eax, ebx, ecx, edx;
+  uint32_t ext = 0;
+
+  if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+    if (ecx & bit_AVX512VPOPCNTDQ) {
+      ext |= GNSS_EXT_VPOPCNTDQ;
+    }
+    if (ecx & bit_AVX512VNNI) {
+      ext |= GNSS_EXT_AVX512VNNI;
+    }
+  }
+  if (__get_cpuid_count(7, 1, &eax, &ebx, &ecx, &edx) && (eax & bit_AVXVNNI)) {
+    ext |= GNSS_EXT_AVXVNNI;
+  }
+  return ext;
+}
+
+/*!
+ *  \brief Storage of the kernel table bound by gnss_dispatch_init()
+ *  \return Kernel table, only written by gnss_dispatch_select()
+ */
+static inline gnss_kernels_t *gnss_dispatch_table(void) {
+
+  static gnss_kernels_t table;
+  return &table;
+}
+
+/*!
+ *  \brief Selects the best kernel table for the CPU
+ *  \details Runs once under gnss_dispatch_init(). The table is completed in a
+ * local copy, extensions included, and only then published.
+ */
+static inline void gnss_dispatch_select(void) {
+
+  gnss_kernels_t selected;
+  gnss_isa_t isa;
+  uint32_t ext;
+  const char *env;
+
+  isa = gnss_cpu_isa();
+  env = getenv("GNSS_KERNELS");
+  if (env != NULL) {
+    if (strcmp(env, "nom") == 0) {
+      isa = GNSS_ISA_NOM;
+    } else if (strcmp(env, "avx2") == 0 && isa >= GNSS_ISA_AVX2) {
+      isa = GNSS_ISA_AVX2;
+    } else if (strcmp(env, "avx512") != 0 || isa < GNSS_ISA_AVX512) {
+      fprintf(stderr, "GNSS_KERNELS=%s not supported, using default\n", env);
+    }
+  }
+
+  switch (isa) {
+  case GNSS_ISA_AVX512:
+    selected = gnss_kernels_avx512;
+    break;
+  case GNSS_ISA_AVX2:
+    selected = gnss_kernels_avx2;
+    break;
+  default:
+    selected = gnss_kernels_nom;
+    break;
+  }
+
+  // Kernels needing an extension on top of the level of the table
+  ext = gnss_cpu_ext();
+  if (isa == GNSS_ISA_AVX512 && (ext & GNSS_EXT_VPOPCNTDQ)) {
+    selected.xor_and_acc_b1 = avx512_xor_and_acc_b1_vpopcnt;
+  }
+  if (isa == GNSS_ISA_AVX512 && (ext & GNSS_EXT_AVX512VNNI)) {
+    selected.mul_and_acc_si16 = avx512_mul_and_acc_si16_vnni;
+    selected.mul_and_acc_si8 = avx512_mul_and_acc_si8_vnni;
+  } else if (isa >= GNSS_ISA_AVX2 && (ext & GNSS_EXT_AVXVNNI)) {
+    selected.mul_and_acc_si16 = avx2_mul_and_acc_si16_vnni;
+    selected.mul_and_acc_si8 = avx2_mul_and_acc_si8_vnni;
+  }
+  *gnss_dispatch_table() = selected;
+}
+
+/*!
+ *  \brief Binds the kernel table to the best implementation for the CPU
+ *  \details The table is selected on the first call and reused afterwards.
+ * The selection runs under pthread_once(), so threads may race on the first
+ * call and all of them get the complete table. GNSS_KERNELS may lower the
+ * selection but never raise it above what the CPU supports.
+ *  \return Kernel table to use for the rest of the run
+ */
+static inline const gnss_kernels_t *gnss_dispatch_init(void) {
+
+  static pthread_once_t once = PTHREAD_ONCE_INIT;
+
+  pthread_once(&once, gnss_dispatch_select);
+  return gnss_dispatch_table();
+}
+
+#endif /* DISPATCH_INTRINSICS_H */
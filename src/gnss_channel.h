@@ -0,0 +1,326 @@
+/*!
+ *  \file gnss_channel.h
+ *  \brief      Per-channel tracking state and loop update of a GNSS receiver
+ *  \details    Collects the loop state that the standalone drivers keep as
+ * locals in main() (code and carrier NCOs, DLL/PLL filters and VSM C/No
+ * estimator) so that any number of channels can be tracked over the same
+ * sample stream. Correlation is performed with the fused_epl_si32 kernel
+ * bound by gnss_dispatch_init(), or with fused_epl_iq8_si32 for complex
+ * baseband recordings. The carrier phase is carried from one code period to
+ * the next in a gnss_nco_t accumulator, so it never drifts from the phase the
+ * kernels generate.
+ *  \author    Damian Miralles
+ *  \author    Jake Johnson
+ *  \version   4.1a
+ *  \date      Jan 23, 2018
+ *  \pre       Make sure you have .bin files containing data and lookup tables.
+ */
+
+#ifndef GNSS_CHANNEL_H
+#define GNSS_CHANNEL_H
+
+#include "dispatch_intrinsics.h"
+#include "nco_state.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+//! Value of pi used by the loop updates, matches the standalone drivers
+#define GNSS_CHANNEL_PI 3.1415926535
+
+/*!
+ *  \brief Tracking parameters shared by every channel of a receiver
+ */
+typedef struct {
+  double samp_freq;              /*!< Sampling frequency of the signal */
+  double code_length;            /*!< Number of chips in one code period */
+  double code_freq_basis;        /*!< Nominal code frequency */
+  double carr_freq_basis;        /*!< Nominal carrier frequency */
+  double tau1carr;               /*!< PLL loop filter time constant 1 */
+  double tau2carr;               /*!< PLL loop filter time constant 2 */
+  double pdi_carr;               /*!< PLL predetection integration interval */
+  double tau1code;               /*!< DLL loop filter time constant 1 */
+  double tau2code;               /*!< DLL loop filter time constant 2 */
+  double pdi_code;               /*!< DLL predetection integration interval */
+  double acc_int;                /*!< Accumulation interval used by the VSM */
+  int32_t data_adapt_coeff;      /*!< 1 for real, 2 for interleaved I/Q data */
+  int32_t vsm_interval;          /*!< Code periods per C/No estimate */
+  long int code_periods;         /*!< Code periods to track, 0 for no limit */
+  const int32_t *sin_lut;        /*!< 256 entries sine lookup table */
+  const int32_t *cos_lut;        /*!< 256 entries cosine lookup table */
+  const gnss_kernels_t *kernels; /*!< Kernels from gnss_dispatch_init() */
+} gnss_channel_config_t;
+
+/*!
+ *  \brief Tracking results logged by a channel, one entry per code period
+ */
+typedef struct {
+  long int size;           /*!< Number of code periods in each array */
+  double *carr_freq;       /*!< Carrier frequency */
+  double *code_freq;       /*!< Code frequency */
+  double *absolute_sample; /*!< Absolute sample of the code start */
+  double *code_error;      /*!< DLL discriminator output */
+  double *code_nco;        /*!< DLL filtered discriminator output */
+  double *carr_error;      /*!< PLL discriminator output */
+  double *carr_nco;        /*!< PLL filtered discriminator output */
+  double *i_e, *i_p, *i_l; /*!< In-phase correlator outputs */
+  double *q_e, *q_p, *q_l; /*!< Quadrature correlator outputs */
+  double *vsm_index;       /*!< Code period of each C/No estimate */
+  double *vsm_value;       /*!< VSM C/No estimate in dB-Hz */
+} gnss_track_results_t;
+
+/*!
+ *  \brief State of a single tracking channel
+ */
+typedef struct {
+  const gnss_channel_config_t *cfg; /*!< Shared tracking parameters */
+  const int32_t *ca_code;           /*!< Padded ranging code of the channel */
+  gnss_track_results_t *results;    /*!< Optional results log, may be NULL */
+
+  // Code and carrier NCOs
+  double carr_freq, code_freq;
+  double rem_code_phase;
+  gnss_nco_t carr_phase; /*!< Carrier phase accumulator, kept across blocks */
+
+  // Loop filters
+  double carr_nco, old_carr_nco, carr_error, old_carr_error;
+  double code_nco, old_code_nco, code_error, old_code_error;
+
+  // VSM C/No estimator
+  int32_t vsm_count;
+  double pwr_sum, pwr_sqr_sum, cno;
+
+  // Latest correlator outputs
+  double i_e, i_p, i_l, q_e, q_p, q_l;
+
+  // Sample bookkeeping
+  int64_t sample_pos;  /*!< Absolute index of the next sample to correlate */
+  long int loop_count; /*!< Number of code periods tracked so far */
+} gnss_channel_t;
+
+/*!
+ *  \brief Initializes a tracking channel
+ *  \param[out] ch Channel to initialize
+ *  \param[in] cfg Tracking parameters shared by all channels
+ *  \param[in] ca_code Padded ranging code of the satellite to track
+ *  \param[in] carr_freq Initial carrier frequency
+ *  \param[in] code_freq Initial code frequency
+ *  \param[in] rem_code_phase Initial code phase remainder
+ *  \param[in] rem_carr_phase Initial carrier phase remainder
+ *  \param[in] start_sample Absolute index of the first sample to correlate
+ *  \param[in] results Results log, or NULL if results are not needed
+ */
+void gnss_channel_init(gnss_channel_t *ch, const gnss_channel_config_t *cfg,
+                       const int32_t *ca_code, const double carr_freq,
+                       const double code_freq, const double rem_code_phase,
+                       const double rem_carr_phase, const int64_t start_sample,
+                       gnss_track_results_t *results) {
+
+  *ch = (gnss_channel_t){0};
+  ch->cfg = cfg;
+  ch->ca_code = ca_code;
+  ch->results = results;
+  ch->carr_freq = carr_freq;
+  ch->code_freq = code_freq;
+  ch->rem_code_phase = rem_code_phase;
+  gnss_nco_init(&ch->carr_phase, rem_carr_phase, carr_freq, cfg->samp_freq);
+  ch->sample_pos = start_sample;
+}
+
+/*!
+ *  \brief Number of samples needed by the next code period of a channel
+ *  \param[in] ch Channel
+ *  \return Block size of the next code period, 0 if the channel is done
+ */
+static inline int32_t gnss_channel_blksize(const gnss_channel_t *ch) {
+
+  const double codePhaseStep = ch->code_freq / ch->cfg->samp_freq;
+
+  if (ch->cfg->code_periods > 0 && ch->loop_count >= ch->cfg->code_periods) {
+    return 0;
+  }
+  return (int32_t)ceil((ch->cfg->code_length - ch->rem_code_phase) /
+                       codePhaseStep);
+}
+
+/*!
+ *  \brief Tracks one code period: correlates the samples and closes the DLL,
+ * PLL and C/No loops
+ *  \param[in,out] ch Channel
+ *  \param[in] signal Raw signal samples starting at ch->sample_pos, with
+ * cfg->data_adapt_coeff int8_t values per sample
+ *  \param[in] blk_size Number of samples, as given by gnss_channel_blksize()
+ */
+void gnss_channel_track(gnss_channel_t *ch, const int8_t *signal,
+                        const int32_t blk_size) {
+
+  const gnss_channel_config_t *cfg = ch->cfg;
+  gnss_track_results_t *res = ch->results;
+  const double codePhaseStep = ch->code_freq / cfg->samp_freq;
+  const double pi = GNSS_CHANNEL_PI;
+  const double remCarrPhase = gnss_nco_phase(&ch->carr_phase);
+  double pwr, pwrMean, pwrVar, pwrAvgSqr, pwrAvg, noiseVar;
+  double eAmp, lAmp;
+  long int k = ch->loop_count;
+
+  // Carrier wipeoff, code generation and correlation in a single pass
+  if (cfg->data_adapt_coeff == 2) {
+    cfg->kernels->fused_epl_iq8_si32(&ch->i_e, &ch->i_p, &ch->i_l, &ch->q_e,
+                                     &ch->q_p, &ch->q_l, signal, cfg->sin_lut,
+                                     cfg->cos_lut, ch->ca_code, blk_size,
+                                     remCarrPhase, ch->carr_freq,
+                                     ch->rem_code_phase, ch->code_freq,
+                                     cfg->samp_freq);
+  } else {
+    cfg->kernels->fused_epl_si32(&ch->i_e, &ch->i_p, &ch->i_l, &ch->q_e,
+                                 &ch->q_p, &ch->q_l, signal, cfg->sin_lut,
+                                 cfg->cos_lut, ch->ca_code, blk_size,
+                                 remCarrPhase, ch->carr_freq,
+                                 ch->rem_code_phase, ch->code_freq,
+                                 cfg->samp_freq);
+  }
+
+  // Compute the VSM C/No
+  pwr = ch->i_p * ch->i_p + ch->q_p * ch->q_p;
+  ch->pwr_sum += pwr;
+  ch->pwr_sqr_sum += pwr * pwr;
+  ch->vsm_count++;
+
+  if (ch->vsm_count == cfg->vsm_interval) {
+    pwrMean = ch->pwr_sum / cfg->vsm_interval;
+    pwrVar = ch->pwr_sqr_sum / cfg->vsm_interval - pwrMean * pwrMean;
+    pwrAvgSqr = pwrMean * pwrMean - pwrVar;
+    pwrAvgSqr = (pwrAvgSqr > 0) ? pwrAvgSqr : -pwrAvgSqr;
+    pwrAvg = sqrt(pwrAvgSqr);
+    noiseVar = 0.5 * (pwrMean - pwrAvg);
+    ch->cno = (pwrAvg / cfg->acc_int) / (2 * noiseVar);
+    ch->cno = (ch->cno > 0) ? ch->cno : -ch->cno;
+    ch->cno = 10 * log10(ch->cno);
+
+    if (res != NULL && k / cfg->vsm_interval < res->size / cfg->vsm_interval) {
+      res->vsm_index[k / cfg->vsm_interval] = k + 1;
+      res->vsm_value[k / cfg->vsm_interval] = ch->cno;
+    }
+
+    ch->vsm_count = 0;
+    ch->pwr_sum = 0;
+    ch->pwr_sqr_sum = 0;
+  }
+
+  // Advance the code and carrier NCOs to the end of the block
+  ch->rem_code_phase =
+      ch->rem_code_phase + blk_size * codePhaseStep - cfg->code_length;
+  gnss_nco_advance(&ch->carr_phase, blk_size);
+  ch->sample_pos += blk_size;
+
+  // Implement carrier loop discriminator (phase detector)
+  ch->carr_error = atan(ch->q_p / ch->i_p) / (2.0 * pi);
+
+  // Implement carrier loop filter and generate NCO command
+  ch->carr_nco = ch->old_carr_nco +
+                 (cfg->tau2carr / cfg->tau1carr) *
+                     (ch->carr_error - ch->old_carr_error) +
+                 ch->carr_error * (cfg->pdi_carr / cfg->tau1carr);
+  ch->old_carr_nco = ch->carr_nco;
+  ch->old_carr_error = ch->carr_error;
+
+  // Modify carrier freq based on NCO command
+  ch->carr_freq = cfg->carr_freq_basis + ch->carr_nco;
+  gnss_nco_set_freq(&ch->carr_phase, ch->carr_freq, cfg->samp_freq);
+
+  // Find DLL error and update code NCO
+  eAmp = sqrt(ch->i_e * ch->i_e + ch->q_e * ch->q_e);
+  lAmp = sqrt(ch->i_l * ch->i_l + ch->q_l * ch->q_l);
+  ch->code_error = (eAmp - lAmp) / (eAmp + lAmp);
+
+  // Implement code loop filter and generate NCO command
+  ch->code_nco = ch->old_code_nco +
+                 (cfg->tau2code / cfg->tau1code) *
+                     (ch->code_error - ch->old_code_error) +
+                 ch->code_error * (cfg->pdi_code / cfg->tau1code);
+  ch->old_code_nco = ch->code_nco;
+  ch->old_code_error = ch->code_error;
+
+  // Modify code freq based on NCO command
+  ch->code_freq = cfg->code_freq_basis - ch->code_nco;
+
+  // Store values in the results log
+  if (res != NULL && k < res->size) {
+    res->carr_freq[k] = ch->carr_freq;
+    res->code_freq[k] = ch->code_freq;
+    res->absolute_sample[k] = ch->sample_pos - ch->rem_code_phase;
+    res->code_error[k] = ch->code_error;
+    res->code_nco[k] = ch->code_nco;
+    res->carr_error[k] = ch->carr_error;
+    res->carr_nco[k] = ch->carr_nco;
+    res->i_e[k] = ch->i_e;
+    res->i_p[k] = ch->i_p;
+    res->i_l[k] = ch->i_l;
+    res->q_e[k] = ch->q_e;
+    res->q_p[k] = ch->q_p;
+    res->q_l[k] = ch->q_l;
+  }
+
+  ch->loop_count++;
+}
+
+/*!
+ *  \brief Allocates the results log of a channel
+ *  \param[out] res Results log
+ *  \param[in] size Number of code periods to log
+ *  \return EXIT_SUCCESS, or EXIT_FAILURE if memory could not be allocated
+ */
+int gnss_track_results_alloc(gnss_track_results_t *res, const long int size) {
+
+  res->size = size;
+  res->carr_freq = calloc(size, sizeof(double));
+  res->code_freq = calloc(size, sizeof(double));
+  res->absolute_sample = calloc(size, sizeof(double));
+  res->code_error = calloc(size, sizeof(double));
+  res->code_nco = calloc(size, sizeof(double));
+  res->carr_error = calloc(size, sizeof(double));
+  res->carr_nco = calloc(size, sizeof(double));
+  res->i_e = calloc(size, sizeof(double));
+  res->i_p = calloc(size, sizeof(double));
+  res->i_l = calloc(size, sizeof(double));
+  res->q_e = calloc(size, sizeof(double));
+  res->q_p = calloc(size, sizeof(double));
+  res->q_l = calloc(size, sizeof(double));
+  res->vsm_index = calloc(size, sizeof(double));
+  res->vsm_value = calloc(size, sizeof(double));
+
+  if (!res->carr_freq || !res->code_freq || !res->absolute_sample ||
+      !res->code_error || !res->code_nco || !res->carr_error ||
+      !res->carr_nco || !res->i_e || !res->i_p || !res->i_l || !res->q_e ||
+      !res->q_p || !res->q_l || !res->vsm_index || !res->vsm_value) {
+    perror("Error allocating tracking results");
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
+/*!
+ *  \brief Releases the results log of a channel
+ *  \param[in,out] res Results log
+ */
+void gnss_track_results_free(gnss_track_results_t *res) {
+
+  free(res->carr_freq);
+  free(res->code_freq);
+  free(res->absolute_sample);
+  free(res->code_error);
+  free(res->code_nco);
+  free(res->carr_error);
+  free(res->carr_nco);
+  free(res->i_e);
+  free(res->i_p);
+  free(res->i_l);
+  free(res->q_e);
+  free(res->q_p);
+  free(res->q_l);
+  free(res->vsm_index);
+  free(res->vsm_value);
+}
+
+#endif /* GNSS_CHANNEL_H */
@@ -0,0 +1,380 @@
+/*!
+ *  \file nco_state.h
+ *  \brief      Phase-continuous carrier NCO state
+ *  \details    Keeps the 32-bit phase accumulator and phase step of a carrier
+ * NCO across calls, so consecutive blocks continue exactly where the previous
+ * one ended. The *_nco_state_* kernels read the accumulator, generate the
+ * block and write back the phase of the sample that follows it, taken from the
+ * SIMD lanes, instead of rebuilding the accumulator from a double carrier
+ * phase remainder on every call. The phase wraps modulo 2^32, which is one
+ * carrier cycle, so long runs accumulate no rounding error. The quadrature
+ * *_nco_iq_* kernels generate the sine and cosine carriers from a single
+ * phase ramp and a single interleaved lookup table, built by
+ * gnss_nco_sincos_lut_si32() or gnss_nco_sincos_lut_fl32(), so one gather
+ * yields both outputs. The carrier tables hold GNSS_NCO_LUT_SIZE entries,
+ * indexed by the GNSS_NCO_LUT_BITS most significant bits of the phase. The
+ * *_nco_poly_* kernels need no table at all, see gnss_nco_sincos_poly(),
+ * and neither do the *_nco_rot_* complex rotators. The *_code_state_* kernels
+ * keep the code phase the same way in a gnss_code_nco_t, 32.32 fixed point in
+ * chips, and derive the chip indices with integer adds and shifts. The
+ * *_nco_rate_* and *_code_rate_* kernels add a frequency rate to the phase
+ * model, for integrations long enough to smear under high dynamics. The
+ * *_code_window_* kernels generate a single Prompt replica that the Early and
+ * Late ones are offsets into, see gnss_code_nco_spacing().
+ *  \author    Damian Miralles
+ *  \author    Jake Johnson
+ *  \version   4.1a
+ *  \date      Jan 23, 2018
+ */
+
+#ifndef NCO_STATE_H
+#define NCO_STATE_H
+
+#include <math.h>
+#include <stdint.h>
+
+#ifndef GNSS_NCO_LUT_BITS
+//! Phase bits indexing the carrier lookup tables, a literal from 2 to 12
+#define GNSS_NCO_LUT_BITS 8
+#endif
+
+#if GNSS_NCO_LUT_BITS < 2 || GNSS_NCO_LUT_BITS > 12
+#error "GNSS_NCO_LUT_BITS must be between 2 and 12"
+#endif
+
+//! Number of entries of the sine and cosine lookup tables
+#define GNSS_NCO_LUT_SIZE (1 << GNSS_NCO_LUT_BITS)
+
+//! Right shift taking the table index out of the phase accumulator
+#define GNSS_NCO_LUT_SHIFT (32 - GNSS_NCO_LUT_BITS)
+
+//! Mask of the table index
+#define GNSS_NCO_LUT_MASK (GNSS_NCO_LUT_SIZE - 1)
+
+#ifndef GNSS_MAX_TAPS
+//! Taps the SIMD *_correlate_ntap_* kernels accumulate in a single pass
+#define GNSS_MAX_TAPS 16
+#endif
+
+/*!
+ *  \brief Carrier NCO state, one carrier cycle spans the whole uint32_t range
+ */
+typedef struct {
+  uint32_t phase; /*!< Phase of the next sample to generate */
+  uint32_t step;  /*!< Phase increment per sample */
+} gnss_nco_t;
+
+/*!
+ *  \brief Sets the NCO frequency, the phase is left untouched
+ *  \param[in,out] nco NCO state
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] samp_freq Sampling frequency of the signal to be generated
+ */
+static inline void gnss_nco_set_freq(gnss_nco_t *nco, const double carr_freq,
+                                     const double samp_freq) {
+  nco->step = (uint32_t)(carr_freq * (4294967296.0 / samp_freq) + 0.5);
+}
+
+/*!
+ *  \brief Seeds the NCO from a carrier phase remainder and frequency
+ *  \param[out] nco NCO state
+ *  \param[in] rem_carr_phase Carrier phase of the first sample, in radians
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] samp_freq Sampling frequency of the signal to be generated
+ */
+static inline void gnss_nco_init(gnss_nco_t *nco, const double rem_carr_phase,
+                                 const double carr_freq,
+                                 const double samp_freq) {
+  nco->phase =
+      (uint32_t)(rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+  gnss_nco_set_freq(nco, carr_freq, samp_freq);
+}
+
+/*!
+ *  \brief Advances the NCO over samples that are not generated
+ *  \param[in,out] nco NCO state
+ *  \param[in] num_samples Number of samples to skip
+ */
+static inline void gnss_nco_advance(gnss_nco_t *nco,
+                                    const int32_t num_samples) {
+  nco->phase += (uint32_t)num_samples * nco->step;
+}
+
+/*!
+ *  \brief Carrier phase of the next sample
+ *  \details The result converts back to the same accumulator value when
+ * passed as rem_carr_phase to the stateless kernels.
+ *  \param[in] nco NCO state
+ *  \return Phase in radians, in [0, 2*pi)
+ */
+static inline double gnss_nco_phase(const gnss_nco_t *nco) {
+  return nco->phase * ((2.0 * M_PI) / 4294967296.0);
+}
+
+/*!
+ *  \brief Code NCO state in 32.32 fixed point, the upper 32 bits count chips
+ */
+typedef struct {
+  uint64_t phase; /*!< Code phase of the next sample to generate */
+  uint64_t step;  /*!< Code phase increment per sample */
+} gnss_code_nco_t;
+
+/*!
+ *  \brief Sets the code NCO frequency, the phase is left untouched
+ *  \param[in,out] nco Code NCO state
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+static inline void gnss_code_nco_set_freq(gnss_code_nco_t *nco,
+                                          const double code_freq,
+                                          const double samp_freq) {
+  nco->step = (uint64_t)(code_freq * (4294967296.0 / samp_freq) + 0.5);
+}
+
+/*!
+ *  \brief Seeds the code NCO from a code phase remainder and frequency
+ *  \param[out] nco Code NCO state
+ *  \param[in] rem_code_phase Code phase of the first sample, in chips
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+static inline void gnss_code_nco_init(gnss_code_nco_t *nco,
+                                      const double rem_code_phase,
+                                      const double code_freq,
+                                      const double samp_freq) {
+  nco->phase = (uint64_t)(int64_t)floor(rem_code_phase * 4294967296.0 + 0.5);
+  gnss_code_nco_set_freq(nco, code_freq, samp_freq);
+}
+
+/*!
+ *  \brief Number of samples left until the code phase reaches code_length
+ *  \param[in] nco Code NCO state
+ *  \param[in] code_length Length of the ranging code, in chips
+ *  \return Samples to generate so the next block starts a new code period
+ */
+static inline int32_t gnss_code_nco_samples(const gnss_code_nco_t *nco,
+                                            const int32_t code_length) {
+  const int64_t left = ((int64_t)code_length << 32) - (int64_t)nco->phase;
+  return (int32_t)((left + (int64_t)nco->step - 1) / (int64_t)nco->step);
+}
+
+/*!
+ *  \brief Moves the code phase back by one code period
+ *  \param[in,out] nco Code NCO state
+ *  \param[in] code_length Length of the ranging code, in chips
+ */
+static inline void gnss_code_nco_wrap(gnss_code_nco_t *nco,
+                                      const int32_t code_length) {
+  nco->phase -= (uint64_t)code_length << 32;
+}
+
+/*!
+ *  \brief Code phase of the next sample
+ *  \param[in] nco Code NCO state
+ *  \return Phase in chips
+ */
+static inline double gnss_code_nco_phase(const gnss_code_nco_t *nco) {
+  return (int64_t)nco->phase * (1.0 / 4294967296.0);
+}
+
+/*!
+ *  \brief Early-Prompt spacing of the *_code_window_* kernels in samples
+ *  \details The Early and Late replicas of a window are shifted by a whole
+ * number of samples, so a spacing of chips only matches the code_state
+ * kernels when it is a multiple of the code phase step, as half a chip is at
+ * 16 times the chip rate.
+ *  \param[in] nco Code NCO state
+ *  \param[in] chips Early-Prompt spacing in chips
+ *  \return Spacing rounded to the nearest sample
+ */
+static inline int32_t gnss_code_nco_spacing(const gnss_code_nco_t *nco,
+                                            const double chips) {
+  return (int32_t)floor(chips * 4294967296.0 / (double)nco->step + 0.5);
+}
+
+/*!
+ *  \brief Code frequency rate in the units of the *_code_rate_* kernels
+ *  \param[in] code_rate Code frequency rate, in chips per second squared
+ *  \param[in] samp_freq Sampling frequency of the signal
+ *  \return Change of the code phase step on every sample, in chips
+ */
+static inline double gnss_code_nco_rate(const double code_rate,
+                                        const double samp_freq) {
+  return code_rate / (samp_freq * samp_freq);
+}
+
+/*!
+ *  \brief Ranging code indices of the Early, Prompt and Late replicas
+ *  \details The indices are the code phase rounded up, with the Early and
+ * Late replicas half a chip away, as in the floating point *_code_* kernels.
+ * Adding the rounding bias in 32.32 and keeping the upper 32 bits gives the
+ * same result without a conversion.
+ *  \param[in] phase Code phase in 32.32 fixed point
+ *  \param[out] e_idx Index of the Early chip
+ *  \param[out] p_idx Index of the Prompt chip
+ *  \param[out] l_idx Index of the Late chip
+ */
+static inline void gnss_code_nco_idx(const uint64_t phase, int32_t *e_idx,
+                                     int32_t *p_idx, int32_t *l_idx) {
+  *e_idx = (int32_t)((phase + 0x07FFFFFFFull) >> 32);
+  *p_idx = (int32_t)((phase + 0x0FFFFFFFFull) >> 32);
+  *l_idx = (int32_t)((phase + 0x17FFFFFFFull) >> 32);
+}
+
+/*!
+ *  \brief Carrier NCO state with a frequency rate, in 32.32 fixed point
+ *  \details The upper 32 bits of the phase match gnss_nco_t, one carrier
+ * cycle spanning the whole uint32_t range. The step grows by the rate on
+ * every sample, so the phase follows a second order model within the block.
+ */
+typedef struct {
+  uint64_t phase; /*!< Phase of the next sample to generate */
+  uint64_t step;  /*!< Phase increment after the next sample */
+  uint64_t rate;  /*!< Step increment per sample, two's complement */
+} gnss_nco_rate_t;
+
+/*!
+ *  \brief Seeds the NCO from a carrier phase, frequency and frequency rate
+ *  \param[out] nco NCO state
+ *  \param[in] rem_carr_phase Carrier phase of the first sample, in radians
+ *  \param[in] carr_freq Carrier frequency of the first sample
+ *  \param[in] carr_rate Carrier frequency rate, in Hz per second
+ *  \param[in] samp_freq Sampling frequency of the signal to be generated
+ */
+static inline void gnss_nco_rate_init(gnss_nco_rate_t *nco,
+                                      const double rem_carr_phase,
+                                      const double carr_freq,
+                                      const double carr_rate,
+                                      const double samp_freq) {
+  const double lsb_per_cycle = 18446744073709551616.0;
+  const uint32_t phase =
+      (uint32_t)(rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+
+  nco->phase = (uint64_t)phase << 32;
+  nco->step =
+      (uint64_t)(int64_t)floor(carr_freq * (lsb_per_cycle / samp_freq) + 0.5);
+  nco->rate = (uint64_t)(int64_t)floor(
+      carr_rate * (lsb_per_cycle / (samp_freq * samp_freq)) + 0.5);
+}
+
+/*!
+ *  \brief Carrier frequency of the next sample
+ *  \param[in] nco NCO state
+ *  \param[in] samp_freq Sampling frequency of the signal
+ *  \return Frequency in Hz
+ */
+static inline double gnss_nco_rate_freq(const gnss_nco_rate_t *nco,
+                                        const double samp_freq) {
+  return (int64_t)nco->step * (samp_freq / 18446744073709551616.0);
+}
+
+/*!
+ *  \brief Carrier phase of the next sample
+ *  \param[in] nco NCO state
+ *  \return Phase in radians, in [0, 2*pi)
+ */
+static inline double gnss_nco_rate_phase(const gnss_nco_rate_t *nco) {
+  return (uint32_t)(nco->phase >> 32) * ((2.0 * M_PI) / 4294967296.0);
+}
+
+/*!
+ *  \brief Packs the sine and cosine lookup tables into one table of int32_t
+ *  \details Each entry holds the sine in its upper 16 bits and the cosine in
+ * its lower 16 bits, so the table values must fit in an int16_t.
+ *  \param[out] sincos_lut Packed table of GNSS_NCO_LUT_SIZE entries
+ *  \param[in] sin_lut Sine lookup table
+ *  \param[in] cos_lut Cosine lookup table
+ */
+static inline void gnss_nco_sincos_lut_si32(int32_t *sincos_lut,
+                                            const int32_t *sin_lut,
+                                            const int32_t *cos_lut) {
+  for (int i = 0; i < GNSS_NCO_LUT_SIZE; i++) {
+    sincos_lut[i] = (int32_t)(((uint32_t)sin_lut[i] << 16) |
+                              (uint16_t)cos_lut[i]);
+  }
+}
+
+/*!
+ *  \brief Interleaves the sine and cosine lookup tables into one table
+ *  \param[out] sincos_lut Table of 2 * GNSS_NCO_LUT_SIZE entries, the sine
+ * and cosine of each phase side by side
+ *  \param[in] sin_lut Sine lookup table
+ *  \param[in] cos_lut Cosine lookup table
+ */
+static inline void gnss_nco_sincos_lut_fl32(float *sincos_lut,
+                                            const float *sin_lut,
+                                            const float *cos_lut) {
+  for (int i = 0; i < GNSS_NCO_LUT_SIZE; i++) {
+    sincos_lut[2 * i] = sin_lut[i];
+    sincos_lut[2 * i + 1] = cos_lut[i];
+  }
+}
+
+//! Minimax coefficients of sin(x) / x - 1 in x^2, for |x| <= pi / 4
+#define GNSS_NCO_POLY_S1 -1.6666654611e-1f
+#define GNSS_NCO_POLY_S2 8.3321608736e-3f
+#define GNSS_NCO_POLY_S3 -1.9515295891e-4f
+
+//! Minimax coefficients of (cos(x) - 1 + x^2 / 2) / x^4 in x^2, |x| <= pi / 4
+#define GNSS_NCO_POLY_C0 4.166664568298827e-2f
+#define GNSS_NCO_POLY_C1 -1.388731625493765e-3f
+#define GNSS_NCO_POLY_C2 2.443315711809948e-5f
+
+//! Radians per unit of the phase accumulator
+#define GNSS_NCO_POLY_RAD_PER_LSB 1.4629180792671596e-9f
+
+#ifndef GNSS_NCO_ROT_RENORM
+//! Samples between renormalizations of the rotator NCO, a multiple of 64
+#define GNSS_NCO_ROT_RENORM 256
+#endif
+
+/*!
+ *  \brief Sine and cosine of a phase accumulator value, without tables
+ *  \details The upper two bits, rounded, select the quadrant and the
+ * remainder is reduced to [-pi/4, pi/4) in integer arithmetic, where two
+ * short minimax polynomials give the sine and cosine to a few ulp. The SIMD
+ * *_nco_poly_fl32 kernels evaluate the same steps, using this function for
+ * their tail.
+ *  \param[in] phase Phase, one carrier cycle spans the whole uint32_t range
+ *  \param[in] amplitude Peak amplitude of the outputs
+ *  \param[out] sin_val Sine of the phase times amplitude
+ *  \param[out] cos_val Cosine of the phase times amplitude
+ */
+static inline void gnss_nco_sincos_poly(const uint32_t phase,
+                                        const float amplitude, float *sin_val,
+                                        float *cos_val) {
+  const uint32_t quadrant = (phase + 0x20000000u) >> 30;
+  const float x =
+      (float)(int32_t)(phase - (quadrant << 30)) * GNSS_NCO_POLY_RAD_PER_LSB;
+  const float z = x * x;
+  const float s =
+      x + x * z *
+              (GNSS_NCO_POLY_S1 +
+               z * (GNSS_NCO_POLY_S2 + z * GNSS_NCO_POLY_S3));
+  const float c =
+      1.0f - 0.5f * z +
+      z * z *
+          (GNSS_NCO_POLY_C0 + z * (GNSS_NCO_POLY_C1 + z * GNSS_NCO_POLY_C2));
+
+  // Rotate by the quadrant, swapping and negating the two outputs
+  switch (quadrant) {
+  case 0:
+    *sin_val = amplitude * s;
+    *cos_val = amplitude * c;
+    break;
+  case 1:
+    *sin_val = amplitude * c;
+    *cos_val = -amplitude * s;
+    break;
+  case 2:
+    *sin_val = -amplitude * s;
+    *cos_val = -amplitude * c;
+    break;
+  default:
+    *sin_val = -amplitude * c;
+    *cos_val = amplitude * s;
+    break;
+  }
+}
+
+#endif /* NCO_STATE_H */
@@ -0,0 +1,1390 @@
+/*!
+ *  \file nom_intrinsics.h
+ *  \brief      Provides portable C versions of the SIMD kernels
+ *  \details    Scalar counterparts of the AVX2 and AVX512 kernels with the
+ * same signatures, so they can be bound by the runtime dispatcher on machines
+ * without SIMD support. None of the functions require special compiler flags.
+ *  \author    Damian Miralles
+ *  \author    Jake Johnson
+ *  \version   4.1a
+ *  \date      Jan 23, 2018
+ *  \pre       Make sure you have .bin files containing data and lookup tables
+ */
+
+#ifndef NOM_INTRINSICS_H
+#define NOM_INTRINSICS_H
+
+#include "nco_state.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/*!
+ *  \brief     Generates a nominal NCO based on the Direct Lookup Table (DLUT)
+ * method
+ *  \param[out] sig_nco Sinusoidal wave generated byt the NCO
+ *  \param[in] lut Lookup table to be use for the code
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] samp_freq Sampling frequency of the signal to be generated
+ */
+void nom_nco_si32(int32_t *sig_nco, const int32_t *lut, const int32_t blk_size,
+                  const double rem_carr_phase, const double carr_freq,
+                  const double samp_freq) {
+
+  uint32_t carrPhaseBase =
+      (rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+  uint32_t carrStep = (carr_freq * (4294967296.0 / samp_freq) + 0.5);
+  uint32_t carrIndex = 0;
+  int32_t inda;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    carrIndex = (carrPhaseBase >> GNSS_NCO_LUT_SHIFT) & GNSS_NCO_LUT_MASK;
+
+    // Look in lut
+    sig_nco[inda] = lut[carrIndex];
+
+    // Delta step
+    carrPhaseBase += carrStep;
+  }
+}
+
+/*!
+ *  \brief     Generates a nominal NCO based on the Direct Lookup Table (DLUT)
+ * method
+ *  \param[out] sig_nco Sinusoidal wave generated byt the NCO
+ *  \param[in] lut Lookup table to be use for the code
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] samp_freq Sampling frequency of the signal to be generated
+ */
+void nom_nco_fl32(float *sig_nco, const float *lut, const int32_t blk_size,
+                  const double rem_carr_phase, const double carr_freq,
+                  const double samp_freq) {
+
+  uint32_t carrPhaseBase =
+      (rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+  uint32_t carrStep = (carr_freq * (4294967296.0 / samp_freq) + 0.5);
+  uint32_t carrIndex = 0;
+  int32_t inda;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    // Obtain integer index from the GNSS_NCO_LUT_BITS upper bits
+    carrIndex = (carrPhaseBase >> GNSS_NCO_LUT_SHIFT) & GNSS_NCO_LUT_MASK;
+
+    // Look in lut
+    sig_nco[inda] = lut[carrIndex];
+
+    // Delta step
+    carrPhaseBase += carrStep;
+  }
+}
+
+/*!
+ *  \brief Generates a phase-continuous nominal NCO based on the Direct Lookup
+ * Table (DLUT) method
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table to be use for the code
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void nom_nco_state_si32(int32_t *sig_nco, const int32_t *lut,
+                        const int32_t blk_size, gnss_nco_t *nco) {
+
+  uint32_t carrPhaseBase = nco->phase;
+  const uint32_t carrStep = nco->step;
+  int32_t inda;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    // Obtain index from the GNSS_NCO_LUT_BITS upper bits and look in lut
+    sig_nco[inda] = lut[carrPhaseBase >> GNSS_NCO_LUT_SHIFT];
+
+    // Delta step
+    carrPhaseBase += carrStep;
+  }
+  nco->phase = carrPhaseBase;
+}
+
+/*!
+ *  \brief Generates a phase-continuous nominal NCO based on the Direct Lookup
+ * Table (DLUT) method
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table to be use for the code
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void nom_nco_state_fl32(float *sig_nco, const float *lut,
+                        const int32_t blk_size, gnss_nco_t *nco) {
+
+  uint32_t carrPhaseBase = nco->phase;
+  const uint32_t carrStep = nco->step;
+  int32_t inda;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    // Obtain index from the GNSS_NCO_LUT_BITS upper bits and look in lut
+    sig_nco[inda] = lut[carrPhaseBase >> GNSS_NCO_LUT_SHIFT];
+
+    // Delta step
+    carrPhaseBase += carrStep;
+  }
+  nco->phase = carrPhaseBase;
+}
+
+/*!
+ *  \brief Generates the sine and cosine carriers of a nominal quadrature NCO
+ *  \details Both carriers come from one phase ramp and one gather of the
+ * packed table built by gnss_nco_sincos_lut_si32().
+ *  \param[out] sig_sin Sine wave generated by the NCO
+ *  \param[out] sig_cos Cosine wave generated by the NCO
+ *  \param[in] sincos_lut Packed sine and cosine lookup table
+ *  \param[in] blk_size Total number of elements in the output vectors
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void nom_nco_iq_si32(int32_t *sig_sin, int32_t *sig_cos,
+                     const int32_t *sincos_lut, const int32_t blk_size,
+                     gnss_nco_t *nco) {
+
+  uint32_t carrPhaseBase = nco->phase;
+  const uint32_t carrStep = nco->step;
+  int32_t inda, sincos;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    // Obtain index from the GNSS_NCO_LUT_BITS upper bits and look in lut
+    sincos = sincos_lut[carrPhaseBase >> GNSS_NCO_LUT_SHIFT];
+
+    // Sine in the upper half of the entry, cosine in the lower half
+    sig_sin[inda] = sincos >> 16;
+    sig_cos[inda] = (int16_t)sincos;
+
+    // Delta step
+    carrPhaseBase += carrStep;
+  }
+  nco->phase = carrPhaseBase;
+}
+
+/*!
+ *  \brief Generates the sine and cosine carriers of a nominal quadrature NCO
+ *  \details Both carriers come from one phase ramp and one gather of the
+ * interleaved table built by gnss_nco_sincos_lut_fl32().
+ *  \param[out] sig_sin Sine wave generated by the NCO
+ *  \param[out] sig_cos Cosine wave generated by the NCO
+ *  \param[in] sincos_lut Interleaved sine and cosine lookup table
+ *  \param[in] blk_size Total number of elements in the output vectors
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void nom_nco_iq_fl32(float *sig_sin, float *sig_cos, const float *sincos_lut,
+                     const int32_t blk_size, gnss_nco_t *nco) {
+
+  uint32_t carrPhaseBase = nco->phase;
+  const uint32_t carrStep = nco->step;
+  uint32_t carrIndex;
+  int32_t inda;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    // Obtain index from the GNSS_NCO_LUT_BITS upper bits and look in lut
+    carrIndex = carrPhaseBase >> GNSS_NCO_LUT_SHIFT;
+    sig_sin[inda] = sincos_lut[2 * carrIndex];
+    sig_cos[inda] = sincos_lut[2 * carrIndex + 1];
+
+    // Delta step
+    carrPhaseBase += carrStep;
+  }
+  nco->phase = carrPhaseBase;
+}
+
+/*!
+ *  \brief Generates a nominal NCO from a small lookup table
+ *  \details Reference for the permute based SIMD kernels, the table is
+ * indexed by the lut_bits most significant bits of the phase.
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table of 1 << lut_bits entries
+ *  \param[in] lut_bits Phase bits indexing the table, 1 to 5
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void nom_nco_perm_si32(int32_t *sig_nco, const int32_t *lut,
+                       const int32_t lut_bits, const int32_t blk_size,
+                       gnss_nco_t *nco) {
+
+  uint32_t carrPhaseBase = nco->phase;
+  const uint32_t carrStep = nco->step;
+  const int32_t shift = 32 - lut_bits;
+  int32_t inda;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    // Obtain integer index in lut_bits:(32 - lut_bits) number and look in lut
+    sig_nco[inda] = lut[carrPhaseBase >> shift];
+
+    // Delta step
+    carrPhaseBase += carrStep;
+  }
+  nco->phase = carrPhaseBase;
+}
+
+/*!
+ *  \brief Generates a nominal NCO from a small lookup table
+ *  \details Reference for the permute based SIMD kernels, the table is
+ * indexed by the lut_bits most significant bits of the phase.
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table of 1 << lut_bits entries
+ *  \param[in] lut_bits Phase bits indexing the table, 1 to 5
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void nom_nco_perm_fl32(float *sig_nco, const float *lut, const int32_t lut_bits,
+                       const int32_t blk_size, gnss_nco_t *nco) {
+
+  uint32_t carrPhaseBase = nco->phase;
+  const uint32_t carrStep = nco->step;
+  const int32_t shift = 32 - lut_bits;
+  int32_t inda;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    // Obtain integer index in lut_bits:(32 - lut_bits) number and look in lut
+    sig_nco[inda] = lut[carrPhaseBase >> shift];
+
+    // Delta step
+    carrPhaseBase += carrStep;
+  }
+  nco->phase = carrPhaseBase;
+}
+
+/*!
+ *  \brief Generates the sine and cosine carriers of a nominal polynomial NCO
+ *  \details Reference for the SIMD polynomial kernels, evaluating
+ * gnss_nco_sincos_poly() at the exact phase of every sample instead of
+ * reading a table.
+ *  \param[out] sig_sin Sine wave generated by the NCO
+ *  \param[out] sig_cos Cosine wave generated by the NCO
+ *  \param[in] amplitude Peak amplitude of the carriers
+ *  \param[in] blk_size Total number of elements in the output vectors
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void nom_nco_poly_fl32(float *sig_sin, float *sig_cos, const float amplitude,
+                       const int32_t blk_size, gnss_nco_t *nco) {
+
+  uint32_t carrPhaseBase = nco->phase;
+  const uint32_t carrStep = nco->step;
+  int32_t inda;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    gnss_nco_sincos_poly(carrPhaseBase, amplitude, &sig_sin[inda],
+                         &sig_cos[inda]);
+
+    // Delta step
+    carrPhaseBase += carrStep;
+  }
+  nco->phase = carrPhaseBase;
+}
+
+/*!
+ *  \brief Generates a nominal NCO with a complex phase rotator
+ *  \details Reference for the SIMD rotator kernels. The carrier is the
+ * imaginary part of a unit phasor multiplied by exp(j * 2 * pi * carr_freq /
+ * samp_freq) once per sample, and pulled back to unit magnitude every
+ * GNSS_NCO_ROT_RENORM samples. Takes the signature of nom_nco_fl32(), the
+ * table only giving the amplitude through its quarter cycle entry.
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Sine lookup table of GNSS_NCO_LUT_SIZE entries
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] samp_freq Sampling frequency of the signal to be generated
+ */
+void nom_nco_rot_fl32(float *sig_nco, const float *lut, const int32_t blk_size,
+                      const double rem_carr_phase, const double carr_freq,
+                      const double samp_freq) {
+
+  const double carrStep = 2.0 * M_PI * carr_freq / samp_freq;
+  const float amplitude = lut[GNSS_NCO_LUT_SIZE / 4];
+  const float rotRe = (float)cos(carrStep);
+  const float rotIm = (float)sin(carrStep);
+  float phasorRe = (float)cos(rem_carr_phase);
+  float phasorIm = (float)sin(rem_carr_phase);
+  float tmp, gain;
+  int32_t inda;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    sig_nco[inda] = amplitude * phasorIm;
+
+    // Rotate the phasor by one sample
+    tmp = phasorRe * rotRe - phasorIm * rotIm;
+    phasorIm = phasorRe * rotIm + phasorIm * rotRe;
+    phasorRe = tmp;
+
+    // One Newton step of 1 / sqrt(|phasor|^2) keeps the magnitude at one
+    if ((inda + 1) % GNSS_NCO_ROT_RENORM == 0) {
+      gain = 1.5f - 0.5f * (phasorRe * phasorRe + phasorIm * phasorIm);
+      phasorRe *= gain;
+      phasorIm *= gain;
+    }
+  }
+}
+
+/*!
+ *  \brief     Generates an Early, Late and Prompt code
+ *  \param[out] ecode Early replica of the ranging code
+ *  \param[out] pcode Prompt replica of the ranging code
+ *  \param[out] lcode Late replica of the ranging code
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of elements in the code vectors
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void nom_code_si32(int32_t *ecode, int32_t *pcode, int32_t *lcode,
+                   const int32_t *cacode, const int32_t blk_size,
+                   const float rem_code_phase, const float code_freq,
+                   const float samp_freq) {
+
+  int32_t inda;
+  float earlyLateSpc = 0.5;
+  float codePhaseStep = code_freq / samp_freq;
+  float baseCode;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    baseCode = (inda * codePhaseStep + rem_code_phase);
+    pCodeIdx = (int32_t)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
+    eCodeIdx = (int32_t)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
+                   ? (baseCode - earlyLateSpc + 1)
+                   : (baseCode - earlyLateSpc);
+    lCodeIdx = (int32_t)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
+                   ? (baseCode + earlyLateSpc + 1)
+                   : (baseCode + earlyLateSpc);
+
+    ecode[inda] = *(cacode + eCodeIdx);
+    pcode[inda] = *(cacode + pCodeIdx);
+    lcode[inda] = *(cacode + lCodeIdx);
+  }
+}
+
+/*!
+ *  \brief     Generates an Early, Late and Prompt code
+ *  \param[out] ecode Early replica of the ranging code
+ *  \param[out] pcode Prompt replica of the ranging code
+ *  \param[out] lcode Late replica of the ranging code
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of elements in the code vectors
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void nom_code_fl32(float *ecode, float *pcode, float *lcode,
+                   const float *cacode, const int32_t blk_size,
+                   const float rem_code_phase, const float code_freq,
+                   const float samp_freq) {
+
+  int32_t inda;
+  float earlyLateSpc = 0.5;
+  float codePhaseStep = code_freq / samp_freq;
+  float baseCode;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    baseCode = (inda * codePhaseStep + rem_code_phase);
+    pCodeIdx = (int32_t)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
+    eCodeIdx = (int32_t)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
+                   ? (baseCode - earlyLateSpc + 1)
+                   : (baseCode - earlyLateSpc);
+    lCodeIdx = (int32_t)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
+                   ? (baseCode + earlyLateSpc + 1)
+                   : (baseCode + earlyLateSpc);
+
+    ecode[inda] = *(cacode + eCodeIdx);
+    pcode[inda] = *(cacode + pCodeIdx);
+    lcode[inda] = *(cacode + lCodeIdx);
+  }
+}
+
+/*!
+ *  \brief     Generates a nominal NCO based on the Direct Lookup Table (DLUT)
+ * method as si16 type
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table of GNSS_NCO_LUT_SIZE entries
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] samp_freq Sampling frequency of the signal to be generated
+ */
+void nom_nco_si16(int16_t *sig_nco, const int32_t *lut, const int32_t blk_size,
+                  const double rem_carr_phase, const double carr_freq,
+                  const double samp_freq) {
+
+  uint32_t carrPhaseBase =
+      (rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+  uint32_t carrStep = (carr_freq * (4294967296.0 / samp_freq) + 0.5);
+  int32_t inda;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    // Obtain index from the GNSS_NCO_LUT_BITS upper bits and look in lut
+    sig_nco[inda] = (int16_t)lut[carrPhaseBase >> GNSS_NCO_LUT_SHIFT];
+
+    // Delta step
+    carrPhaseBase += carrStep;
+  }
+}
+
+/*!
+ *  \brief     Generates a nominal NCO based on the Direct Lookup Table (DLUT)
+ * method as si8 type
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table of GNSS_NCO_LUT_SIZE entries
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] samp_freq Sampling frequency of the signal to be generated
+ */
+void nom_nco_si8(int8_t *sig_nco, const int32_t *lut, const int32_t blk_size,
+                 const double rem_carr_phase, const double carr_freq,
+                 const double samp_freq) {
+
+  uint32_t carrPhaseBase =
+      (rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+  uint32_t carrStep = (carr_freq * (4294967296.0 / samp_freq) + 0.5);
+  int32_t inda;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    // Obtain index from the GNSS_NCO_LUT_BITS upper bits and look in lut
+    sig_nco[inda] = (int8_t)lut[carrPhaseBase >> GNSS_NCO_LUT_SHIFT];
+
+    // Delta step
+    carrPhaseBase += carrStep;
+  }
+}
+
+/*!
+ *  \brief     Generates an Early, Late and Prompt code as si16 type
+ *  \param[out] ecode Early replica of the ranging code
+ *  \param[out] pcode Prompt replica of the ranging code
+ *  \param[out] lcode Late replica of the ranging code
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of elements in the code vectors
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void nom_code_si16(int16_t *ecode, int16_t *pcode, int16_t *lcode,
+                   const int32_t *cacode, const int32_t blk_size,
+                   const float rem_code_phase, const float code_freq,
+                   const float samp_freq) {
+
+  int32_t inda;
+  float earlyLateSpc = 0.5;
+  float codePhaseStep = code_freq / samp_freq;
+  float baseCode;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    baseCode = (inda * codePhaseStep + rem_code_phase);
+    pCodeIdx = (int32_t)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
+    eCodeIdx = (int32_t)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
+                   ? (baseCode - earlyLateSpc + 1)
+                   : (baseCode - earlyLateSpc);
+    lCodeIdx = (int32_t)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
+                   ? (baseCode + earlyLateSpc + 1)
+                   : (baseCode + earlyLateSpc);
+
+    ecode[inda] = (int16_t)cacode[eCodeIdx];
+    pcode[inda] = (int16_t)cacode[pCodeIdx];
+    lcode[inda] = (int16_t)cacode[lCodeIdx];
+  }
+}
+
+/*!
+ *  \brief     Generates an Early, Late and Prompt code as si8 type
+ *  \param[out] ecode Early replica of the ranging code
+ *  \param[out] pcode Prompt replica of the ranging code
+ *  \param[out] lcode Late replica of the ranging code
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of elements in the code vectors
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void nom_code_si8(int8_t *ecode, int8_t *pcode, int8_t *lcode,
+                  const int32_t *cacode, const int32_t blk_size,
+                  const float rem_code_phase, const float code_freq,
+                  const float samp_freq) {
+
+  int32_t inda;
+  float earlyLateSpc = 0.5;
+  float codePhaseStep = code_freq / samp_freq;
+  float baseCode;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    baseCode = (inda * codePhaseStep + rem_code_phase);
+    pCodeIdx = (int32_t)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
+    eCodeIdx = (int32_t)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
+                   ? (baseCode - earlyLateSpc + 1)
+                   : (baseCode - earlyLateSpc);
+    lCodeIdx = (int32_t)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
+                   ? (baseCode + earlyLateSpc + 1)
+                   : (baseCode + earlyLateSpc);
+
+    ecode[inda] = (int8_t)cacode[eCodeIdx];
+    pcode[inda] = (int8_t)cacode[pCodeIdx];
+    lcode[inda] = (int8_t)cacode[lCodeIdx];
+  }
+}
+
+/*!
+ *  \brief     Generates an Early, Late and Prompt code from a fixed point code
+ * NCO
+ *  \param[out] ecode Early replica of the ranging code
+ *  \param[out] pcode Prompt replica of the ranging code
+ *  \param[out] lcode Late replica of the ranging code
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of elements in the code vectors
+ *  \param[in,out] nco Code NCO state, advanced to the sample that follows the
+ * block
+ */
+void nom_code_state_si32(int32_t *ecode, int32_t *pcode, int32_t *lcode,
+                         const int32_t *cacode, const int32_t blk_size,
+                         gnss_code_nco_t *nco) {
+
+  int32_t inda;
+  uint64_t code_phase = nco->phase;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    gnss_code_nco_idx(code_phase, &eCodeIdx, &pCodeIdx, &lCodeIdx);
+    code_phase += nco->step;
+
+    ecode[inda] = cacode[eCodeIdx];
+    pcode[inda] = cacode[pCodeIdx];
+    lcode[inda] = cacode[lCodeIdx];
+  }
+  nco->phase = code_phase;
+}
+
+/*!
+ *  \brief     Generates an Early, Late and Prompt code from a fixed point code
+ * NCO as fl32 type
+ *  \param[out] ecode Early replica of the ranging code
+ *  \param[out] pcode Prompt replica of the ranging code
+ *  \param[out] lcode Late replica of the ranging code
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of elements in the code vectors
+ *  \param[in,out] nco Code NCO state, advanced to the sample that follows the
+ * block
+ */
+void nom_code_state_fl32(float *ecode, float *pcode, float *lcode,
+                         const float *cacode, const int32_t blk_size,
+                         gnss_code_nco_t *nco) {
+
+  int32_t inda;
+  uint64_t code_phase = nco->phase;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    gnss_code_nco_idx(code_phase, &eCodeIdx, &pCodeIdx, &lCodeIdx);
+    code_phase += nco->step;
+
+    ecode[inda] = cacode[eCodeIdx];
+    pcode[inda] = cacode[pCodeIdx];
+    lcode[inda] = cacode[lCodeIdx];
+  }
+  nco->phase = code_phase;
+}
+
+/*!
+ *  \brief     Generates a single Prompt replica of a fixed point code NCO
+ * spanning the Early and Late replicas
+ *  \details   The window starts spacing samples before the NCO phase and holds
+ * blk_size + 2 * spacing samples, so the Early, Prompt and Late replicas are
+ * code, code + spacing and code + 2 * spacing. They match the *_code_state_*
+ * kernels when spacing samples span exactly half a chip.
+ *  \param[out] code Prompt replica, blk_size + 2 * spacing elements
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Number of samples in each of the E/P/L replicas
+ *  \param[in] spacing Early-Prompt spacing in samples, under one chip
+ *  \param[in,out] nco Code NCO state, advanced to the sample that follows the
+ * block
+ */
+void nom_code_window_si32(int32_t *code, const int32_t *cacode,
+                          const int32_t blk_size, const int32_t spacing,
+                          gnss_code_nco_t *nco) {
+
+  int32_t inda;
+  uint64_t code_phase = nco->phase - (uint64_t)spacing * nco->step;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  // for each sample
+  for (inda = 0; inda < blk_size + 2 * spacing; ++inda) {
+    gnss_code_nco_idx(code_phase, &eCodeIdx, &pCodeIdx, &lCodeIdx);
+    code_phase += nco->step;
+
+    code[inda] = cacode[pCodeIdx];
+  }
+  nco->phase += (uint64_t)blk_size * nco->step;
+}
+
+/*!
+ *  \brief     Generates a single Prompt replica of a fixed point code NCO
+ * spanning the Early and Late replicas as fl32 type
+ *  \details   Same window as nom_code_window_si32().
+ *  \param[out] code Prompt replica, blk_size + 2 * spacing elements
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Number of samples in each of the E/P/L replicas
+ *  \param[in] spacing Early-Prompt spacing in samples, under one chip
+ *  \param[in,out] nco Code NCO state, advanced to the sample that follows the
+ * block
+ */
+void nom_code_window_fl32(float *code, const float *cacode,
+                          const int32_t blk_size, const int32_t spacing,
+                          gnss_code_nco_t *nco) {
+
+  int32_t inda;
+  uint64_t code_phase = nco->phase - (uint64_t)spacing * nco->step;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  // for each sample
+  for (inda = 0; inda < blk_size + 2 * spacing; ++inda) {
+    gnss_code_nco_idx(code_phase, &eCodeIdx, &pCodeIdx, &lCodeIdx);
+    code_phase += nco->step;
+
+    code[inda] = cacode[pCodeIdx];
+  }
+  nco->phase += (uint64_t)blk_size * nco->step;
+}
+
+/*!
+ *  \brief     Generates a nominal NCO with a frequency rate based on the Direct
+ * Lookup Table (DLUT) method
+ *  \param[out] sig_nco Sinusoidal wave generated by the NCO
+ *  \param[in] lut Lookup table of GNSS_NCO_LUT_SIZE entries
+ *  \param[in] blk_size Total number of elements in the sig_nco vector
+ *  \param[in,out] nco NCO state, advanced to the sample that follows the block
+ */
+void nom_nco_rate_si32(int32_t *sig_nco, const int32_t *lut,
+                       const int32_t blk_size, gnss_nco_rate_t *nco) {
+  int32_t inda;
+  uint64_t carr_phase = nco->phase;
+  uint64_t carr_step = nco->step;
+
+  for (inda = 0; inda < blk_size; ++inda) {
+    sig_nco[inda] = lut[carr_phase >> (32 + GNSS_NCO_LUT_SHIFT)];
+    carr_phase += carr_step;
+    carr_step += nco->rate;
+  }
+  nco->phase = carr_phase;
+  nco->step = carr_step;
+}
+
+/*!
+ *  \brief     Generates an Early, Late and Prompt code with a code frequency
+ * rate
+ *  \details The code phase and step are carried in double precision within
+ * the block, since the rate is far below the resolution of the 32.32 step.
+ *  \param[out] ecode Early replica of the ranging code
+ *  \param[out] pcode Prompt replica of the ranging code
+ *  \param[out] lcode Late replica of the ranging code
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of elements in the code vectors
+ *  \param[in,out] nco Code NCO state, advanced to the sample that follows the
+ * block
+ *  \param[in] code_rate Code step increment per sample, see
+ * gnss_code_nco_rate()
+ */
+void nom_code_rate_si32(int32_t *ecode, int32_t *pcode, int32_t *lcode,
+                        const int32_t *cacode, const int32_t blk_size,
+                        gnss_code_nco_t *nco, const double code_rate) {
+
+  int32_t inda;
+  double code_phase = gnss_code_nco_phase(nco);
+  double code_step = nco->step * (1.0 / 4294967296.0);
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    ecode[inda] = cacode[(int32_t)ceil(code_phase - 0.5)];
+    pcode[inda] = cacode[(int32_t)ceil(code_phase)];
+    lcode[inda] = cacode[(int32_t)ceil(code_phase + 0.5)];
+    code_phase += code_step;
+    code_step += code_rate;
+  }
+  nco->phase = (uint64_t)(int64_t)floor(code_phase * 4294967296.0 + 0.5);
+  nco->step = (uint64_t)(code_step * 4294967296.0 + 0.5);
+}
+
+/*!
+ *  \brief Wipes off the carrier, generates the Early, Prompt and Late codes and
+ * correlates them against the raw signal in a single pass as si32 types
+ *  \param[out] i_e Early in-phase correlation
+ *  \param[out] i_p Prompt in-phase correlation
+ *  \param[out] i_l Late in-phase correlation
+ *  \param[out] q_e Early quadrature correlation
+ *  \param[out] q_p Prompt quadrature correlation
+ *  \param[out] q_l Late quadrature correlation
+ *  \param[in] signal Raw real signal samples
+ *  \param[in] sin_lut Sine lookup table of 256 entries
+ *  \param[in] cos_lut Cosine lookup table of 256 entries
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of samples to correlate
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void nom_fused_epl_si32(double *i_e, double *i_p, double *i_l, double *q_e,
+                        double *q_p, double *q_l, const int8_t *signal,
+                        const int32_t *sin_lut, const int32_t *cos_lut,
+                        const int32_t *cacode, const int32_t blk_size,
+                        const double rem_carr_phase, const double carr_freq,
+                        const double rem_code_phase, const double code_freq,
+                        const double samp_freq) {
+
+  int32_t inda;
+  int32_t returnValue[6] = {0, 0, 0, 0, 0, 0};
+  int32_t sinMix, cosMix;
+
+  // Carrier NCO declarations
+  const uint32_t carrStep =
+      (uint32_t)(carr_freq * (4294967296.0 / samp_freq) + 0.5);
+  uint32_t carrPhaseBase =
+      (uint32_t)(rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+  uint32_t carrIndex = 0;
+
+  // Code NCO declarations, kept in fl32 to match nom_code_si32()
+  const float earlyLateSpc = 0.5;
+  const float remCodePhase = (float)rem_code_phase;
+  const float codePhaseStep = (float)code_freq / (float)samp_freq;
+  float baseCode;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    carrIndex = (carrPhaseBase >> GNSS_NCO_LUT_SHIFT) & GNSS_NCO_LUT_MASK;
+    sinMix = sin_lut[carrIndex] * signal[inda];
+    cosMix = cos_lut[carrIndex] * signal[inda];
+    carrPhaseBase += carrStep;
+
+    baseCode = (inda * codePhaseStep + remCodePhase);
+    pCodeIdx = (int32_t)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
+    eCodeIdx = (int32_t)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
+                   ? (baseCode - earlyLateSpc + 1)
+                   : (baseCode - earlyLateSpc);
+    lCodeIdx = (int32_t)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
+                   ? (baseCode + earlyLateSpc + 1)
+                   : (baseCode + earlyLateSpc);
+
+    returnValue[0] += cacode[eCodeIdx] * sinMix;
+    returnValue[1] += cacode[pCodeIdx] * sinMix;
+    returnValue[2] += cacode[lCodeIdx] * sinMix;
+    returnValue[3] += cacode[eCodeIdx] * cosMix;
+    returnValue[4] += cacode[pCodeIdx] * cosMix;
+    returnValue[5] += cacode[lCodeIdx] * cosMix;
+  }
+
+  *i_e = returnValue[0];
+  *i_p = returnValue[1];
+  *i_l = returnValue[2];
+  *q_e = returnValue[3];
+  *q_p = returnValue[4];
+  *q_l = returnValue[5];
+}
+
+/*!
+ *  \brief Wipes off the carrier of interleaved I/Q int8 samples as si32 types
+ *  \details Performs the full complex multiply of the baseband samples with the
+ * carrier replica, sig_sin = I * sin + Q * cos and sig_cos = I * cos - Q * sin,
+ * matching the real data convention where the in-phase arm is correlated
+ * against the sine. The outputs feed nom_correlate_epl_si32() or
+ * nom_correlate_ntap_si32() unchanged.
+ *  \param[out] sig_sin Baseband signal mixed with the sine carrier
+ *  \param[out] sig_cos Baseband signal mixed with the cosine carrier
+ *  \param[in] signal Interleaved I/Q samples, 2 * blk_size elements
+ *  \param[in] sin_nco Sine carrier replica
+ *  \param[in] cos_nco Cosine carrier replica
+ *  \param[in] blk_size Total number of complex samples
+ */
+void nom_mix_iq8_si32(int32_t *sig_sin, int32_t *sig_cos, const int8_t *signal,
+                      const int32_t *sin_nco, const int32_t *cos_nco,
+                      const int32_t blk_size) {
+
+  for (int32_t inda = 0; inda < blk_size; inda++) {
+    sig_sin[inda] =
+        signal[2 * inda] * sin_nco[inda] + signal[2 * inda + 1] * cos_nco[inda];
+    sig_cos[inda] =
+        signal[2 * inda] * cos_nco[inda] - signal[2 * inda + 1] * sin_nco[inda];
+  }
+}
+
+/*!
+ *  \brief Wipes off the carrier of interleaved I/Q int16 samples as si32 types
+ *  \details Performs the full complex multiply of the baseband samples with the
+ * carrier replica, sig_sin = I * sin + Q * cos and sig_cos = I * cos - Q * sin,
+ * matching the real data convention where the in-phase arm is correlated
+ * against the sine. The outputs feed nom_correlate_epl_si32() or
+ * nom_correlate_ntap_si32() unchanged.
+ *  \param[out] sig_sin Baseband signal mixed with the sine carrier
+ *  \param[out] sig_cos Baseband signal mixed with the cosine carrier
+ *  \param[in] signal Interleaved I/Q samples, 2 * blk_size elements
+ *  \param[in] sin_nco Sine carrier replica
+ *  \param[in] cos_nco Cosine carrier replica
+ *  \param[in] blk_size Total number of complex samples
+ */
+void nom_mix_iq16_si32(int32_t *sig_sin, int32_t *sig_cos,
+                       const int16_t *signal, const int32_t *sin_nco,
+                       const int32_t *cos_nco, const int32_t blk_size) {
+
+  for (int32_t inda = 0; inda < blk_size; inda++) {
+    sig_sin[inda] =
+        signal[2 * inda] * sin_nco[inda] + signal[2 * inda + 1] * cos_nco[inda];
+    sig_cos[inda] =
+        signal[2 * inda] * cos_nco[inda] - signal[2 * inda + 1] * sin_nco[inda];
+  }
+}
+
+/*!
+ *  \brief Wipes off the carrier, generates the Early, Prompt and Late codes and
+ * correlates them against interleaved I/Q int8 samples in a single pass as si32
+ * types
+ *  \details Complex input counterpart of nom_fused_epl_si32(), with the carrier
+ * wiped off as in nom_mix_iq8_si32().
+ *  \param[out] i_e Early in-phase correlation
+ *  \param[out] i_p Prompt in-phase correlation
+ *  \param[out] i_l Late in-phase correlation
+ *  \param[out] q_e Early quadrature correlation
+ *  \param[out] q_p Prompt quadrature correlation
+ *  \param[out] q_l Late quadrature correlation
+ *  \param[in] signal Interleaved I/Q samples, 2 * blk_size elements
+ *  \param[in] sin_lut Sine lookup table of 256 entries
+ *  \param[in] cos_lut Cosine lookup table of 256 entries
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of complex samples to correlate
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void nom_fused_epl_iq8_si32(double *i_e, double *i_p, double *i_l, double *q_e,
+                            double *q_p, double *q_l, const int8_t *signal,
+                            const int32_t *sin_lut, const int32_t *cos_lut,
+                            const int32_t *cacode, const int32_t blk_size,
+                            const double rem_carr_phase, const double carr_freq,
+                            const double rem_code_phase, const double code_freq,
+                            const double samp_freq) {
+
+  int32_t inda;
+  int32_t returnValue[6] = {0, 0, 0, 0, 0, 0};
+  int32_t sinMix, cosMix;
+
+  // Carrier NCO declarations
+  const uint32_t carrStep =
+      (uint32_t)(carr_freq * (4294967296.0 / samp_freq) + 0.5);
+  uint32_t carrPhaseBase =
+      (uint32_t)(rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+  uint32_t carrIndex = 0;
+
+  // Code NCO declarations, kept in fl32 to match nom_code_si32()
+  const float earlyLateSpc = 0.5;
+  const float remCodePhase = (float)rem_code_phase;
+  const float codePhaseStep = (float)code_freq / (float)samp_freq;
+  float baseCode;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    carrIndex = (carrPhaseBase >> GNSS_NCO_LUT_SHIFT) & GNSS_NCO_LUT_MASK;
+    sinMix = signal[2 * inda] * sin_lut[carrIndex] +
+             signal[2 * inda + 1] * cos_lut[carrIndex];
+    cosMix = signal[2 * inda] * cos_lut[carrIndex] -
+             signal[2 * inda + 1] * sin_lut[carrIndex];
+    carrPhaseBase += carrStep;
+
+    baseCode = (inda * codePhaseStep + remCodePhase);
+    pCodeIdx = (int32_t)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
+    eCodeIdx = (int32_t)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
+                   ? (baseCode - earlyLateSpc + 1)
+                   : (baseCode - earlyLateSpc);
+    lCodeIdx = (int32_t)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
+                   ? (baseCode + earlyLateSpc + 1)
+                   : (baseCode + earlyLateSpc);
+
+    returnValue[0] += cacode[eCodeIdx] * sinMix;
+    returnValue[1] += cacode[pCodeIdx] * sinMix;
+    returnValue[2] += cacode[lCodeIdx] * sinMix;
+    returnValue[3] += cacode[eCodeIdx] * cosMix;
+    returnValue[4] += cacode[pCodeIdx] * cosMix;
+    returnValue[5] += cacode[lCodeIdx] * cosMix;
+  }
+
+  *i_e = returnValue[0];
+  *i_p = returnValue[1];
+  *i_l = returnValue[2];
+  *q_e = returnValue[3];
+  *q_p = returnValue[4];
+  *q_l = returnValue[5];
+}
+
+/*!
+ *  \brief Wipes off the carrier, generates the Early, Prompt and Late codes and
+ * correlates them against the raw signal in a single pass as fl32 types
+ *  \param[out] i_e Early in-phase correlation
+ *  \param[out] i_p Prompt in-phase correlation
+ *  \param[out] i_l Late in-phase correlation
+ *  \param[out] q_e Early quadrature correlation
+ *  \param[out] q_p Prompt quadrature correlation
+ *  \param[out] q_l Late quadrature correlation
+ *  \param[in] signal Raw real signal samples
+ *  \param[in] sin_lut Sine lookup table of 256 entries
+ *  \param[in] cos_lut Cosine lookup table of 256 entries
+ *  \param[in] cacode Nominal satellite ranging code
+ *  \param[in] blk_size Total number of samples to correlate
+ *  \param[in] rem_carr_phase Carrier phase remainder of the sinusoidal wave
+ *  \param[in] carr_freq Carrier frequency of the sinusoidal wave
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void nom_fused_epl_fl32(double *i_e, double *i_p, double *i_l, double *q_e,
+                        double *q_p, double *q_l, const int8_t *signal,
+                        const float *sin_lut, const float *cos_lut,
+                        const float *cacode, const int32_t blk_size,
+                        const double rem_carr_phase, const double carr_freq,
+                        const double rem_code_phase, const double code_freq,
+                        const double samp_freq) {
+
+  int32_t inda;
+  float returnValue[6] = {0, 0, 0, 0, 0, 0};
+  float sinMix, cosMix;
+
+  // Carrier NCO declarations
+  const uint32_t carrStep =
+      (uint32_t)(carr_freq * (4294967296.0 / samp_freq) + 0.5);
+  uint32_t carrPhaseBase =
+      (uint32_t)(rem_carr_phase * (4294967296.0 / (2.0 * M_PI)) + 0.5);
+  uint32_t carrIndex = 0;
+
+  // Code NCO declarations, kept in fl32 to match nom_code_fl32()
+  const float earlyLateSpc = 0.5;
+  const float remCodePhase = (float)rem_code_phase;
+  const float codePhaseStep = (float)code_freq / (float)samp_freq;
+  float baseCode;
+  int32_t pCodeIdx, eCodeIdx, lCodeIdx;
+
+  // for each sample
+  for (inda = 0; inda < blk_size; ++inda) {
+    carrIndex = (carrPhaseBase >> GNSS_NCO_LUT_SHIFT) & GNSS_NCO_LUT_MASK;
+    sinMix = sin_lut[carrIndex] * signal[inda];
+    cosMix = cos_lut[carrIndex] * signal[inda];
+    carrPhaseBase += carrStep;
+
+    baseCode = (inda * codePhaseStep + remCodePhase);
+    pCodeIdx = (int32_t)(baseCode) < baseCode ? (baseCode + 1) : baseCode;
+    eCodeIdx = (int32_t)(baseCode - earlyLateSpc) < (baseCode - earlyLateSpc)
+                   ? (baseCode - earlyLateSpc + 1)
+                   : (baseCode - earlyLateSpc);
+    lCodeIdx = (int32_t)(baseCode + earlyLateSpc) < (baseCode + earlyLateSpc)
+                   ? (baseCode + earlyLateSpc + 1)
+                   : (baseCode + earlyLateSpc);
+
+    returnValue[0] += cacode[eCodeIdx] * sinMix;
+    returnValue[1] += cacode[pCodeIdx] * sinMix;
+    returnValue[2] += cacode[lCodeIdx] * sinMix;
+    returnValue[3] += cacode[eCodeIdx] * cosMix;
+    returnValue[4] += cacode[pCodeIdx] * cosMix;
+    returnValue[5] += cacode[lCodeIdx] * cosMix;
+  }
+
+  *i_e = returnValue[0];
+  *i_p = returnValue[1];
+  *i_l = returnValue[2];
+  *q_e = returnValue[3];
+  *q_p = returnValue[4];
+  *q_l = returnValue[5];
+}
+
+/*!
+ *  \brief Correlates the in-phase and quadrature baseband signals against an
+ * arbitrary number of code replicas as si32 types
+ *  \pre Same padding requirements on cacode as avx2_correlate_ntap_si32().
+ *  \param[out] i_taps In-phase correlation of each tap
+ *  \param[out] q_taps Quadrature correlation of each tap
+ *  \param[in] sig_sin Baseband signal mixed with the sine carrier
+ *  \param[in] sig_cos Baseband signal mixed with the cosine carrier
+ *  \param[in] cacode Padded satellite ranging code
+ *  \param[in] tap_offsets Offset of each tap from the prompt replica in chips
+ *  \param[in] num_taps Number of taps
+ *  \param[in] blk_size Total number of samples to correlate
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void nom_correlate_ntap_si32(double *i_taps, double *q_taps,
+                             const int32_t *sig_sin, const int32_t *sig_cos,
+                             const int32_t *cacode, const float *tap_offsets,
+                             const int32_t num_taps, const int32_t blk_size,
+                             const float rem_code_phase, const float code_freq,
+                             const float samp_freq) {
+
+  int32_t inda, t;
+  float codePhaseStep = code_freq / samp_freq;
+  float baseCode;
+  int32_t codeIdx;
+  int32_t returnValue[2];
+
+  for (t = 0; t < num_taps; t++) {
+    returnValue[0] = 0;
+    returnValue[1] = 0;
+    for (inda = 0; inda < blk_size; inda++) {
+      baseCode = inda * codePhaseStep + rem_code_phase + tap_offsets[t];
+      codeIdx = (int32_t)baseCode < baseCode ? (int32_t)baseCode + 1
+                                             : (int32_t)baseCode;
+      returnValue[0] += cacode[codeIdx] * sig_sin[inda];
+      returnValue[1] += cacode[codeIdx] * sig_cos[inda];
+    }
+    i_taps[t] = returnValue[0];
+    q_taps[t] = returnValue[1];
+  }
+}
+
+/*!
+ *  \brief Correlates the in-phase and quadrature baseband signals against an
+ * arbitrary number of code replicas as fl32 types
+ *  \pre Same padding requirements on cacode as avx2_correlate_ntap_fl32().
+ *  \param[out] i_taps In-phase correlation of each tap
+ *  \param[out] q_taps Quadrature correlation of each tap
+ *  \param[in] sig_sin Baseband signal mixed with the sine carrier
+ *  \param[in] sig_cos Baseband signal mixed with the cosine carrier
+ *  \param[in] cacode Padded satellite ranging code
+ *  \param[in] tap_offsets Offset of each tap from the prompt replica in chips
+ *  \param[in] num_taps Number of taps
+ *  \param[in] blk_size Total number of samples to correlate
+ *  \param[in] rem_code_phase Code phase remainder of the ranging code
+ *  \param[in] code_freq Code frequency of the ranging code
+ *  \param[in] samp_freq Sampling frequency of the signal
+ */
+void nom_correlate_ntap_fl32(double *i_taps, double *q_taps,
+                             const float *sig_sin, const float *sig_cos,
+                             const float *cacode, const float *tap_offsets,
+                             const int32_t num_taps, const int32_t blk_size,
+                             const float rem_code_phase, const float code_freq,
+                             const float samp_freq) {
+
+  int32_t inda, t;
+  float codePhaseStep = code_freq / samp_freq;
+  float baseCode;
+  int32_t codeIdx;
+  float returnValue[2];
+
+  for (t = 0; t < num_taps; t++) {
+    returnValue[0] = 0;
+    returnValue[1] = 0;
+    for (inda = 0; inda < blk_size; inda++) {
+      baseCode = inda * codePhaseStep + rem_code_phase + tap_offsets[t];
+      codeIdx = (int32_t)baseCode < baseCode ? (int32_t)baseCode + 1
+                                             : (int32_t)baseCode;
+      returnValue[0] += cacode[codeIdx] * sig_sin[inda];
+      returnValue[1] += cacode[codeIdx] * sig_cos[inda];
+    }
+    i_taps[t] = returnValue[0];
+    q_taps[t] = returnValue[1];
+  }
+}
+
+/*!
+ *  \brief Unpacks 2-bit sign/magnitude samples into one int8_t per sample
+ *  \details Each byte holds four samples, the first one in the two least
+ * significant bits. Within a sample the high bit is the sign and the low bit
+ * the magnitude, mapped to the usual front-end levels -3, -1, +1 and +3.
+ *  \param[out] samples Unpacked samples, 4 * num_bytes elements
+ *  \param[in] packed Packed samples
+ *  \param[in] num_bytes Number of packed bytes
+ */
+void nom_unpack_2bit_si8(int8_t *samples, const uint8_t *packed,
+                         const int32_t num_bytes) {
+
+  const int8_t levels[4] = {1, 3, -1, -3};
+
+  for (int32_t inda = 0; inda < num_bytes; inda++) {
+    samples[4 * inda] = levels[packed[inda] & 0x03];
+    samples[4 * inda + 1] = levels[(packed[inda] >> 2) & 0x03];
+    samples[4 * inda + 2] = levels[(packed[inda] >> 4) & 0x03];
+    samples[4 * inda + 3] = levels[(packed[inda] >> 6) & 0x03];
+  }
+}
+
+/*!
+ *  \brief Unpacks 4-bit sign/magnitude samples into one int8_t per sample
+ *  \details Each byte holds two samples, the first one in the low nibble.
+ * Within a sample bit 3 is the sign and bits 0-2 the magnitude, giving levels
+ * from -7 to +7.
+ *  \param[out] samples Unpacked samples, 2 * num_bytes elements
+ *  \param[in] packed Packed samples
+ *  \param[in] num_bytes Number of packed bytes
+ */
+void nom_unpack_4bit_si8(int8_t *samples, const uint8_t *packed,
+                         const int32_t num_bytes) {
+
+  const int8_t levels[16] = {0, 1,  2,  3,  4,  5,  6,  7,
+                             0, -1, -2, -3, -4, -5, -6, -7};
+
+  for (int32_t inda = 0; inda < num_bytes; inda++) {
+    samples[2 * inda] = levels[packed[inda] & 0x0F];
+    samples[2 * inda + 1] = levels[packed[inda] >> 4];
+  }
+}
+
+/*!
+ *  \brief Packs the signs of int8_t samples into 64-bit words
+ *  \details Sample i sets bit i % 64 of word i / 64 when it is negative, so
+ * a 1-bit front-end sample or a +1/-1 code chip takes a single bit. The unused
+ * bits of the last word are cleared.
+ *  \param[out] bits Packed signs, (num_points + 63) / 64 words
+ *  \param[in] samples Samples to pack
+ *  \param[in] num_points Number of samples
+ */
+void nom_pack_sign_si8(uint64_t *bits, const int8_t *samples,
+                       const int32_t num_points) {
+
+  for (int32_t inda = 0; inda < (num_points + 63) / 64; inda++) {
+    bits[inda] = 0;
+  }
+  for (int32_t inda = 0; inda < num_points; inda++) {
+    bits[inda / 64] |= (uint64_t)(samples[inda] < 0) << (inda % 64);
+  }
+}
+
+/*!
+ *  \brief Packs the signs of int32_t samples into 64-bit words
+ *  \details Same layout as nom_pack_sign_si8(), for the si32 code replicas.
+ *  \param[out] bits Packed signs, (num_points + 63) / 64 words
+ *  \param[in] samples Samples to pack
+ *  \param[in] num_points Number of samples
+ */
+void nom_pack_sign_si32(uint64_t *bits, const int32_t *samples,
+                        const int32_t num_points) {
+
+  for (int32_t inda = 0; inda < (num_points + 63) / 64; inda++) {
+    bits[inda] = 0;
+  }
+  for (int32_t inda = 0; inda < num_points; inda++) {
+    bits[inda / 64] |= (uint64_t)(samples[inda] < 0) << (inda % 64);
+  }
+}
+
+/*!
+ *  \brief Correlates two vectors of packed signs
+ *  \details Every pair of equal signs adds +1 and every pair of different
+ * signs -1, so the sum of the products of the +1/-1 values is num_points
+ * minus twice the number of bits set in a XOR b. Bits past num_points are
+ * ignored.
+ *  \param[in] a_bits First vector of packed signs
+ *  \param[in] b_bits Second vector of packed signs
+ *  \param[in] num_points Number of points in each vector
+ *  \return Correlation of the +1/-1 values
+ */
+int32_t nom_xor_and_acc_b1(const uint64_t *a_bits, const uint64_t *b_bits,
+                           const int32_t num_points) {
+
+  int32_t inda;
+  int32_t flips = 0;
+  uint64_t diff;
+
+  for (inda = 0; inda < num_points / 64; inda++) {
+    flips += __builtin_popcountll(a_bits[inda] ^ b_bits[inda]);
+  }
+  if (num_points % 64) {
+    diff = (a_bits[inda] ^ b_bits[inda]) & ((1ull << (num_points % 64)) - 1);
+    flips += __builtin_popcountll(diff);
+  }
+  return num_points - 2 * flips;
+}
+
+/*!
+ *  \brief Multiply and accumulates product of two vectors storing the result in
+ * a fl32 type
+ * \param[in] aVector First vector to multiply
+ * \param[in] bVector Second vector to multiply
+ * \param[in] num_points Number of points in each vector
+ */
+static inline float nom_mul_and_acc_fl32(const float *aVector,
+                                         const float *bVector,
+                                         uint32_t num_points) {
+
+  float returnValue = 0;
+  uint32_t number = 0;
+
+  for (; number < num_points; number++) {
+    returnValue += (*aVector++) * (*bVector++);
+  }
+  return returnValue;
+}
+
+/*!
+ *  \brief Multiply and accumulates product of two vectors storing the result in
+ * a si32 type
+ * \param[in] aVector First vector to multiply
+ * \param[in] bVector Second vector to multiply
+ * \param[in] num_points Number of points in each vector
+ */
+static inline double nom_mul_and_acc_si32(const int32_t *aVector,
+                                          const int32_t *bVector,
+                                          uint32_t num_points) {
+
+  int32_t returnValue = 0;
+  uint32_t number = 0;
+
+  for (; number < num_points; number++) {
+    returnValue += (*aVector++) * (*bVector++);
+  }
+  return returnValue;
+}
+
+/*!
+ *  \brief Multiply and accumulates product of two vectors of si16 type
+ * storing the result in a si32 type
+ * \param[in] aVector First vector to multiply
+ * \param[in] bVector Second vector to multiply
+ * \param[in] num_points Number of points in each vector
+ */
+static inline double nom_mul_and_acc_si16(const int16_t *aVector,
+                                          const int16_t *bVector,
+                                          uint32_t num_points) {
+
+  int32_t returnValue = 0;
+  uint32_t number = 0;
+
+  for (; number < num_points; number++) {
+    returnValue += (*aVector++) * (*bVector++);
+  }
+  return returnValue;
+}
+
+/*!
+ *  \brief Multiply and accumulates product of two vectors of si8 type
+ * storing the result in a si32 type
+ * \param[in] aVector First vector to multiply
+ * \param[in] bVector Second vector to multiply
+ * \param[in] num_points Number of points in each vector
+ */
+static inline double nom_mul_and_acc_si8(const int8_t *aVector,
+                                         const int8_t *bVector,
+                                         uint32_t num_points) {
+
+  int32_t returnValue = 0;
+  uint32_t number = 0;
+
+  for (; number < num_points; number++) {
+    returnValue += (*aVector++) * (*bVector++);
+  }
+  return returnValue;
+}
+
+/*!
+ *  \brief Correlates the Early, Prompt and Late codes against the in-phase and
+ * quadrature baseband signals in a single pass as fl32 types
+ *  \param[out] i_e Early in-phase correlation
+ *  \param[out] i_p Prompt in-phase correlation
+ *  \param[out] i_l Late in-phase correlation
+ *  \param[out] q_e Early quadrature correlation
+ *  \param[out] q_p Prompt quadrature correlation
+ *  \param[out] q_l Late quadrature correlation
+ *  \param[in] ecode Early CA code
+ *  \param[in] pcode Prompt CA code
+ *  \param[in] lcode Late CA code
+ *  \param[in] sig_sin Baseband signal mixed with the sine carrier
+ *  \param[in] sig_cos Baseband signal mixed with the cosine carrier
+ *  \param[in] num_points Number of points in each vector
+ */
+static inline void
+nom_correlate_epl_fl32(double *i_e, double *i_p, double *i_l, double *q_e,
+                       double *q_p, double *q_l, const float *ecode,
+                       const float *pcode, const float *lcode,
+                       const float *sig_sin, const float *sig_cos,
+                       uint32_t num_points) {
+
+  uint32_t number = 0;
+  float returnValue[6] = {0, 0, 0, 0, 0, 0};
+
+  for (; number < num_points; number++) {
+    returnValue[0] += (*ecode) * (*sig_sin);
+    returnValue[1] += (*pcode) * (*sig_sin);
+    returnValue[2] += (*lcode) * (*sig_sin);
+    returnValue[3] += (*ecode++) * (*sig_cos);
+    returnValue[4] += (*pcode++) * (*sig_cos);
+    returnValue[5] += (*lcode++) * (*sig_cos);
+    sig_sin++;
+    sig_cos++;
+  }
+
+  *i_e = returnValue[0];
+  *i_p = returnValue[1];
+  *i_l = returnValue[2];
+  *q_e = returnValue[3];
+  *q_p = returnValue[4];
+  *q_l = returnValue[5];
+}
+
+/*!
+ *  \brief Correlates the Early, Prompt and Late codes against the in-phase and
+ * quadrature baseband signals in a single pass as si32 types
+ *  \param[out] i_e Early in-phase correlation
+ *  \param[out] i_p Prompt in-phase correlation
+ *  \param[out] i_l Late in-phase correlation
+ *  \param[out] q_e Early quadrature correlation
+ *  \param[out] q_p Prompt quadrature correlation
+ *  \param[out] q_l Late quadrature correlation
+ *  \param[in] ecode Early CA code
+ *  \param[in] pcode Prompt CA code
+ *  \param[in] lcode Late CA code
+ *  \param[in] sig_sin Baseband signal mixed with the sine carrier
+ *  \param[in] sig_cos Baseband signal mixed with the cosine carrier
+ *  \param[in] num_points Number of points in each vector
+ */
+static inline void
+nom_correlate_epl_si32(double *i_e, double *i_p, double *i_l, double *q_e,
+                       double *q_p, double *q_l, const int32_t *ecode,
+                       const int32_t *pcode, const int32_t *lcode,
+                       const int32_t *sig_sin, const int32_t *sig_cos,
+                       uint32_t num_points) {
+
+  uint32_t number = 0;
+  int32_t returnValue[6] = {0, 0, 0, 0, 0, 0};
+
+  for (; number < num_points; number++) {
+    returnValue[0] += (*ecode) * (*sig_sin);
+    returnValue[1] += (*pcode) * (*sig_sin);
+    returnValue[2] += (*lcode) * (*sig_sin);
+    returnValue[3] += (*ecode++) * (*sig_cos);
+    returnValue[4] += (*pcode++) * (*sig_cos);
+    returnValue[5] += (*lcode++) * (*sig_cos);
+    sig_sin++;
+    sig_cos++;
+  }
+
+  *i_e = returnValue[0];
+  *i_p = returnValue[1];
+  *i_l = returnValue[2];
+  *q_e = returnValue[3];
+  *q_p = returnValue[4];
+  *q_l = returnValue[5];
+}
+
+#endif /* NOM_INTRINSICS_H */
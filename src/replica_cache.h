@@ -0,0 +1,197 @@
+/*!
+ *  \file replica_cache.h
+ *  \brief      Cache of pre-resampled Early, Prompt and Late code replicas
+ *  \details    Over a few code periods the code Doppler of a channel hardly
+ * moves, and since every block starts a new code period the code phase of its
+ * first sample stays within one sample of chip zero. The replicas a channel
+ * needs therefore repeat, and gnss_replica_cache_code() keeps them in a
+ * bounded set of cache line aligned buffers instead of gathering three full
+ * replicas out of the ranging code on every period. Entries are keyed by the
+ * ranging code, the block size and the code NCO phase and step quantized to
+ * GNSS_REPLICA_PHASE_BITS fractional chip bits and GNSS_REPLICA_STEP_SHIFT
+ * dropped step bits, and the least recently used entry is evicted on a miss.
+ * A replica is generated from the quantized phase and step, so its chips may
+ * switch up to half a phase quantum plus the step drift over the block away
+ * from where the exact NCO would switch them. The cache is not thread safe,
+ * each worker keeps its own.
+ *  \author    Damian Miralles
+ *  \author    Jake Johnson
+ *  \version   4.1a
+ *  \date      Jan 23, 2018
+ */
+
+#ifndef REPLICA_CACHE_H
+#define REPLICA_CACHE_H
+
+#include "dispatch_intrinsics.h"
+#include "nco_state.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+//! Fractional chip bits of the code phase kept in the cache key
+#ifndef GNSS_REPLICA_PHASE_BITS
+#define GNSS_REPLICA_PHASE_BITS 6
+#endif
+
+//! Low bits of the 32.32 code phase step dropped from the cache key
+#ifndef GNSS_REPLICA_STEP_SHIFT
+#define GNSS_REPLICA_STEP_SHIFT 12
+#endif
+
+//! Alignment of the cached replicas in bytes
+#define GNSS_REPLICA_ALIGN 64
+
+/*!
+ *  \brief Cached Early, Prompt and Late replicas of one code period
+ */
+typedef struct {
+  const int32_t *cacode; /*!< Ranging code the replicas come from */
+  int32_t blk_size;      /*!< Samples in each replica, 0 if unused */
+  uint64_t phase;        /*!< Quantized code phase of the first sample */
+  uint64_t step;         /*!< Quantized code phase step */
+  uint64_t last_use;     /*!< Cache tick of the latest hit */
+  int32_t *ecode;        /*!< Early replica */
+  int32_t *pcode;        /*!< Prompt replica */
+  int32_t *lcode;        /*!< Late replica */
+} gnss_replica_entry_t;
+
+/*!
+ *  \brief Bounded least recently used set of code replicas
+ */
+typedef struct {
+  const gnss_kernels_t *kernels; /*!< Kernels generating the replicas */
+  gnss_replica_entry_t *entries; /*!< Cache entries */
+  int32_t num_entries;           /*!< Number of entries */
+  int32_t max_samples;           /*!< Largest block an entry can hold */
+  int32_t *pool;                 /*!< Storage of every replica */
+  uint64_t tick;                 /*!< Incremented on every lookup */
+  uint64_t hits;                 /*!< Lookups served from the cache */
+  uint64_t misses;               /*!< Lookups that generated a replica */
+  uint64_t rejected;             /*!< Lookups of blocks above max_samples */
+} gnss_replica_cache_t;
+
+/*!
+ *  \brief Allocates a replica cache within a memory budget
+ *  \details Each entry holds three replicas of max_samples int32_t, rounded
+ * up to whole cache lines, and as many entries as fit in budget_bytes are
+ * allocated, at least one.
+ *  \param[out] cache Cache to allocate
+ *  \param[in] kernels Kernels generating the replicas on a miss
+ *  \param[in] max_samples Largest block size that will be looked up
+ *  \param[in] budget_bytes Memory budget of the replicas
+ *  \return EXIT_SUCCESS, or EXIT_FAILURE if the allocation failed
+ */
+int gnss_replica_cache_alloc(gnss_replica_cache_t *cache,
+                             const gnss_kernels_t *kernels,
+                             const int32_t max_samples,
+                             const size_t budget_bytes) {
+
+  size_t stride = (size_t)max_samples * sizeof(int32_t);
+  stride += GNSS_REPLICA_ALIGN - 1;
+  stride -= stride % GNSS_REPLICA_ALIGN;
+
+  *cache = (gnss_replica_cache_t){0};
+  cache->kernels = kernels;
+  cache->max_samples = max_samples;
+  cache->num_entries = (int32_t)(budget_bytes / (3 * stride));
+  if (cache->num_entries < 1) {
+    cache->num_entries = 1;
+  }
+
+  cache->entries = calloc(cache->num_entries, sizeof(gnss_replica_entry_t));
+  cache->pool = aligned_alloc(GNSS_REPLICA_ALIGN,
+                              3 * stride * (size_t)cache->num_entries);
+  if (!cache->entries || !cache->pool) {
+    perror("Error allocating replica cache");
+    return EXIT_FAILURE;
+  }
+  for (int32_t n = 0; n < cache->num_entries; n++) {
+    int8_t *base = (int8_t *)cache->pool + 3 * stride * (size_t)n;
+    cache->entries[n].ecode = (int32_t *)base;
+    cache->entries[n].pcode = (int32_t *)(base + stride);
+    cache->entries[n].lcode = (int32_t *)(base + 2 * stride);
+  }
+  return EXIT_SUCCESS;
+}
+
+/*!
+ *  \brief Releases the memory of a replica cache
+ *  \param[in,out] cache Cache to release
+ */
+void gnss_replica_cache_free(gnss_replica_cache_t *cache) {
+  free(cache->entries);
+  free(cache->pool);
+  *cache = (gnss_replica_cache_t){0};
+}
+
+/*!
+ *  \brief Early, Prompt and Late replicas of the next code period
+ *  \details Drop-in replacement for the *_code_state_si32 kernels: the
+ * replicas are returned by pointer instead of being written to the caller's
+ * vectors, and the NCO is advanced exactly as the kernels would. The
+ * pointers stay valid until the next lookup. A block longer than the
+ * max_samples of the cache does not fit in an entry and is rejected without
+ * advancing the NCO, the caller then generates that period itself.
+ *  \param[in,out] cache Replica cache
+ *  \param[out] ecode Early replica of the ranging code
+ *  \param[out] pcode Prompt replica of the ranging code
+ *  \param[out] lcode Late replica of the ranging code
+ *  \param[in] cacode Padded ranging code, also part of the cache key
+ *  \param[in] blk_size Total number of elements in the code vectors
+ *  \param[in,out] nco Code NCO state, advanced to the sample that follows the
+ * block
+ *  \return EXIT_SUCCESS, or EXIT_FAILURE if blk_size exceeds max_samples
+ */
+int gnss_replica_cache_code(gnss_replica_cache_t *cache,
+                             const int32_t **ecode, const int32_t **pcode,
+                             const int32_t **lcode, const int32_t *cacode,
+                             const int32_t blk_size, gnss_code_nco_t *nco) {
+
+  const uint64_t phase_half = 1ull << (31 - GNSS_REPLICA_PHASE_BITS);
+  const uint64_t step_half = 1ull << (GNSS_REPLICA_STEP_SHIFT - 1);
+  const uint64_t phase = (nco->phase + phase_half) & ~(2 * phase_half - 1);
+  const uint64_t step = (nco->step + step_half) & ~(2 * step_half - 1);
+  gnss_replica_entry_t *entry = NULL;
+  gnss_replica_entry_t *oldest = &cache->entries[0];
+
+  if (blk_size > cache->max_samples) {
+    cache->rejected++;
+    return EXIT_FAILURE;
+  }
+
+  cache->tick++;
+  for (int32_t n = 0; n < cache->num_entries && entry == NULL; n++) {
+    gnss_replica_entry_t *e = &cache->entries[n];
+    if (e->blk_size == blk_size && e->cacode == cacode && e->phase == phase &&
+        e->step == step) {
+      entry = e;
+    } else if (e->last_use < oldest->last_use) {
+      oldest = e;
+    }
+  }
+
+  if (entry != NULL) {
+    cache->hits++;
+  } else {
+    // Evict the least recently used entry and resample the code into it
+    gnss_code_nco_t quantized = {phase, step};
+    entry = oldest;
+    cache->kernels->code_state_si32(entry->ecode, entry->pcode, entry->lcode,
+                                    cacode, blk_size, &quantized);
+    entry->cacode = cacode;
+    entry->blk_size = blk_size;
+    entry->phase = phase;
+    entry->step = step;
+    cache->misses++;
+  }
+
+  entry->last_use = cache->tick;
+  nco->phase += (uint64_t)blk_size * nco->step;
+  *ecode = entry->ecode;
+  *pcode = entry->pcode;
+  *lcode = entry->lcode;
+  return EXIT_SUCCESS;
+}
+
+#endif /* REPLICA_CACHE_H */
@@ -0,0 +1,288 @@
+/*!
+ *  \file sample_prefetch.h
+ *  \brief      Asynchronous read-ahead of raw IF samples
+ *  \details    A dedicated reader thread fills a ring of aligned buffers from
+ * the recording while the correlators work on the previous ones, so tracking
+ * never waits on a synchronous fread(). Each buffer reserves an overlap area
+ * in front of its data where the consumer carries over the samples of the
+ * code period that straddles two chunks, which keeps every window handed out
+ * by gnss_prefetch_next() contiguous. Recordings packed at 2 or 4 bits per
+ * sample are unpacked to one int8_t per sample on the reader thread, so the
+ * file and the read syscalls shrink by 4x or 2x while the correlators keep
+ * consuming plain int8_t windows.
+ *  \author    Damian Miralles
+ *  \author    Jake Johnson
+ *  \version   4.1a
+ *  \date      Jan 23, 2018
+ *  \pre       Link with -pthread.
+ */
+
+#ifndef SAMPLE_PREFETCH_H
+#define SAMPLE_PREFETCH_H
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//! Alignment of the prefetch buffers in bytes
+#define GNSS_PREFETCH_ALIGN 64
+
+/*!
+ *  \brief Ring of read-ahead buffers and the reader thread state
+ */
+typedef struct {
+  FILE *fp;              /*!< Recording being read */
+  int num_buffers;       /*!< Number of buffers in the ring */
+  int64_t chunk_samples; /*!< Samples read into each buffer */
+  int64_t overlap;       /*!< Samples reserved in front of each buffer */
+  int8_t **buffers;      /*!< Aligned buffers of overlap + chunk_samples */
+  int64_t *filled;       /*!< Samples actually read into each buffer */
+  int sample_bits;       /*!< Bits per sample in the file, 2, 4 or 8 */
+  uint8_t *packed;       /*!< Staging buffer for packed samples */
+  //! Kernel expanding packed bytes to samples, NULL for 8 bit samples
+  void (*unpack)(int8_t *, const uint8_t *, const int32_t);
+
+  // Ring state, protected by lock
+  pthread_mutex_t lock;     /*!< Protects the ring state */
+  pthread_cond_t not_full;  /*!< Signaled when a buffer is released */
+  pthread_cond_t not_empty; /*!< Signaled when a buffer is filled */
+  int head;                 /*!< Next buffer to be filled by the reader */
+  int ready;                /*!< Filled buffers not yet consumed */
+  int held;                 /*!< Buffers held by the consumer */
+  int eof;                  /*!< Set once the reader hits the end of file */
+  int quit;                 /*!< Set to stop the reader thread */
+  int running;              /*!< Set while the reader thread exists */
+  pthread_t thread;         /*!< Reader thread */
+
+  // Consumer state
+  int current;          /*!< Buffer holding the latest window, -1 if none */
+  const int8_t *window; /*!< First sample of the latest window */
+  int64_t first_sample; /*!< Absolute index of window[0] */
+  int64_t num_samples;  /*!< Number of samples in the latest window */
+} gnss_prefetch_t;
+
+/*!
+ *  \brief Reader thread routine, fills buffers until end of file
+ *  \param[in] arg Pointer to the gnss_prefetch_t
+ *  \return NULL
+ */
+static void *gnss_prefetch_reader(void *arg) {
+
+  gnss_prefetch_t *pf = (gnss_prefetch_t *)arg;
+  int slot;
+  size_t n;
+  const int per_byte = 8 / pf->sample_bits;
+
+  for (;;) {
+    pthread_mutex_lock(&pf->lock);
+    while (pf->ready + pf->held == pf->num_buffers && !pf->quit) {
+      pthread_cond_wait(&pf->not_full, &pf->lock);
+    }
+    if (pf->quit) {
+      pthread_mutex_unlock(&pf->lock);
+      break;
+    }
+    slot = pf->head;
+    pthread_mutex_unlock(&pf->lock);
+
+    // Read outside the lock so the consumer can keep taking buffers
+    if (pf->unpack == NULL) {
+      n = fread(pf->buffers[slot] + pf->overlap, sizeof(int8_t),
+                pf->chunk_samples, pf->fp);
+    } else {
+      n = fread(pf->packed, sizeof(uint8_t), pf->chunk_samples / per_byte,
+                pf->fp);
+      pf->unpack(pf->buffers[slot] + pf->overlap, pf->packed, n);
+      n *= per_byte;
+    }
+
+    pthread_mutex_lock(&pf->lock);
+    pf->filled[slot] = n;
+    pf->head = (pf->head + 1) % pf->num_buffers;
+    pf->ready++;
+    pf->eof = (int64_t)n < pf->chunk_samples;
+    pthread_cond_signal(&pf->not_empty);
+    pthread_mutex_unlock(&pf->lock);
+
+    if (pf->eof) {
+      break;
+    }
+  }
+  return NULL;
+}
+
+/*!
+ *  \brief Opens a recording and starts reading ahead
+ *  \param[out] pf Prefetcher
+ *  \param[in] file_name Path of the recording
+ *  \param[in] start_sample Absolute index of the first sample to read
+ *  \param[in] num_buffers Number of buffers in the ring, at least 2
+ *  \param[in] chunk_samples Samples read into each buffer
+ *  \param[in] overlap Maximum number of samples carried over between windows,
+ * must be at least the largest code period block size
+ *  \param[in] sample_bits Bits per sample in the file, 2, 4 or 8. For packed
+ * files the first window starts at the first sample of the byte holding
+ * start_sample, and chunk_samples must be a multiple of 8 / sample_bits
+ *  \param[in] unpack Kernel expanding packed bytes to int8_t samples, such as
+ * the unpack_2bit_si8 or unpack_4bit_si8 entry of gnss_kernels_t. Ignored for
+ * 8 bit samples
+ *  \return EXIT_SUCCESS, or EXIT_FAILURE if the reader cannot be started
+ */
+int gnss_prefetch_open(gnss_prefetch_t *pf, const char *file_name,
+                       const int64_t start_sample, const int num_buffers,
+                       const int64_t chunk_samples, const int64_t overlap,
+                       const int sample_bits,
+                       void (*unpack)(int8_t *, const uint8_t *,
+                                      const int32_t)) {
+
+  size_t bytes;
+  int per_byte;
+
+  *pf = (gnss_prefetch_t){0};
+  pf->num_buffers = (num_buffers < 2) ? 2 : num_buffers;
+  pf->chunk_samples = chunk_samples;
+  pf->overlap = overlap;
+  pf->current = -1;
+  pf->sample_bits = sample_bits;
+  pf->unpack = (sample_bits == 8) ? NULL : unpack;
+
+  if ((sample_bits != 2 && sample_bits != 4 && sample_bits != 8) ||
+      (sample_bits != 8 && unpack == NULL)) {
+    fprintf(stderr, "Unsupported packing of %d bits per sample\n",
+            sample_bits);
+    return EXIT_FAILURE;
+  }
+  per_byte = 8 / sample_bits;
+  pf->first_sample = start_sample - start_sample % per_byte;
+
+  pf->fp = fopen(file_name, "rb");
+  if (pf->fp == NULL ||
+      fseek(pf->fp, pf->first_sample / per_byte, SEEK_SET) != 0) {
+    perror("Error opening sample file");
+    return EXIT_FAILURE;
+  }
+
+  // Round the buffers up so aligned_alloc() accepts the size
+  bytes = overlap + chunk_samples + GNSS_PREFETCH_ALIGN - 1;
+  bytes -= bytes % GNSS_PREFETCH_ALIGN;
+  pf->buffers = calloc(pf->num_buffers, sizeof(int8_t *));
+  pf->filled = calloc(pf->num_buffers, sizeof(int64_t));
+  if (pf->unpack != NULL) {
+    pf->packed = aligned_alloc(GNSS_PREFETCH_ALIGN, bytes);
+  }
+  if (!pf->buffers || !pf->filled || (pf->unpack != NULL && !pf->packed)) {
+    perror("Error allocating prefetch buffers");
+    return EXIT_FAILURE;
+  }
+  for (int b = 0; b < pf->num_buffers; b++) {
+    pf->buffers[b] = aligned_alloc(GNSS_PREFETCH_ALIGN, bytes);
+    if (pf->buffers[b] == NULL) {
+      perror("Error allocating prefetch buffers");
+      return EXIT_FAILURE;
+    }
+  }
+
+  pthread_mutex_init(&pf->lock, NULL);
+  pthread_cond_init(&pf->not_full, NULL);
+  pthread_cond_init(&pf->not_empty, NULL);
+  if (pthread_create(&pf->thread, NULL, gnss_prefetch_reader, pf) != 0) {
+    perror("Error creating reader thread");
+    return EXIT_FAILURE;
+  }
+  pf->running = 1;
+  return EXIT_SUCCESS;
+}
+
+/*!
+ *  \brief Returns the next window of samples
+ *  \details The window starts at keep_from, which must lie inside the
+ * previous window and no more than overlap samples before its end. Those
+ * samples are copied in front of the next chunk, so the window holds them
+ * followed by every sample of the chunk. keep_from is ignored on the first
+ * call, where the window starts at start_sample. The previous window is no
+ * longer valid once this function returns.
+ *  \param[in,out] pf Prefetcher
+ *  \param[in] keep_from Absolute index of the oldest sample still needed
+ *  \param[out] first_sample Absolute index of the first sample of the window
+ *  \param[out] num_samples Number of samples in the window
+ *  \return First sample of the window, or NULL once the file is exhausted
+ */
+const int8_t *gnss_prefetch_next(gnss_prefetch_t *pf, const int64_t keep_from,
+                                 int64_t *first_sample, int64_t *num_samples) {
+
+  int64_t tail = 0;
+  int slot;
+
+  pthread_mutex_lock(&pf->lock);
+  while (pf->ready == 0 && !pf->eof) {
+    pthread_cond_wait(&pf->not_empty, &pf->lock);
+  }
+  if (pf->ready == 0) {
+    pthread_mutex_unlock(&pf->lock);
+    *first_sample = pf->first_sample + pf->num_samples;
+    *num_samples = 0;
+    return NULL;
+  }
+  slot = (pf->head - pf->ready + pf->num_buffers) % pf->num_buffers;
+  pf->ready--;
+  pf->held++;
+  pthread_mutex_unlock(&pf->lock);
+
+  // Carry the samples still needed over in front of the new chunk
+  if (pf->current >= 0) {
+    tail = pf->first_sample + pf->num_samples - keep_from;
+    if (tail < 0 || tail > pf->overlap) {
+      fprintf(stderr, "Prefetch overlap of %ld samples exceeded\n",
+              (long)pf->overlap);
+      tail = (tail < 0) ? 0 : pf->overlap;
+    }
+    memcpy(pf->buffers[slot] + pf->overlap - tail,
+           pf->window + pf->num_samples - tail, tail);
+
+    // Hand the previous buffer back to the reader
+    pthread_mutex_lock(&pf->lock);
+    pf->held--;
+    pthread_cond_signal(&pf->not_full);
+    pthread_mutex_unlock(&pf->lock);
+  }
+
+  pf->first_sample = pf->first_sample + pf->num_samples - tail;
+  pf->num_samples = tail + pf->filled[slot];
+  pf->window = pf->buffers[slot] + pf->overlap - tail;
+  pf->current = slot;
+
+  *first_sample = pf->first_sample;
+  *num_samples = pf->num_samples;
+  return pf->window;
+}
+
+/*!
+ *  \brief Stops the reader thread and releases the prefetcher resources
+ *  \param[in,out] pf Prefetcher
+ */
+void gnss_prefetch_close(gnss_prefetch_t *pf) {
+
+  if (pf->running) {
+    pthread_mutex_lock(&pf->lock);
+    pf->quit = 1;
+    pthread_cond_signal(&pf->not_full);
+    pthread_mutex_unlock(&pf->lock);
+    pthread_join(pf->thread, NULL);
+    pthread_mutex_destroy(&pf->lock);
+    pthread_cond_destroy(&pf->not_full);
+    pthread_cond_destroy(&pf->not_empty);
+  }
+  for (int b = 0; pf->buffers != NULL && b < pf->num_buffers; b++) {
+    free(pf->buffers[b]);
+  }
+  free(pf->buffers);
+  free(pf->filled);
+  free(pf->packed);
+  if (pf->fp != NULL) {
+    fclose(pf->fp);
+  }
+}
+
+#endif /* SAMPLE_PREFETCH_H */
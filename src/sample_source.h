@@ -0,0 +1,139 @@
+/*!
+ *  \file sample_source.h
+ *  \brief      Memory-mapped source of raw IF samples
+ *  \details    Maps a recorded IF file once and hands out const int8_t
+ * windows that point straight into the mapping, so samples reach the
+ * correlators without a read() syscall or a copy per code period. The mapping
+ * is advised as sequential and huge-page backed, and the pages behind the
+ * processed samples can be released to keep the resident set bounded when
+ * reprocessing multi-GB recordings.
+ *  \author    Damian Miralles
+ *  \author    Jake Johnson
+ *  \version   4.1a
+ *  \date      Jan 23, 2018
+ *  \pre       POSIX platform with mmap() and madvise().
+ */
+
+#ifndef SAMPLE_SOURCE_H
+#define SAMPLE_SOURCE_H
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*!
+ *  \brief Memory-mapped sample file
+ */
+typedef struct {
+  int fd;              /*!< File descriptor of the recording */
+  const int8_t *base;  /*!< First byte of the mapping */
+  int64_t num_samples; /*!< Number of samples in the file */
+  int64_t released;    /*!< Samples whose pages were already released */
+  long page_size;      /*!< System page size */
+} gnss_sample_source_t;
+
+/*!
+ *  \brief Maps a sample file into memory
+ *  \param[out] src Sample source
+ *  \param[in] file_name Path of the recording
+ *  \return EXIT_SUCCESS, or EXIT_FAILURE if the file cannot be mapped
+ */
+int gnss_source_open(gnss_sample_source_t *src, const char *file_name) {
+
+  struct stat st;
+  void *map;
+
+  *src = (gnss_sample_source_t){0};
+  src->fd = open(file_name, O_RDONLY);
+  if (src->fd < 0) {
+    perror("Error opening sample file");
+    return EXIT_FAILURE;
+  }
+  if (fstat(src->fd, &st) != 0 || st.st_size <= 0) {
+    perror("Error reading sample file size");
+    close(src->fd);
+    return EXIT_FAILURE;
+  }
+
+  map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, src->fd, 0);
+  if (map == MAP_FAILED) {
+    perror("Error mapping sample file");
+    close(src->fd);
+    return EXIT_FAILURE;
+  }
+
+  // Hints only, the mapping works the same if the kernel ignores them
+  madvise(map, st.st_size, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+  madvise(map, st.st_size, MADV_HUGEPAGE);
+#endif
+
+  src->base = (const int8_t *)map;
+  src->num_samples = st.st_size;
+  src->page_size = sysconf(_SC_PAGESIZE);
+  return EXIT_SUCCESS;
+}
+
+/*!
+ *  \brief Returns a window of samples straight from the mapping
+ *  \param[in] src Sample source
+ *  \param[in] first_sample Absolute index of the first sample of the window
+ *  \param[in] max_samples Maximum number of samples in the window
+ *  \param[out] num_samples Number of samples available in the window, less
+ * than max_samples at the end of the file
+ *  \return Pointer to first_sample, or NULL if it lies past the end of file
+ */
+static inline const int8_t *gnss_source_window(const gnss_sample_source_t *src,
+                                               const int64_t first_sample,
+                                               const int64_t max_samples,
+                                               int64_t *num_samples) {
+
+  if (first_sample < 0 || first_sample >= src->num_samples) {
+    *num_samples = 0;
+    return NULL;
+  }
+  *num_samples = src->num_samples - first_sample;
+  if (*num_samples > max_samples) {
+    *num_samples = max_samples;
+  }
+  return src->base + first_sample;
+}
+
+/*!
+ *  \brief Releases the pages of samples that will not be read again
+ *  \details Only whole pages below first_needed are released. Reading a
+ * released sample is still valid, it is simply faulted in again from the file.
+ *  \param[in,out] src Sample source
+ *  \param[in] first_needed Absolute index of the oldest sample still needed
+ */
+static inline void gnss_source_release(gnss_sample_source_t *src,
+                                       const int64_t first_needed) {
+
+  int64_t end = first_needed - first_needed % src->page_size;
+
+  if (end > src->released) {
+    madvise((void *)(src->base + src->released), end - src->released,
+            MADV_DONTNEED);
+    src->released = end;
+  }
+}
+
+/*!
+ *  \brief Unmaps the sample file
+ *  \param[in,out] src Sample source
+ */
+void gnss_source_close(gnss_sample_source_t *src) {
+
+  if (src->base != NULL) {
+    munmap((void *)src->base, src->num_samples);
+    close(src->fd);
+  }
+  *src = (gnss_sample_source_t){0};
+  src->fd = -1;
+}
+
+#endif /* SAMPLE_SOURCE_H */
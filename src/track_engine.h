@@ -0,0 +1,291 @@
+/*!
+ *  \file track_engine.h
+ *  \brief      Multi-channel tracking engine over a shared sample stream
+ *  \details    Tracks a set of gnss_channel_t over the same block of raw
+ * samples using a fixed pool of worker threads. Every call to
+ * gnss_engine_process() hands a window of samples to the pool, each worker
+ * tracks its share of the channels through every code period that fully fits
+ * in the window, and the engine reports the oldest sample still needed so the
+ * caller can slide the window forward. The calling thread acts as worker 0.
+ *  \author    Damian Miralles
+ *  \author    Jake Johnson
+ *  \version   4.1a
+ *  \date      Jan 23, 2018
+ *  \pre       Link with -pthread.
+ */
+
+#ifndef TRACK_ENGINE_H
+#define TRACK_ENGINE_H
+
+#include "gnss_channel.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+//! Returned by gnss_engine_process() when a channel lies before the window
+#define GNSS_ENGINE_BEHIND (-2)
+
+typedef struct gnss_engine gnss_engine_t;
+
+/*!
+ *  \brief Arguments handed to each worker thread
+ */
+typedef struct {
+  gnss_engine_t *engine; /*!< Engine owning the worker */
+  int tid;               /*!< Worker index, 0 is the calling thread */
+  int skipped;           /*!< Channels left behind the current window */
+} gnss_worker_t;
+
+/*!
+ *  \brief Tracking engine state
+ */
+struct gnss_engine {
+  gnss_channel_t *channels; /*!< Channels tracked by the engine */
+  int num_channels;         /*!< Number of channels */
+  int num_threads;          /*!< Number of workers, including the caller */
+  pthread_t *threads;       /*!< Worker threads 1..num_threads-1 */
+  gnss_worker_t *workers;   /*!< Worker arguments 0..num_threads-1 */
+  pthread_barrier_t start;  /*!< Releases the workers on a new window */
+  pthread_barrier_t done;   /*!< Waits for every worker to finish a window */
+  pthread_mutex_t launch;   /*!< Held while the workers are being created */
+  int launched;             /*!< Set once every worker has been created */
+  int quit;                 /*!< Set to terminate the workers */
+
+  // Current window of samples
+  const int8_t *samples; /*!< First sample of the window */
+  int64_t first_sample;  /*!< Absolute index of samples[0] */
+  int64_t num_samples;   /*!< Number of samples in the window */
+  int num_skipped;       /*!< Channels left behind by the last window */
+};
+
+/*!
+ *  \brief Tracks the channels of a worker over the current window
+ *  \param[in,out] eng Engine
+ *  \param[in] tid Worker index
+ */
+static void gnss_engine_run_channels(gnss_engine_t *eng, const int tid) {
+
+  const int64_t end_sample = eng->first_sample + eng->num_samples;
+  gnss_channel_t *ch;
+  int64_t offset;
+  int32_t blk;
+
+  // Channels are strided across the workers to balance the load
+  eng->workers[tid].skipped = 0;
+  for (int c = tid; c < eng->num_channels; c += eng->num_threads) {
+    ch = &eng->channels[c];
+    if (ch->sample_pos < eng->first_sample) {
+      // Its samples are gone, the caller has to see it instead of a stall
+      eng->workers[tid].skipped++;
+      continue;
+    }
+    while ((blk = gnss_channel_blksize(ch)) > 0 &&
+           ch->sample_pos + blk <= end_sample) {
+      offset = (ch->sample_pos - eng->first_sample) * ch->cfg->data_adapt_coeff;
+      gnss_channel_track(ch, eng->samples + offset, blk);
+    }
+  }
+}
+
+/*!
+ *  \brief Worker thread routine
+ *  \param[in] arg Pointer to the gnss_worker_t of the worker
+ *  \return NULL
+ */
+static void *gnss_engine_worker(void *arg) {
+
+  gnss_worker_t *w = (gnss_worker_t *)arg;
+  gnss_engine_t *eng = w->engine;
+  int launched;
+
+  // Wait until the whole pool is up, and leave if it could not start
+  pthread_mutex_lock(&eng->launch);
+  launched = eng->launched;
+  pthread_mutex_unlock(&eng->launch);
+  if (!launched) {
+    return NULL;
+  }
+
+  for (;;) {
+    pthread_barrier_wait(&eng->start);
+    if (eng->quit) {
+      break;
+    }
+    gnss_engine_run_channels(eng, w->tid);
+    pthread_barrier_wait(&eng->done);
+  }
+  return NULL;
+}
+
+/*!
+ *  \brief Initializes the engine and starts its worker threads
+ *  \details The workers only reach the barriers once every one of them has
+ * been created. If a thread cannot be created, the ones already running
+ * return without touching them and are joined, and every resource is
+ * released; calling gnss_engine_free() on the failed engine does nothing.
+ *  \param[out] eng Engine to initialize
+ *  \param[in] channels Initialized channels, owned by the caller
+ *  \param[in] num_channels Number of channels
+ *  \param[in] num_threads Number of workers, including the calling thread
+ *  \return EXIT_SUCCESS, or EXIT_FAILURE if the pool could not be started
+ */
+int gnss_engine_init(gnss_engine_t *eng, gnss_channel_t *channels,
+                     const int num_channels, int num_threads) {
+
+  int started = 1, err;
+
+  if (num_threads > num_channels) {
+    num_threads = num_channels;
+  }
+  if (num_threads < 1) {
+    num_threads = 1;
+  }
+
+  *eng = (gnss_engine_t){0};
+  eng->channels = channels;
+  eng->num_channels = num_channels;
+  eng->num_threads = num_threads;
+  eng->threads = calloc(num_threads, sizeof(pthread_t));
+  eng->workers = calloc(num_threads, sizeof(gnss_worker_t));
+  if (!eng->threads || !eng->workers) {
+    perror("Error allocating tracking engine");
+    free(eng->threads);
+    free(eng->workers);
+    *eng = (gnss_engine_t){0};
+    return EXIT_FAILURE;
+  }
+
+  if ((err = pthread_barrier_init(&eng->start, NULL, num_threads)) != 0) {
+    errno = err;
+    perror("Error creating tracking barriers");
+    free(eng->threads);
+    free(eng->workers);
+    *eng = (gnss_engine_t){0};
+    return EXIT_FAILURE;
+  }
+  if ((err = pthread_barrier_init(&eng->done, NULL, num_threads)) != 0) {
+    errno = err;
+    perror("Error creating tracking barriers");
+    pthread_barrier_destroy(&eng->start);
+    free(eng->threads);
+    free(eng->workers);
+    *eng = (gnss_engine_t){0};
+    return EXIT_FAILURE;
+  }
+  pthread_mutex_init(&eng->launch, NULL);
+
+  for (int t = 0; t < num_threads; t++) {
+    eng->workers[t].engine = eng;
+    eng->workers[t].tid = t;
+  }
+
+  pthread_mutex_lock(&eng->launch);
+  for (; started < num_threads; started++) {
+    err = pthread_create(&eng->threads[started], NULL, gnss_engine_worker,
+                         &eng->workers[started]);
+    if (err != 0) {
+      break;
+    }
+  }
+  if (started < num_threads) {
+    // The started workers wait on the launch lock, not on a barrier
+    errno = err;
+    perror("Error creating tracking worker");
+    pthread_mutex_unlock(&eng->launch);
+    for (int t = 1; t < started; t++) {
+      pthread_join(eng->threads[t], NULL);
+    }
+    pthread_mutex_destroy(&eng->launch);
+    pthread_barrier_destroy(&eng->start);
+    pthread_barrier_destroy(&eng->done);
+    free(eng->threads);
+    free(eng->workers);
+    *eng = (gnss_engine_t){0};
+    return EXIT_FAILURE;
+  }
+  eng->launched = 1;
+  pthread_mutex_unlock(&eng->launch);
+  return EXIT_SUCCESS;
+}
+
+/*!
+ *  \brief Tracks every channel over a window of samples
+ *  \details Each channel consumes all the code periods that fit entirely in
+ * the window, starting from its own sample position. A channel whose position
+ * lies before the window can never be tracked again, so it is left untouched,
+ * counted in eng->num_skipped and the call fails with GNSS_ENGINE_BEHIND. The
+ * window must always start at or before the value returned by the previous
+ * call.
+ *  \param[in,out] eng Engine
+ *  \param[in] samples Raw signal samples of the window, interleaved I/Q when
+ * the channels track complex data
+ *  \param[in] first_sample Absolute index of samples[0]
+ *  \param[in] num_samples Number of samples in the window
+ *  \return Absolute index of the oldest sample still needed by an active
+ * channel, -1 once every channel has tracked all its code periods, or
+ * GNSS_ENGINE_BEHIND if the window starts after a channel's next sample
+ */
+int64_t gnss_engine_process(gnss_engine_t *eng, const int8_t *samples,
+                            const int64_t first_sample,
+                            const int64_t num_samples) {
+
+  int64_t needed = -1;
+
+  eng->samples = samples;
+  eng->first_sample = first_sample;
+  eng->num_samples = num_samples;
+
+  if (eng->num_threads > 1) {
+    pthread_barrier_wait(&eng->start);
+  }
+  gnss_engine_run_channels(eng, 0);
+  if (eng->num_threads > 1) {
+    pthread_barrier_wait(&eng->done);
+  }
+
+  eng->num_skipped = 0;
+  for (int t = 0; t < eng->num_threads; t++) {
+    eng->num_skipped += eng->workers[t].skipped;
+  }
+  if (eng->num_skipped > 0) {
+    fprintf(stderr, "%d channels lie before window sample %ld\n",
+            eng->num_skipped, (long)first_sample);
+    return GNSS_ENGINE_BEHIND;
+  }
+
+  for (int c = 0; c < eng->num_channels; c++) {
+    if (gnss_channel_blksize(&eng->channels[c]) > 0 &&
+        (needed < 0 || eng->channels[c].sample_pos < needed)) {
+      needed = eng->channels[c].sample_pos;
+    }
+  }
+  return needed;
+}
+
+/*!
+ *  \brief Stops the worker threads and releases the engine resources
+ *  \param[in,out] eng Engine
+ */
+void gnss_engine_free(gnss_engine_t *eng) {
+
+  if (eng->workers == NULL) {
+    return;
+  }
+  if (eng->num_threads > 1) {
+    eng->quit = 1;
+    pthread_barrier_wait(&eng->start);
+    for (int t = 1; t < eng->num_threads; t++) {
+      pthread_join(eng->threads[t], NULL);
+    }
+  }
+  pthread_mutex_destroy(&eng->launch);
+  pthread_barrier_destroy(&eng->start);
+  pthread_barrier_destroy(&eng->done);
+  free(eng->threads);
+  free(eng->workers);
+  *eng = (gnss_engine_t){0};
+}
+
+#endif /* TRACK_ENGINE_H */